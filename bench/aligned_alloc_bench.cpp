@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include "mystl/allocator.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/list.hpp"
+#include "bench_util.hpp"
+
+// 超对齐分配：
+// 1. alignas(64) 节点（避免伪共享的常见写法）在内存池缓存行等级与 aligned_alloc 之间的吞吐对比
+// 2. vector<float> 缓冲区按缓存行对齐后，向量化求和在对齐/错位缓冲区上的耗时对比
+
+namespace
+{
+    struct alignas(64) padded_counter
+    {
+        long value;
+    };
+
+    constexpr int kNodes = 1000000;
+    constexpr int kFloats = 1 << 16;
+    constexpr int kPasses = 2000;
+
+    float sum(const float* p, int n)
+    {
+        float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (int i = 0; i + 4 <= n; i += 4)
+        {
+            s0 += p[i];
+            s1 += p[i + 1];
+            s2 += p[i + 2];
+            s3 += p[i + 3];
+        }
+        return s0 + s1 + s2 + s3;
+    }
+} // namespace
+
+int main()
+{
+    {
+        bench::timer t;
+        {
+            mystl::list<padded_counter> l;
+            for (int i = 0; i < kNodes; ++i) l.push_back(padded_counter{i});
+            bench::do_not_optimize(l.back().value);
+        }
+        bench::report("list<alignas(64)> mystl::allocator", t.elapsed_ms(), kNodes);
+    }
+
+    {
+        padded_counter** ptrs = static_cast<padded_counter**>(std::malloc(kNodes * sizeof(void*)));
+        bench::timer t;
+        for (int i = 0; i < kNodes; ++i)
+            ptrs[i] = static_cast<padded_counter*>(mystl::aligned_malloc(sizeof(padded_counter), 64));
+        for (int i = 0; i < kNodes; ++i) mystl::aligned_free(ptrs[i]);
+        bench::report("aligned_alloc 64 (alloc+free)", t.elapsed_ms(), kNodes);
+
+        mystl::allocator<padded_counter> alloc;
+        t.reset();
+        for (int i = 0; i < kNodes; ++i) ptrs[i] = alloc.allocate(1);
+        for (int i = 0; i < kNodes; ++i) alloc.deallocate(ptrs[i], 1);
+        bench::report("mystl::allocator<alignas(64)> (alloc+free)", t.elapsed_ms(), kNodes);
+        std::free(ptrs);
+    }
+
+    {
+        mystl::vector<float> v(kFloats + 16, 1.0f);
+        std::printf("vector<float>::data() %% 64 = %lu\n",
+                    static_cast<unsigned long>(reinterpret_cast<std::uintptr_t>(v.data()) % 64));
+
+        const double ops = static_cast<double>(kFloats) * kPasses;
+        float total = 0;
+        bench::timer t;
+        for (int pass = 0; pass < kPasses; ++pass)
+        {
+            total += sum(v.data(), kFloats);
+            bench::do_not_optimize(total);
+        }
+        bench::report("sum over 64-aligned buffer", t.elapsed_ms(), ops);
+
+        t.reset();
+        for (int pass = 0; pass < kPasses; ++pass)
+        {
+            total += sum(v.data() + 1, kFloats);
+            bench::do_not_optimize(total);
+        }
+        bench::report("sum over buffer offset by 4 bytes", t.elapsed_ms(), ops);
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "mystl/allocator.hpp"
+#include "bench_util.hpp"
+
+// 多线程分配/释放压力测试：malloc、加锁的 MemoryPool、ConcurrentMemoryPool 对比
+// 每个线程维护一个固定大小的存活窗口，反复释放最旧的块并分配新块
+
+namespace 
+{
+    constexpr size_t kWindow = 256;           // 每个线程同时存活的块数
+    constexpr size_t kOpsPerThread = 2000000; // 每个线程的分配次数
+
+    // 生成 16~256 字节的伪随机尺寸
+    inline size_t next_size(unsigned& state) 
+    {
+        state = state * 1103515245u + 12345u;
+        return 16 + ((state >> 16) % 16) * 16;
+    }
+
+    struct MallocBackend 
+    {
+        void* allocate(size_t bytes) { return std::malloc(bytes); }
+        void deallocate(void* p, size_t) { std::free(p); }
+    };
+
+    // 单线程内存池外加一把全局锁，代表“每个容器外面套一个 mutex”的做法
+    struct LockedPoolBackend 
+    {
+        mystl::MemoryPool<char> pool;
+        std::mutex mutex;
+
+        void* allocate(size_t bytes) 
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return pool.allocate(bytes);
+        }
+        void deallocate(void* p, size_t bytes) 
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pool.deallocate(static_cast<char*>(p), bytes);
+        }
+    };
+
+    struct ConcurrentPoolBackend 
+    {
+        void* allocate(size_t bytes) 
+        {
+            return mystl::ConcurrentMemoryPool<char>::instance().allocate(bytes);
+        }
+        void deallocate(void* p, size_t bytes) 
+        {
+            mystl::ConcurrentMemoryPool<char>::instance().deallocate(static_cast<char*>(p), bytes);
+        }
+    };
+
+    template<class Backend>
+    void worker(Backend& backend, unsigned seed) 
+    {
+        std::vector<void*> ptrs(kWindow, nullptr);
+        std::vector<size_t> sizes(kWindow, 0);
+        for (size_t i = 0; i < kOpsPerThread; ++i) 
+        {
+            size_t slot = i % kWindow;
+            if (ptrs[slot]) backend.deallocate(ptrs[slot], sizes[slot]);
+            sizes[slot] = next_size(seed);
+            ptrs[slot] = backend.allocate(sizes[slot]);
+            *static_cast<char*>(ptrs[slot]) = static_cast<char>(i);
+        }
+        for (size_t slot = 0; slot < kWindow; ++slot) 
+        {
+            if (ptrs[slot]) backend.deallocate(ptrs[slot], sizes[slot]);
+        }
+    }
+
+    template<class Backend>
+    void run(const char* name, Backend& backend, unsigned threads) 
+    {
+        bench::timer t;
+        std::vector<std::thread> pool;
+        for (unsigned i = 0; i < threads; ++i) 
+        {
+            pool.emplace_back([&backend, i] { worker(backend, i + 1); });
+        }
+        for (auto& th : pool) th.join();
+        double ms = t.elapsed_ms();
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s x%u", name, threads);
+        bench::report(label, ms, static_cast<double>(kOpsPerThread) * threads);
+    }
+} // namespace
+
+int main() 
+{
+    unsigned max_threads = std::thread::hardware_concurrency();
+    if (max_threads < 4) max_threads = 4;  // 核数较少时也测一下超额订阅下的锁竞争
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) 
+    {
+        MallocBackend malloc_backend;
+        LockedPoolBackend locked_backend;
+        ConcurrentPoolBackend concurrent_backend;
+
+        run("malloc", malloc_backend, threads);
+        run("MemoryPool + mutex", locked_backend, threads);
+        run("ConcurrentMemoryPool", concurrent_backend, threads);
+        std::printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "mystl/allocator.hpp"
+#include "mystl/list.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/hashtable.hpp"
+#include "mystl/functional.hpp"
+#include "bench_util.hpp"
+
+// 峰值常驻内存对比：按类型独立的内存池（旧做法）与进程级尺寸分级内存池
+// 依次构建并销毁若干种节点容器，每种容器的节点类型不同但尺寸相近。
+// 按类型独立的内存池无法复用其他类型释放的内存，峰值是各阶段之和；
+// 共享内存池的峰值只取决于最大的单个阶段。
+// 峰值内存在进程内单调不减，因此两种模式分别在子进程中运行。
+
+namespace 
+{
+    constexpr int kElements = 1000000;
+
+    // 旧做法：每个元素类型一个独立的静态内存池
+    template<class T>
+    class per_type_allocator 
+    {
+    private:
+        static mystl::MemoryPool<T>& pool() 
+        {
+            static mystl::MemoryPool<T>* p = new mystl::MemoryPool<T>;
+            return *p;
+        }
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        template<typename U>
+        struct rebind { using other = per_type_allocator<U>; };
+
+        per_type_allocator() noexcept = default;
+        template<typename U>
+        per_type_allocator(const per_type_allocator<U>&) noexcept {}
+
+        pointer allocate(size_type n) { return pool().allocate(n); }
+        void deallocate(pointer p, size_type n) noexcept { pool().deallocate(p, n); }
+        size_type max_size() const noexcept { return size_type(-1) / sizeof(T); }
+    };
+
+    template<template<class> class Alloc>
+    void run_phases(const char* name) 
+    {
+        bench::timer t;
+        {
+            mystl::list<int, Alloc<int>> l;
+            for (int i = 0; i < kElements; ++i) l.push_back(i);
+        }
+        {
+            mystl::list<double, Alloc<double>> l;
+            for (int i = 0; i < kElements; ++i) l.push_back(i);
+        }
+        {
+            mystl::rb_tree<int, mystl::less<int>, Alloc<int>> tree;
+            for (int i = 0; i < kElements; ++i) tree.insert_unique(i);
+        }
+        {
+            mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>,
+                             mystl::equal_to<int>, Alloc<int>> ht;
+            for (int i = 0; i < kElements; ++i) ht.insert_unique(i);
+        }
+        std::printf("%-24s %10.2f ms   peak RSS %8ld KiB\n",
+                    name, t.elapsed_ms(), bench::peak_rss_kb());
+    }
+} // namespace
+
+int main(int argc, char** argv) 
+{
+    if (argc > 1) 
+    {
+        if (std::strcmp(argv[1], "per-type") == 0) 
+        {
+            run_phases<per_type_allocator>("per-type MemoryPool<T>");
+        }
+        else 
+        {
+            run_phases<mystl::allocator>("shared size_class_pool");
+        }
+        return 0;
+    }
+
+    // 分别在子进程中运行两种模式
+    std::fflush(stdout);
+    std::string self = argv[0];
+    std::system((self + " per-type").c_str());
+    std::system((self + " shared").c_str());
+    return 0;
+}
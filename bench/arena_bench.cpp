@@ -0,0 +1,84 @@
+#include <cstdio>
+#include "mystl/allocator.hpp"
+#include "mystl/arena.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/list.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/functional.hpp"
+#include "bench_util.hpp"
+
+// 请求级临时容器：每个“请求”构建一个 vector、一个 list 和一棵红黑树，用完即丢。
+// 默认分配器逐个释放节点；arena 版本整轮结束后只做一次 reset。
+
+namespace
+{
+    constexpr int kRequests = 20000;
+    constexpr int kElements = 200;
+
+    // 模拟一次请求，返回一个结果防止被优化掉
+    template<class VecAlloc, class ListAlloc, class TreeAlloc>
+    long handle_request(int seed, const VecAlloc& va, const ListAlloc& la, const TreeAlloc& ta)
+    {
+        mystl::vector<int, VecAlloc> v(va);
+        mystl::list<int, ListAlloc> l(la);
+        mystl::rb_tree<int, mystl::less<int>, TreeAlloc> tree(ta);
+        for (int i = 0; i < kElements; ++i)
+        {
+            int x = (seed * 31 + i * 17) % 1009;
+            v.push_back(x);
+            l.push_back(x);
+            tree.insert_unique(x);
+        }
+        return static_cast<long>(v.size() + l.size() + tree.size());
+    }
+} // namespace
+
+int main()
+{
+    const double ops = static_cast<double>(kRequests) * kElements * 3;
+
+    {
+        long sum = 0;
+        bench::timer t;
+        for (int r = 0; r < kRequests; ++r)
+        {
+            sum += handle_request(r, mystl::allocator<int>(), mystl::allocator<int>(),
+                                  mystl::allocator<int>());
+        }
+        bench::do_not_optimize(sum);
+        bench::report("default allocator", t.elapsed_ms(), ops);
+    }
+
+    {
+        long sum = 0;
+        mystl::monotonic_arena arena;
+        bench::timer t;
+        for (int r = 0; r < kRequests; ++r)
+        {
+            mystl::arena_allocator<int> alloc(arena);
+            sum += handle_request(r, alloc, alloc, alloc);
+            arena.reset();
+        }
+        bench::do_not_optimize(sum);
+        bench::report("monotonic_arena + reset", t.elapsed_ms(), ops);
+    }
+
+    {
+        // 栈上缓冲区，足够时完全不向堆申请
+        static char buffer[256 * 1024];
+        long sum = 0;
+        mystl::monotonic_arena arena(buffer, sizeof(buffer));
+        bench::timer t;
+        for (int r = 0; r < kRequests; ++r)
+        {
+            mystl::arena_allocator<int> alloc(arena);
+            sum += handle_request(r, alloc, alloc, alloc);
+            arena.reset();
+        }
+        bench::do_not_optimize(sum);
+        bench::report("monotonic_arena (static buffer)", t.elapsed_ms(), ops);
+    }
+
+    std::printf("peak RSS %ld KiB\n", bench::peak_rss_kb());
+    return 0;
+}
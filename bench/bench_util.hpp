@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// 基准测试公共工具：计时器和结果输出
+namespace bench 
+{
+    // 简单计时器：构造时开始计时
+    class timer 
+    {
+    private:
+        std::chrono::steady_clock::time_point start_;
+
+    public:
+        timer() : start_(std::chrono::steady_clock::now()) {}
+
+        void reset() { start_ = std::chrono::steady_clock::now(); }
+
+        // 经过的时间（毫秒）
+        double elapsed_ms() const 
+        {
+            auto d = std::chrono::steady_clock::now() - start_;
+            return std::chrono::duration<double, std::milli>(d).count();
+        }
+    };
+
+    // 防止编译器把基准测试的计算优化掉
+    template<class T>
+    inline void do_not_optimize(const T& value) 
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    // 进程峰值常驻内存（KiB），目前只支持 Linux，其他平台返回 0
+    inline long peak_rss_kb() 
+    {
+#if defined(__linux__)
+        FILE* f = std::fopen("/proc/self/status", "r");
+        if (!f) return 0;
+        char line[256];
+        long kb = 0;
+        while (std::fgets(line, sizeof(line), f)) 
+        {
+            if (std::strncmp(line, "VmHWM:", 6) == 0) 
+            {
+                std::sscanf(line + 6, "%ld", &kb);
+                break;
+            }
+        }
+        std::fclose(f);
+        return kb;
+#else
+        return 0;
+#endif
+    }
+
+    // 输出一行结果：名称、耗时和每秒操作数
+    inline void report(const char* name, double ms, double ops) 
+    {
+        std::printf("%-40s %10.2f ms %12.2f Mops/s\n", name, ms, ops / ms / 1000.0);
+    }
+} // namespace bench
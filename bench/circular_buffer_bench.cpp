@@ -0,0 +1,143 @@
+#include <cstdio>
+#include <cstring>
+#include "mystl/circular_buffer.hpp"
+#include "mystl/deque.hpp"
+#include "mystl/queue.hpp"
+#include "bench_util.hpp"
+
+// 以 queue 的底层容器对比 deque 与环形缓冲区。
+// 稳定流量：保持 64 个元素，反复 push 一个、pop 一个；突发流量：一次压入 4096 个再全部弹出。
+// 最后一组测试批量读写：每次 append 一段字节、再按 array_one / array_two 两段整体取出，
+// 对比 deque 上逐字节 push_back / pop_front。
+// 注意 600 字节的消息在环形缓冲区中按 604 字节的步长紧密排列，多数槽位只按 4 字节对齐，
+// 逐个复制比 deque 每个缓冲区单独分配（16 字节对齐）慢；按 16 字节对齐的消息没有这个问题
+
+namespace
+{
+    constexpr int kOps = 20000000;
+    constexpr int kDepth = 64;
+    constexpr int kBurst = 4096;
+
+    struct message
+    {
+        char payload[600];
+        int id;
+    };
+
+    struct alignas(16) aligned_message
+    {
+        char payload[600];
+        int id;
+    };
+
+    template<class Queue>
+    void run_steady(const char* name)
+    {
+        Queue q;
+        typename Queue::value_type item{};
+        for (int i = 0; i < kDepth - 1; ++i) q.push(item);
+
+        bench::timer t;
+        for (int i = 0; i < kOps; ++i)
+        {
+            q.push(item);
+            bench::do_not_optimize(q.front());
+            q.pop();
+        }
+        bench::report(name, t.elapsed_ms(), static_cast<double>(kOps));
+    }
+
+    template<class Queue>
+    void run_burst(const char* name)
+    {
+        Queue q;
+        typename Queue::value_type item{};
+        const int rounds = kOps / kBurst / 4;
+
+        bench::timer t;
+        for (int r = 0; r < rounds; ++r)
+        {
+            for (int i = 0; i < kBurst; ++i) q.push(item);
+            while (!q.empty())
+            {
+                bench::do_not_optimize(q.front());
+                q.pop();
+            }
+        }
+        bench::report(name, t.elapsed_ms(), static_cast<double>(rounds) * kBurst);
+    }
+
+    // 字节流：每次写入 1500 字节，缓冲区超过 16 KB 时读出 8 KB
+    constexpr size_t kChunk = 1500;
+    constexpr size_t kDrain = 8192;
+    constexpr int kChunks = 200000;
+
+    void run_bytes_deque()
+    {
+        mystl::deque<char> q;
+        char chunk[kChunk] = {};
+        char out[kDrain];
+
+        bench::timer t;
+        for (int i = 0; i < kChunks; ++i)
+        {
+            for (size_t j = 0; j < kChunk; ++j) q.push_back(chunk[j]);
+            if (q.size() > 2 * kDrain)
+            {
+                for (size_t j = 0; j < kDrain; ++j)
+                {
+                    out[j] = q.front();
+                    q.pop_front();
+                }
+                bench::do_not_optimize(out[0]);
+            }
+        }
+        bench::report("byte stream deque<char> per byte", t.elapsed_ms(), static_cast<double>(kChunks) * kChunk);
+    }
+
+    void run_bytes_ring()
+    {
+        mystl::ring_buffer<char, 32768> rb;
+        char chunk[kChunk] = {};
+        char out[kDrain];
+
+        bench::timer t;
+        for (int i = 0; i < kChunks; ++i)
+        {
+            rb.append(chunk, chunk + kChunk);
+            if (rb.size() > 2 * kDrain)
+            {
+                // 取出 kDrain 字节：最多两次 memcpy
+                auto one = rb.array_one();
+                size_t n1 = one.size() < kDrain ? one.size() : kDrain;
+                std::memcpy(out, one.begin(), n1);
+                std::memcpy(out + n1, rb.array_two().begin(), kDrain - n1);
+                rb.pop_front(kDrain);
+                bench::do_not_optimize(out[0]);
+            }
+        }
+        bench::report("byte stream ring_buffer<char> spans", t.elapsed_ms(), static_cast<double>(kChunks) * kChunk);
+    }
+} // namespace
+
+int main()
+{
+    run_steady<mystl::queue<int, mystl::deque<int>>>("steady queue<int, deque>");
+    run_steady<mystl::queue<int, mystl::circular_buffer<int>>>("steady queue<int, circular_buffer>");
+    run_steady<mystl::queue<int, mystl::ring_buffer<int, 64>>>("steady queue<int, ring_buffer<64>>");
+
+    run_steady<mystl::queue<message, mystl::deque<message>>>("steady queue<600 B, deque>");
+    run_steady<mystl::queue<message, mystl::circular_buffer<message>>>("steady queue<600 B, circular_buffer>");
+    run_steady<mystl::queue<message, mystl::ring_buffer<message, 64>>>("steady queue<600 B, ring_buffer<64>>");
+
+    run_steady<mystl::queue<aligned_message, mystl::deque<aligned_message>>>("steady queue<608 B/16, deque>");
+    run_steady<mystl::queue<aligned_message, mystl::circular_buffer<aligned_message>>>("steady queue<608 B/16, circular_buffer>");
+
+    run_burst<mystl::queue<int, mystl::deque<int>>>("burst queue<int, deque>");
+    run_burst<mystl::queue<int, mystl::circular_buffer<int>>>("burst queue<int, circular_buffer>");
+    run_burst<mystl::queue<int, mystl::ring_buffer<int, kBurst>>>("burst queue<int, ring_buffer<4096>>");
+
+    run_bytes_deque();
+    run_bytes_ring();
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdio>
+#include "mystl/deque.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/algorithm.hpp"
+#include "bench_util.hpp"
+
+// deque 上的 copy / fill 与中间插入、删除。
+// 逐元素循环每步都要检查是否跨越缓冲区；按块拆分后块内是原生指针，
+// 可平凡复制的元素一块一次 memmove / memset。中间插入删除的平移同样走按块的 move / move_backward
+
+namespace
+{
+    constexpr size_t kElements = size_t(1) << 20;
+    constexpr int kRounds = 50;
+
+    template<class InputIt, class OutputIt>
+    OutputIt element_copy(InputIt first, InputIt last, OutputIt result)
+    {
+        for (; first != last; ++first, ++result) *result = *first;
+        return result;
+    }
+} // namespace
+
+int main()
+{
+    mystl::deque<int> src(kElements, 1);
+    mystl::deque<int> dst(kElements);
+    mystl::vector<int> vec(kElements);
+    const double ops = static_cast<double>(kElements) * kRounds;
+
+    {
+        bench::timer t;
+        for (int r = 0; r < kRounds; ++r) element_copy(src.begin(), src.end(), dst.begin());
+        bench::do_not_optimize(dst[kElements / 2]);
+        bench::report("deque -> deque element loop", t.elapsed_ms(), ops);
+    }
+    {
+        bench::timer t;
+        for (int r = 0; r < kRounds; ++r) mystl::copy(src.begin(), src.end(), dst.begin());
+        bench::do_not_optimize(dst[kElements / 2]);
+        bench::report("deque -> deque mystl::copy", t.elapsed_ms(), ops);
+    }
+    {
+        bench::timer t;
+        for (int r = 0; r < kRounds; ++r) element_copy(src.begin(), src.end(), vec.begin());
+        bench::do_not_optimize(vec[kElements / 2]);
+        bench::report("deque -> vector element loop", t.elapsed_ms(), ops);
+    }
+    {
+        bench::timer t;
+        for (int r = 0; r < kRounds; ++r) mystl::copy(src.begin(), src.end(), vec.begin());
+        bench::do_not_optimize(vec[kElements / 2]);
+        bench::report("deque -> vector mystl::copy", t.elapsed_ms(), ops);
+    }
+    {
+        mystl::deque<char> bytes(kElements * 4);
+        bench::timer t;
+        for (int r = 0; r < kRounds; ++r) mystl::fill(bytes.begin(), bytes.end(), static_cast<char>(r));
+        bench::do_not_optimize(bytes[kElements]);
+        bench::report("deque<char> fill (4M)", t.elapsed_ms(), ops * 4);
+    }
+    {
+        // 在中间反复插入、删除一个元素：每次平移约 25 万个元素，按平移的元素个数计算吞吐
+        constexpr int kEdits = 2000;
+        bench::timer t;
+        for (int i = 0; i < kEdits; ++i)
+        {
+            src.insert(src.begin() + kElements / 4, i);
+            src.erase(src.begin() + kElements / 4 + 1);
+        }
+        bench::do_not_optimize(src.size());
+        bench::report("deque<int> insert+erase at 1/4", t.elapsed_ms(), 2.0 * kEdits * (kElements / 4));
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <cstdio>
+#include "mystl/deque.hpp"
+#include "mystl/queue.hpp"
+#include "bench_util.hpp"
+
+// 队列的稳定流量：保持 64 个元素，反复 push 一个、pop 一个。
+// 600 字节的消息默认每个缓冲区只放一个元素，每次 push 都需要新缓冲区、每次 pop 都释放一个；
+// 弹出的空缓冲区进入备用缓存后由下一次 push 取用，稳定状态下不再调用分配器。
+// BufSize = 16 时每 16 次操作才跨越一次缓冲区
+
+namespace
+{
+    constexpr int kOps = 20000000;
+    constexpr int kDepth = 64;
+
+    struct message
+    {
+        char payload[600];
+        int id;
+    };
+
+    // 统计分配器调用次数（缓冲区与 map）
+    long long g_alloc_calls = 0;
+
+    template<class T>
+    struct counting_allocator : mystl::allocator<T>
+    {
+        template<class U>
+        struct rebind
+        {
+            using other = counting_allocator<U>;
+        };
+
+        counting_allocator() noexcept = default;
+        template<class U>
+        counting_allocator(const counting_allocator<U>&) noexcept {}
+
+        T* allocate(size_t n)
+        {
+            ++g_alloc_calls;
+            return mystl::allocator<T>::allocate(n);
+        }
+
+        void deallocate(T* p, size_t n) noexcept
+        {
+            ++g_alloc_calls;
+            mystl::allocator<T>::deallocate(p, n);
+        }
+    };
+
+    template<class T, size_t BufSize>
+    void run(const char* name)
+    {
+        mystl::queue<T, mystl::deque<T, counting_allocator<T>, BufSize>> q;
+        T item{};
+        for (int i = 0; i < kDepth; ++i) q.push(item);
+
+        g_alloc_calls = 0;
+        bench::timer t;
+        for (int i = 0; i < kOps; ++i)
+        {
+            q.push(item);
+            bench::do_not_optimize(q.front());
+            q.pop();
+        }
+        double ms = t.elapsed_ms();
+        bench::report(name, ms, static_cast<double>(kOps));
+        std::printf("%-40s %10lld allocator calls\n", "", g_alloc_calls);
+    }
+} // namespace
+
+int main()
+{
+    run<message, 0>("queue<600 B message> default blocks");
+    run<message, 16>("queue<600 B message> BufSize = 16");
+    run<int, 0>("queue<int> default blocks");
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <cstdio>
+#include "mystl/vector.hpp"
+#include "mystl/dynamic_bitset.hpp"
+#include "mystl/algorithm.hpp"
+#include "bench_util.hpp"
+
+// 位图过滤：6400 万个标志，约 1% 为 1
+// vector<bool> 每个标志占一个字节（64 MiB），逐个比较；
+// dynamic_bitset 每个标志一比特（8 MiB），count / find / 按位与都按 64 位的字处理
+
+namespace
+{
+    constexpr size_t kBits = size_t(64) << 20;
+    constexpr int kRounds = 10;
+
+    bool flag_at(size_t i)
+    {
+        return (i * 2654435761u) % 100 == 0;
+    }
+
+    template<class Bits>
+    void run(const char* name, const Bits& a, const Bits& b, size_t bytes)
+    {
+        std::printf("[%s] %zu MiB\n", name, bytes >> 20);
+        {
+            bench::timer t;
+            long long total = 0;
+            for (int r = 0; r < kRounds; ++r) total += mystl::count(a.begin(), a.end(), true);
+            bench::do_not_optimize(total);
+            bench::report("count", t.elapsed_ms(), static_cast<double>(kBits) * kRounds);
+        }
+        {
+            // 依次找出所有为 1 的位
+            bench::timer t;
+            long long total = 0;
+            for (int r = 0; r < kRounds; ++r)
+            {
+                for (auto it = mystl::find(a.begin(), a.end(), true); it != a.end();
+                     it = mystl::find(it + 1, a.end(), true))
+                {
+                    ++total;
+                }
+            }
+            bench::do_not_optimize(total);
+            bench::report("find all set bits", t.elapsed_ms(), static_cast<double>(kBits) * kRounds);
+        }
+        {
+            bench::timer t;
+            size_t total = 0;
+            for (int r = 0; r < kRounds; ++r)
+            {
+                Bits c(a);
+                for (size_t i = 0; i < c.size(); ++i) c[i] = c[i] && b[i];
+                total += c.size();
+            }
+            bench::do_not_optimize(total);
+            bench::report("bitwise and (per element)", t.elapsed_ms(), static_cast<double>(kBits) * kRounds);
+        }
+    }
+} // namespace
+
+int main()
+{
+    mystl::vector<bool> va(kBits), vb(kBits);
+    mystl::dynamic_bitset<> da(kBits), db(kBits);
+    for (size_t i = 0; i < kBits; ++i)
+    {
+        va[i] = flag_at(i);
+        vb[i] = flag_at(i + 7);
+        da[i] = va[i];
+        db[i] = vb[i];
+    }
+
+    run("vector<bool>", va, vb, kBits);
+    run("dynamic_bitset", da, db, kBits / 8);
+
+    bench::timer t;
+    size_t total = 0;
+    for (int r = 0; r < kRounds; ++r)
+    {
+        mystl::dynamic_bitset<> c(da);
+        c &= db;
+        total += c.count();
+    }
+    bench::do_not_optimize(total);
+    bench::report("dynamic_bitset operator&= + count", t.elapsed_ms(), static_cast<double>(kBits) * kRounds);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <random>
+#include "mystl/flat_hash_map.hpp"
+#include "mystl/unordered_map.hpp"
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// flat_hash_map 与 unordered_map 对比：随机 64 位键，分别测试插入、命中查找、未命中查找、遍历和删除。
+// 默认规模为 1K 到 10M，命令行参数给出最大规模，如 `flat_hash_map_bench 100000000`（约需 6 GB 内存）
+
+namespace
+{
+    using key_type = size_t;
+
+    template<class Map>
+    void run(const char* name, const mystl::vector<key_type>& keys, const mystl::vector<key_type>& misses)
+    {
+        const double n = static_cast<double>(keys.size());
+        char label[64];
+
+        Map m;
+        bench::timer t;
+        for (size_t i = 0; i < keys.size(); ++i) m[keys[i]] = i;
+        std::snprintf(label, sizeof(label), "%s insert", name);
+        bench::report(label, t.elapsed_ms(), n);
+
+        // 命中查找按插入顺序的逆序访问，避免与插入时的缓存状态相同
+        t.reset();
+        size_t found = 0;
+        for (size_t i = keys.size(); i-- > 0;) found += m.find(keys[i])->second;
+        bench::do_not_optimize(found);
+        std::snprintf(label, sizeof(label), "%s find hit", name);
+        bench::report(label, t.elapsed_ms(), n);
+
+        t.reset();
+        size_t missed = 0;
+        for (size_t i = 0; i < misses.size(); ++i) missed += m.find(misses[i]) == m.end();
+        bench::do_not_optimize(missed);
+        std::snprintf(label, sizeof(label), "%s find miss", name);
+        bench::report(label, t.elapsed_ms(), n);
+
+        t.reset();
+        size_t sum = 0;
+        for (const auto& kv : m) sum += kv.second;
+        bench::do_not_optimize(sum);
+        std::snprintf(label, sizeof(label), "%s iterate", name);
+        bench::report(label, t.elapsed_ms(), n);
+
+        t.reset();
+        size_t erased = 0;
+        for (size_t i = 0; i < keys.size(); ++i) erased += m.erase(keys[i]);
+        bench::do_not_optimize(erased);
+        std::snprintf(label, sizeof(label), "%s erase", name);
+        bench::report(label, t.elapsed_ms(), n);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t max_n = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+    std::mt19937_64 gen(20240601);
+
+    for (size_t n = 1000; n <= max_n; n *= 10)
+    {
+        // 命中的键最高位为 0，未命中的键最高位为 1，两者不会重合
+        mystl::vector<key_type> keys(n), misses(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            keys[i] = gen() >> 1;
+            misses[i] = gen() | (key_type(1) << 63);
+        }
+        std::printf("--- %zu keys ---\n", n);
+        run<mystl::unordered_map<key_type, size_t>>("  unordered_map", keys, misses);
+        run<mystl::flat_hash_map<key_type, size_t>>("  flat_hash_map", keys, misses);
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "mystl/vector.hpp"
+#include "mystl/string.hpp"
+#include "bench_util.hpp"
+
+// 增长策略对峰值内存与 push_back 吞吐的影响：
+// 向 vector<long long> 追加约 1.5 GiB 的元素（一亿九千万个）。复制扩容时新旧两块同时存在，
+// 两倍增长的峰值可达所需内存的 3 倍，1.5 倍增长约为 2.5 倍；默认分配器对大块使用 realloc
+// 原地扩展（见 vector_realloc_bench），峰值主要取决于容量的余量。
+// 峰值 RSS 是整个进程的最大值，每种策略分别在子进程中运行。
+
+namespace
+{
+    constexpr size_t kElements = 190000000;
+    constexpr int kStringRounds = 200000;
+    constexpr int kStringChars = 1000;
+
+    template<class Growth>
+    void run(const char* name)
+    {
+        std::printf("[%s]\n", name);
+        {
+            bench::timer t;
+            mystl::vector<long long, mystl::allocator<long long>, Growth> v;
+            for (size_t i = 0; i < kElements; ++i) v.push_back(static_cast<long long>(i));
+            bench::do_not_optimize(v.back());
+            bench::report("vector<long long> push_back", t.elapsed_ms(), static_cast<double>(kElements));
+            std::printf("capacity/size = %.3f, peak RSS %ld MiB (data %zu MiB)\n",
+                        static_cast<double>(v.capacity()) / v.size(), bench::peak_rss_kb() / 1024,
+                        kElements * sizeof(long long) >> 20);
+        }
+        {
+            bench::timer t;
+            size_t total = 0;
+            for (int round = 0; round < kStringRounds; ++round)
+            {
+                mystl::basic_string<Growth> s;
+                for (int i = 0; i < kStringChars; ++i) s.push_back(static_cast<char>('a' + i % 26));
+                total += s.capacity();
+            }
+            bench::do_not_optimize(total);
+            bench::report("string push_back 1000 chars", t.elapsed_ms(),
+                          static_cast<double>(kStringRounds) * kStringChars);
+            std::printf("average string capacity %zu\n\n", total / kStringRounds);
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        if (std::strcmp(argv[1], "x1_5") == 0)
+            run<mystl::growth_x1_5>("growth x1.5");
+        else if (std::strcmp(argv[1], "size_class") == 0)
+            run<mystl::growth_size_class>("growth x1.5, rounded to size class / page");
+        else
+            run<mystl::growth_x2>("growth x2");
+        return 0;
+    }
+
+    // 分别在子进程中运行三种策略
+    std::fflush(stdout);
+    std::string self = argv[0];
+    std::system((self + " x2").c_str());
+    std::system((self + " x1_5").c_str());
+    std::system((self + " size_class").c_str());
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "mystl/functional.hpp"
+#include "mystl/string.hpp"
+#include "mystl/unordered_map.hpp"
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// 哈希吞吐量：
+// 1. 整数：原先的恒等映射与 hash_mix（一次 128 位乘法）
+// 2. 字节串：原先逐字节的 djb2 与 hash_bytes，长度从 4 字节到 1MB，另报告 GB/s
+// 3. 以 24 字节左右的字符串为键的 unordered_map 查找，分别使用两种字符串哈希
+
+namespace
+{
+    // 原先 hash<string> 的实现
+    size_t djb2(const char* p, size_t len)
+    {
+        size_t hash = 5381;
+        for (size_t i = 0; i < len; ++i)
+            hash = ((hash << 5) + hash) + p[i];
+        return hash;
+    }
+
+    struct djb2_hash
+    {
+        size_t operator()(const mystl::string& s) const { return djb2(s.data(), s.size()); }
+    };
+
+    void bench_integers(size_t n)
+    {
+        size_t sum = 0;
+        bench::timer t;
+        for (size_t i = 0; i < n; ++i) sum += i;
+        bench::report("int identity", t.elapsed_ms(), static_cast<double>(n));
+        bench::do_not_optimize(sum);
+
+        mystl::hash<size_t> hf;
+        t.reset();
+        for (size_t i = 0; i < n; ++i) sum += hf(i);
+        bench::report("int hash_mix", t.elapsed_ms(), static_cast<double>(n));
+        bench::do_not_optimize(sum);
+    }
+
+    template <class F>
+    void bench_bytes(const char* name, const mystl::vector<char>& buf, size_t len, size_t total, F f)
+    {
+        const size_t rounds = total / len;
+        // 起点在缓冲区内滑动，避免每次都哈希同一段数据；窗口取 2 的幂，用掩码代替取模
+        size_t window = 1;
+        while (window * 2 <= buf.size() - len + 1) window *= 2;
+        const size_t mask = (window - 1) & ~size_t(63);
+        size_t sum = 0;
+        bench::timer t;
+        for (size_t i = 0; i < rounds; ++i)
+        {
+            sum += f(buf.data() + ((i * 64) & mask) + (i & 7), len);
+        }
+        const double ms = t.elapsed_ms();
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s len=%zu", name, len);
+        bench::report(label, ms, static_cast<double>(rounds));
+        std::printf("%-40s %10.2f GB/s\n", "", static_cast<double>(rounds * len) / (ms * 1e6));
+        bench::do_not_optimize(sum);
+    }
+
+    template <class Hash>
+    void bench_lookup(const char* name, const mystl::vector<mystl::string>& keys)
+    {
+        mystl::unordered_map<mystl::string, size_t, Hash> map;
+        map.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) map[keys[i]] = i;
+
+        size_t found = 0;
+        bench::timer t;
+        for (size_t i = 0; i < keys.size(); ++i) found += map.count(keys[(i * 7919) % keys.size()]);
+        bench::report(name, t.elapsed_ms(), static_cast<double>(keys.size()));
+        bench::do_not_optimize(found);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t total = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : (size_t(1) << 30);
+
+    bench_integers(total / 4);
+
+    mystl::vector<char> buf((size_t(1) << 20) + 4096);
+    std::mt19937_64 gen(42);
+    for (size_t i = 0; i < buf.size(); ++i) buf[i] = static_cast<char>(gen());
+    for (size_t len : { 4, 8, 16, 32, 64, 256, 4096, 1 << 20 })
+    {
+        bench_bytes("djb2      ", buf, len, total / 4, djb2);
+        bench_bytes("hash_bytes", buf, len, total / 4,
+                    [](const char* p, size_t n) { return mystl::hash_bytes(p, n); });
+    }
+
+    // "user:<id>:session:<rand>" 形式的键，公共前缀较长
+    mystl::vector<mystl::string> keys;
+    for (size_t i = 0; i < 1000000; ++i)
+    {
+        char key[64];
+        std::snprintf(key, sizeof(key), "user:%zu:session:%08x", i, static_cast<unsigned>(gen()));
+        keys.push_back(mystl::string(key));
+    }
+    bench_lookup<djb2_hash>("string lookup, djb2", keys);
+    bench_lookup<mystl::hash<mystl::string>>("string lookup, hash_bytes", keys);
+    return 0;
+}
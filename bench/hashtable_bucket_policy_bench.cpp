@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "mystl/unordered_map.hpp"
+#include "mystl/bucket_policy.hpp"
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// 查找吞吐量：三种桶策略的 unordered_map 各装入 N 个随机键，
+// 再按打乱的顺序查找 N 个存在的键（hit）和 N 个不存在的键（miss）。
+// 桶下标在每次查找中都要计算一次：质数取模是一次 64 位除法，
+// 2 的幂是一次混合乘法加与运算，预计算倒数是两次乘法。
+// N 依次取 100K、1M 和命令行参数给出的上限（默认 10M），覆盖桶数组放得进缓存和放不进缓存两种情况
+
+namespace
+{
+    using key_type = size_t;
+
+    template <class Policy>
+    using map_type = mystl::unordered_map<key_type, size_t, mystl::hash<key_type>,
+                                          mystl::equal_to<key_type>,
+                                          mystl::allocator<mystl::pair<const key_type, size_t>>,
+                                          Policy>;
+
+    template <class Policy>
+    void run(const char* policy_name, const mystl::vector<key_type>& keys,
+             const mystl::vector<key_type>& hits, const mystl::vector<key_type>& misses)
+    {
+        map_type<Policy> map;
+        map.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) map[keys[i]] = i;
+
+        char name[64];
+        size_t found = 0;
+        bench::timer t;
+        for (size_t i = 0; i < hits.size(); ++i) found += map.count(hits[i]);
+        std::snprintf(name, sizeof(name), "%-9s N=%-9zu hit", policy_name, keys.size());
+        bench::report(name, t.elapsed_ms(), static_cast<double>(hits.size()));
+
+        t.reset();
+        for (size_t i = 0; i < misses.size(); ++i) found += map.count(misses[i]);
+        std::snprintf(name, sizeof(name), "%-9s N=%-9zu miss", policy_name, keys.size());
+        bench::report(name, t.elapsed_ms(), static_cast<double>(misses.size()));
+
+        std::printf("%-40s %10zu buckets, load factor %.2f\n", "", map.bucket_count(), map.load_factor());
+        bench::do_not_optimize(found);
+        if (found != hits.size()) std::printf("unexpected result: %zu\n", found);
+    }
+
+    void run_size(size_t n)
+    {
+        // 键的最高位区分存在与不存在，两组键互不重叠
+        std::mt19937_64 gen(n);
+        const key_type miss_bit = key_type(1) << 63;
+        mystl::vector<key_type> keys(n), hits(n), misses(n);
+        for (size_t i = 0; i < n; ++i) keys[i] = gen() & ~miss_bit;
+        for (size_t i = 0; i < n; ++i) hits[i] = keys[i];
+        for (size_t i = n; i > 1; --i) mystl::swap(hits[i - 1], hits[gen() % i]);
+        for (size_t i = 0; i < n; ++i) misses[i] = gen() | miss_bit;
+
+        run<mystl::prime_bucket_policy>("prime", keys, hits, misses);
+        run<mystl::power2_bucket_policy>("power2", keys, hits, misses);
+        run<mystl::fast_prime_bucket_policy>("fastmod", keys, hits, misses);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t max_n = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+    for (size_t n = 100000; n < max_n; n *= 10) run_size(n);
+    run_size(max_n);
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include "mystl/unordered_map.hpp"
+#include "mystl/string.hpp"
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// 节点中保存哈希值：以长度约 40 字节的字符串为键（默认 2M 个，命令行参数可以修改），
+// 分别测量不预留的装载（每次重哈希都要遍历全部节点）、完整迭代、命中与未命中的查找。
+// 不保存时重哈希要对每个节点重新哈希整个字符串，迭代走到每条链末尾时也要哈希一次；
+// 保存时查找先比较哈希值，同一个桶里的其他键不必逐字节比较。
+// 第二个参数为 cached 或 plain 时只运行其中一种：同一进程中后运行的一组会受到前一组释放的内存的影响
+
+namespace
+{
+    using key_type = mystl::string;
+
+    template <bool Cache>
+    using map_type = mystl::unordered_map<key_type, size_t, mystl::hash<key_type>, mystl::equal_to<key_type>,
+                                          mystl::allocator<mystl::pair<const key_type, size_t>>,
+                                          mystl::default_bucket_policy, Cache>;
+
+    template <bool Cache>
+    void run(const char* name, const mystl::vector<key_type>& keys, const mystl::vector<key_type>& misses)
+    {
+        char label[64];
+        bench::timer t;
+        map_type<Cache> map;
+        for (size_t i = 0; i < keys.size(); ++i) map[keys[i]] = i;
+        std::snprintf(label, sizeof(label), "%s load", name);
+        bench::report(label, t.elapsed_ms(), static_cast<double>(keys.size()));
+
+        size_t sum = 0;
+        t.reset();
+        for (int round = 0; round < 5; ++round)
+        {
+            for (auto it = map.begin(); it != map.end(); ++it) sum += it->second;
+        }
+        std::snprintf(label, sizeof(label), "%s iterate x5", name);
+        bench::report(label, t.elapsed_ms(), 5.0 * keys.size());
+
+        t.reset();
+        for (size_t i = 0; i < keys.size(); ++i) sum += map.count(keys[(i * 7919) % keys.size()]);
+        std::snprintf(label, sizeof(label), "%s lookup hit", name);
+        bench::report(label, t.elapsed_ms(), static_cast<double>(keys.size()));
+
+        t.reset();
+        for (size_t i = 0; i < misses.size(); ++i) sum += map.count(misses[i]);
+        std::snprintf(label, sizeof(label), "%s lookup miss", name);
+        bench::report(label, t.elapsed_ms(), static_cast<double>(misses.size()));
+
+        std::printf("%-40s %10zu buckets, %.1f MB peak RSS\n", "", map.bucket_count(), bench::peak_rss_kb() / 1024.0);
+        bench::do_not_optimize(sum);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t n = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 2000000;
+    std::mt19937_64 gen(42);
+    mystl::vector<key_type> keys, misses;
+    for (size_t i = 0; i < n; ++i)
+    {
+        // 公共前缀较长的路径形式的键，键之间的比较要扫过前缀
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "/srv/data/objects/%016llx.blob", static_cast<unsigned long long>(gen()));
+        keys.push_back(key_type(buf));
+        std::snprintf(buf, sizeof(buf), "/srv/data/objects/%016llx.tmp", static_cast<unsigned long long>(gen()));
+        misses.push_back(key_type(buf));
+    }
+
+    const char* mode = argc > 2 ? argv[2] : "";
+    if (std::strcmp(mode, "cached") != 0) run<false>("no cache", keys, misses);
+    if (std::strcmp(mode, "plain") != 0) run<true>("cached  ", keys, misses);
+    return 0;
+}
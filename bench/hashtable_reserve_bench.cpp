@@ -0,0 +1,55 @@
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "mystl/unordered_map.hpp"
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// 批量装载：向 unordered_map 插入 N 个随机键（默认 20M，命令行参数可以修改）。
+// 不预留时桶数沿质数表逐级增长，每一级都要把所有节点重新链接一遍；
+// reserve(N) 之后一次分配好桶数组，装载过程中不再重哈希。
+// 最后一组把最大负载因子调到 2，桶数组减半，链表平均长度翻倍
+
+namespace
+{
+    using key_type = size_t;
+    using map_type = mystl::unordered_map<key_type, size_t>;
+
+    enum class mode { plain, reserved, dense };
+
+    void run(const char* name, const mystl::vector<key_type>& keys, mode m)
+    {
+        bench::timer t;
+        map_type map;
+        if (m == mode::dense) map.max_load_factor(2.0f);
+        if (m != mode::plain) map.reserve(keys.size());
+        size_t rehashes = 0;
+        size_t buckets = map.bucket_count();
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            map[keys[i]] = i;
+            if (map.bucket_count() != buckets)
+            {
+                buckets = map.bucket_count();
+                ++rehashes;
+            }
+        }
+        const double ms = t.elapsed_ms();
+        bench::report(name, ms, static_cast<double>(keys.size()));
+        std::printf("%-40s %10zu rehashes, %zu buckets, load factor %.2f\n",
+                    "", rehashes, map.bucket_count(), map.load_factor());
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t n = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 20000000;
+    mystl::vector<key_type> keys(n);
+    std::mt19937_64 gen(42);
+    for (size_t i = 0; i < n; ++i) keys[i] = gen();
+
+    run("bulk load, no reserve", keys, mode::plain);
+    run("bulk load, reserve(N)", keys, mode::reserved);
+    run("bulk load, reserve(N), max_load 2.0", keys, mode::dense);
+    return 0;
+}
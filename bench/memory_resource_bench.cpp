@@ -0,0 +1,67 @@
+#include <cstdio>
+#include "mystl/allocator.hpp"
+#include "mystl/memory_resource.hpp"
+#include "mystl/list.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/functional.hpp"
+#include "bench_util.hpp"
+
+// polymorphic_allocator 的虚调用开销，以及运行时选择不同资源的收益
+// 容器类型相同（Alloc 都是 polymorphic_allocator），仅在构造时传入不同的 memory_resource
+
+namespace
+{
+    constexpr int kRounds = 200;
+    constexpr int kElements = 5000;
+
+    // 每轮构建并销毁一个 list 和一棵红黑树；mono 非空时每轮结束后 reset
+    template<class Alloc>
+    long run(const Alloc& alloc, mystl::monotonic_buffer_resource* mono)
+    {
+        long sum = 0;
+        for (int r = 0; r < kRounds; ++r)
+        {
+            {
+                mystl::list<int, Alloc> l(alloc);
+                mystl::rb_tree<int, mystl::less<int>, Alloc> tree(alloc);
+                for (int i = 0; i < kElements; ++i)
+                {
+                    l.push_back(i);
+                    tree.insert_unique((i * 7919) % kElements);
+                }
+                sum += static_cast<long>(l.size() + tree.size());
+            }
+            if (mono) mono->reset();
+        }
+        return sum;
+    }
+
+    template<class Alloc>
+    void measure(const char* name, const Alloc& alloc, mystl::monotonic_buffer_resource* mono = nullptr)
+    {
+        const double ops = static_cast<double>(kRounds) * kElements * 2;
+        bench::timer t;
+        long sum = run(alloc, mono);
+        bench::do_not_optimize(sum);
+        bench::report(name, t.elapsed_ms(), ops);
+    }
+} // namespace
+
+int main()
+{
+    using pmr = mystl::polymorphic_allocator<int>;
+
+    measure("mystl::allocator (static)", mystl::allocator<int>());
+    measure("pmr: new_delete_resource", pmr(mystl::new_delete_resource()));
+    measure("pmr: size_class_pool_resource", pmr(mystl::size_class_pool_resource()));
+
+    mystl::pool_resource pool;
+    measure("pmr: pool_resource", pmr(&pool));
+
+    // 单调资源不逐个释放，每轮结束后整体 reset
+    mystl::monotonic_buffer_resource mono;
+    measure("pmr: monotonic_buffer_resource", pmr(&mono), &mono);
+
+    std::printf("peak RSS %ld KiB\n", bench::peak_rss_kb());
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include "mystl/allocator.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/list.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/hashtable.hpp"
+#include "mystl/functional.hpp"
+#include "bench_util.hpp"
+
+// 节点容器的批量构建：逐个插入与区间构造/区间插入（节点按批分配）的对比
+// 区间版本每 NODE_BATCH_SIZE 个节点只访问一次内存池，且同一批节点在内存中相邻，
+// 构建之后的遍历同样受益
+
+namespace
+{
+    constexpr int kElements = 2000000;
+
+    using tree_type = mystl::rb_tree<int, mystl::less<int>>;
+    using table_type = mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>, mystl::equal_to<int>>;
+
+    template<class Container>
+    long long traverse(const Container& c)
+    {
+        long long sum = 0;
+        for (auto it = c.begin(); it != c.end(); ++it) sum += *it;
+        return sum;
+    }
+} // namespace
+
+int main()
+{
+    mystl::vector<int> keys;
+    for (int i = 0; i < kElements; ++i) keys.push_back(i);
+
+    {
+        bench::timer t;
+        mystl::list<int> l;
+        for (int i = 0; i < kElements; ++i) l.push_back(keys[i]);
+        bench::report("list push_back loop", t.elapsed_ms(), kElements);
+        t.reset();
+        bench::do_not_optimize(traverse(l));
+        bench::report("  traversal", t.elapsed_ms(), kElements);
+    }
+    {
+        bench::timer t;
+        mystl::list<int> l(keys.begin(), keys.end());
+        bench::report("list range constructor", t.elapsed_ms(), kElements);
+        t.reset();
+        bench::do_not_optimize(traverse(l));
+        bench::report("  traversal", t.elapsed_ms(), kElements);
+    }
+
+    {
+        bench::timer t;
+        tree_type tree;
+        for (int i = 0; i < kElements; ++i) tree.insert_unique(keys[i]);
+        bench::report("rb_tree insert_unique loop", t.elapsed_ms(), kElements);
+    }
+    {
+        bench::timer t;
+        tree_type tree;
+        tree.insert_unique(keys.begin(), keys.end());
+        bench::report("rb_tree insert_unique(first, last)", t.elapsed_ms(), kElements);
+    }
+
+    {
+        bench::timer t;
+        table_type table;
+        for (int i = 0; i < kElements; ++i) table.insert_unique(keys[i]);
+        bench::report("hashtable insert_unique loop", t.elapsed_ms(), kElements);
+    }
+    {
+        bench::timer t;
+        table_type table;
+        table.insert_unique(keys.begin(), keys.end());
+        bench::report("hashtable insert_unique(first, last)", t.elapsed_ms(), kElements);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "mystl/allocator.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/hashtable.hpp"
+#include "mystl/functional.hpp"
+#include "bench_util.hpp"
+
+// 节点容器遍历：大块内存的大小与页大小对 TLB 缺失的影响
+// 以随机顺序插入的 rb_tree 和 hashtable，遍历顺序与节点地址无关，每一步都可能落在不同的页上。
+// 固定 4 KiB 的大块内存散落在堆中，大页模式下节点集中在少数 2 MiB 页内，TLB 覆盖的范围大得多。
+// 内存池的配置对整个进程生效，三种模式分别在子进程中运行。
+
+namespace
+{
+    constexpr int kElements = 2000000;
+    constexpr int kPasses = 5;
+
+    using tree_type = mystl::rb_tree<int, mystl::less<int>>;
+    using table_type = mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>, mystl::equal_to<int>>;
+
+    // 0..n-1 的随机排列
+    mystl::vector<int> shuffled_keys(int n)
+    {
+        mystl::vector<int> keys;
+        for (int i = 0; i < n; ++i) keys.push_back(i);
+        unsigned long long state = 88172645463325252ULL;
+        for (int i = n - 1; i > 0; --i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            int j = static_cast<int>(state % static_cast<unsigned long long>(i + 1));
+            int tmp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = tmp;
+        }
+        return keys;
+    }
+
+    void run(const char* name)
+    {
+        mystl::vector<int> keys = shuffled_keys(kElements);
+
+        bench::timer t;
+        tree_type tree;
+        table_type table(kElements);
+        for (int i = 0; i < kElements; ++i)
+        {
+            tree.insert_unique(keys[i]);
+            table.insert_unique(keys[i]);
+        }
+        std::printf("[%s]\n", name);
+        bench::report("build rb_tree + hashtable", t.elapsed_ms(), kElements);
+
+        long long sum = 0;
+        t.reset();
+        for (int pass = 0; pass < kPasses; ++pass)
+        {
+            for (auto it = tree.begin(); it != tree.end(); ++it) sum += *it;
+            bench::do_not_optimize(sum);
+        }
+        bench::report("rb_tree in-order traversal", t.elapsed_ms(), static_cast<double>(kElements) * kPasses);
+
+        t.reset();
+        for (int pass = 0; pass < kPasses; ++pass)
+        {
+            for (auto it = table.begin(); it != table.end(); ++it) sum += *it;
+            bench::do_not_optimize(sum);
+        }
+        bench::report("hashtable traversal", t.elapsed_ms(), static_cast<double>(kElements) * kPasses);
+
+        t.reset();
+        for (int i = 0; i < kElements; ++i) sum += *tree.find(keys[i]);
+        bench::do_not_optimize(sum);
+        bench::report("rb_tree random find", t.elapsed_ms(), kElements);
+
+        std::printf("chunks=%zu reserved=%zu KiB peak RSS %ld KiB\n\n",
+                    mystl::size_class_pool().chunk_count(),
+                    mystl::size_class_pool().bytes_reserved() / 1024, bench::peak_rss_kb());
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        if (std::strcmp(argv[1], "growth") == 0)
+        {
+            mystl::size_class_pool().set_chunk_growth(2, mystl::HUGE_PAGE_SIZE * 32);
+            run("geometric growth, malloc");
+        }
+        else if (std::strcmp(argv[1], "huge") == 0)
+        {
+            mystl::size_class_pool().set_chunk_growth(2, mystl::HUGE_PAGE_SIZE * 32);
+            mystl::size_class_pool().set_huge_pages(true);
+            run("geometric growth, huge pages");
+        }
+        else
+        {
+            run("fixed 4 KiB chunks");
+        }
+        return 0;
+    }
+
+    // 分别在子进程中运行三种模式
+    std::fflush(stdout);
+    std::string self = argv[0];
+    std::system((self + " fixed").c_str());
+    std::system((self + " growth").c_str());
+    std::system((self + " huge").c_str());
+    return 0;
+}
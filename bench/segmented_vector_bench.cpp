@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "mystl/vector.hpp"
+#include "mystl/deque.hpp"
+#include "mystl/segmented_vector.hpp"
+#include "bench_util.hpp"
+
+// 只追加的日志：逐条 push_back 1600 万条 32 字节的记录（512 MiB），然后按下标随机读取。
+// vector 扩容时整体搬迁（记录可平凡重定位，大块走 realloc），已有记录的地址随之失效；
+// deque 和 segmented_vector 只分配新块，已有记录不动，地址保持有效。
+// 峰值 RSS 是整个进程的最大值，三种容器分别在子进程中运行。
+
+namespace
+{
+    constexpr size_t kRecords = size_t(16) << 20;
+
+    struct record
+    {
+        uint64_t id;
+        uint64_t timestamp;
+        uint32_t kind;
+        uint32_t length;
+        uint64_t offset;
+    };
+
+    template<class Container>
+    void run(const char* name)
+    {
+        std::printf("[%s]\n", name);
+        Container log;
+        {
+            bench::timer t;
+            for (size_t i = 0; i < kRecords; ++i)
+            {
+                log.push_back(record{i, i * 3, static_cast<uint32_t>(i & 7), 64, i * 64});
+            }
+            bench::do_not_optimize(log.back());
+            bench::report("push_back 16M records", t.elapsed_ms(), static_cast<double>(kRecords));
+        }
+        {
+            bench::timer t;
+            uint64_t sum = 0;
+            size_t x = 1;
+            for (size_t i = 0; i < kRecords; ++i)
+            {
+                x = x * 6364136223846793005ull + 1442695040888963407ull;
+                sum += log[(x >> 20) % kRecords].offset;
+            }
+            bench::do_not_optimize(sum);
+            bench::report("random operator[]", t.elapsed_ms(), static_cast<double>(kRecords));
+        }
+        {
+            bench::timer t;
+            uint64_t sum = 0;
+            for (const record& r : log) sum += r.length;
+            bench::do_not_optimize(sum);
+            bench::report("sequential iteration", t.elapsed_ms(), static_cast<double>(kRecords));
+        }
+        std::printf("peak RSS %ld MiB\n\n", bench::peak_rss_kb() / 1024);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        if (std::strcmp(argv[1], "vector") == 0)
+            run<mystl::vector<record>>("vector");
+        else if (std::strcmp(argv[1], "deque") == 0)
+            run<mystl::deque<record>>("deque");
+        else
+            run<mystl::segmented_vector<record>>("segmented_vector");
+        return 0;
+    }
+
+    // 分别在子进程中运行三种容器
+    std::fflush(stdout);
+    std::string self = argv[0];
+    std::system((self + " vector").c_str());
+    std::system((self + " deque").c_str());
+    std::system((self + " segmented").c_str());
+    return 0;
+}
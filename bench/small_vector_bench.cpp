@@ -0,0 +1,41 @@
+#include <cstdio>
+#include "mystl/vector.hpp"
+#include "mystl/small_vector.hpp"
+#include "bench_util.hpp"
+
+// 小容器：每次请求构造一个只装几个元素的临时容器
+// vector 每次都要向内存池申请和归还一块内存，并经过一次指针间接访问；
+// small_vector<int, 8> 在 8 个元素以内完全使用对象内部的缓冲区
+
+namespace
+{
+    constexpr int kRounds = 5000000;
+
+    template<class Container>
+    void run(const char* name, int elements)
+    {
+        long long sum = 0;
+        bench::timer t;
+        for (int round = 0; round < kRounds; ++round)
+        {
+            Container c;
+            for (int i = 0; i < elements; ++i) c.push_back(round + i);
+            for (int x : c) sum += x;
+        }
+        bench::do_not_optimize(sum);
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, %d elems", name, elements);
+        bench::report(label, t.elapsed_ms(), kRounds);
+    }
+} // namespace
+
+int main()
+{
+    const int sizes[] = {1, 4, 8, 16};
+    for (int n : sizes)
+    {
+        run<mystl::vector<int>>("vector<int>", n);
+        run<mystl::small_vector<int, 8>>("small_vector<int, 8>", n);
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <cstdio>
+#include <cstdint>
+#include "mystl/vector.hpp"
+#include "mystl/soa_vector.hpp"
+#include "mystl/algorithm.hpp"
+#include "bench_util.hpp"
+
+// 列扫描：800 万条 64 字节的记录，只读取其中一两个字段。
+// AoS 的 vector<particle> 每读一个 4 字节字段就要把整条 64 字节的记录带进缓存；
+// soa_vector 每个字段单独连续存放，扫描只读取用到的列，循环也能向量化
+
+namespace
+{
+    constexpr size_t kRecords = size_t(8) << 20;
+    constexpr int kRounds = 10;
+
+    struct particle
+    {
+        double x, y, z;
+        double vx, vy, vz;
+        float mass;
+        uint32_t id;
+        uint64_t flags;
+    };
+
+    using particles = mystl::soa_vector<double, double, double, double, double, double, float, uint32_t, uint64_t>;
+    constexpr size_t MASS = 6;
+    constexpr size_t ID = 7;
+    constexpr size_t X = 0;
+
+    particle make(size_t i)
+    {
+        double d = static_cast<double>(i);
+        return particle{d, d * 2, d * 3, 1, 2, 3, static_cast<float>(i % 100), static_cast<uint32_t>(i * 2654435761u), 0};
+    }
+} // namespace
+
+int main()
+{
+    mystl::vector<particle> aos;
+    particles soa;
+    aos.reserve(kRecords);
+    soa.reserve(kRecords);
+    for (size_t i = 0; i < kRecords; ++i)
+    {
+        particle p = make(i);
+        aos.push_back(p);
+        soa.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id, p.flags);
+    }
+    std::printf("%zu records, %zu bytes each\n\n", kRecords, sizeof(particle));
+
+    {
+        bench::timer t;
+        float total = 0;
+        for (int r = 0; r < kRounds; ++r)
+        {
+            float sum = 0;
+            for (const particle& p : aos) sum += p.mass;
+            total += sum;
+        }
+        bench::do_not_optimize(total);
+        bench::report("AoS sum(mass)", t.elapsed_ms(), static_cast<double>(kRecords) * kRounds);
+    }
+    {
+        bench::timer t;
+        float total = 0;
+        for (int r = 0; r < kRounds; ++r)
+        {
+            float sum = 0;
+            for (float m : soa.column<MASS>()) sum += m;
+            total += sum;
+        }
+        bench::do_not_optimize(total);
+        bench::report("SoA sum(mass)", t.elapsed_ms(), static_cast<double>(kRecords) * kRounds);
+    }
+    {
+        // 按条件过滤一列，累加另一列
+        bench::timer t;
+        double total = 0;
+        for (int r = 0; r < kRounds; ++r)
+        {
+            for (const particle& p : aos)
+            {
+                if (p.mass > 50) total += p.x;
+            }
+        }
+        bench::do_not_optimize(total);
+        bench::report("AoS sum(x) where mass > 50", t.elapsed_ms(), static_cast<double>(kRecords) * kRounds);
+    }
+    {
+        bench::timer t;
+        double total = 0;
+        auto mass = soa.column<MASS>();
+        auto x = soa.column<X>();
+        for (int r = 0; r < kRounds; ++r)
+        {
+            for (size_t i = 0; i < mass.size(); ++i)
+            {
+                total += mass[i] > 50 ? x[i] : 0.0;
+            }
+        }
+        bench::do_not_optimize(total);
+        bench::report("SoA sum(x) where mass > 50", t.elapsed_ms(), static_cast<double>(kRecords) * kRounds);
+    }
+    {
+        // 整行排序：SoA 的每次移动都要写 9 列，比较只读 id 一列
+        constexpr size_t kSort = size_t(1) << 20;
+        mystl::vector<particle> a(aos.begin(), aos.begin() + kSort);
+        particles s;
+        for (size_t i = 0; i < kSort; ++i) s.push_back(soa[i]);
+
+        bench::timer t1;
+        mystl::sort(a.begin(), a.end(), [](const particle& l, const particle& r) { return l.id < r.id; });
+        bench::report("AoS sort 1M rows by id", t1.elapsed_ms(), static_cast<double>(kSort));
+
+        bench::timer t2;
+        mystl::sort(s.begin(), s.end(), [](const auto& l, const auto& r) { return mystl::get<ID>(l) < mystl::get<ID>(r); });
+        bench::report("SoA sort 1M rows by id", t2.elapsed_ms(), static_cast<double>(kSort));
+        bench::do_not_optimize(a.front().id + s.front().get<ID>());
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <cstdio>
+#include "mystl/vector.hpp"
+#include "mystl/string.hpp"
+#include "bench_util.hpp"
+
+// vector 扩容时元素的搬迁方式：向 vector<string> 中 push_back 一千万个字符串
+// 1. 包装类型的移动构造没有声明 noexcept，扩容时只能逐个复制（与原先 reserve 的行为相同）
+// 2. 包装类型的移动构造为 noexcept 但没有选择加入可平凡重定位，扩容时逐个移动
+// 3. mystl::string 可平凡重定位，扩容时整块 memcpy
+
+namespace
+{
+    constexpr int kElements = 10000000;
+
+    // 移动构造可能抛异常：扩容时只能复制
+    struct copy_only_string
+    {
+        mystl::string s;
+        copy_only_string(const char* p) : s(p) {}
+        copy_only_string(const copy_only_string&) = default;
+        copy_only_string(copy_only_string&& other) : s(mystl::move(other.s)) {}
+        copy_only_string& operator=(const copy_only_string&) = default;
+    };
+
+    // 移动构造不抛异常，但没有选择加入可平凡重定位：扩容时逐个移动
+    struct move_only_string
+    {
+        mystl::string s;
+        move_only_string(const char* p) : s(p) {}
+        move_only_string(const move_only_string&) = default;
+        move_only_string(move_only_string&&) noexcept = default;
+        move_only_string& operator=(const move_only_string&) = default;
+        move_only_string& operator=(move_only_string&&) noexcept = default;
+    };
+
+    template<class T>
+    void run(const char* name)
+    {
+        bench::timer t;
+        {
+            mystl::vector<T> v;
+            for (int i = 0; i < kElements; ++i) v.push_back(T("vector growth relocation"));
+            bench::do_not_optimize(v.back());
+        }
+        bench::report(name, t.elapsed_ms(), kElements);
+    }
+} // namespace
+
+int main()
+{
+    static_assert(mystl::is_trivially_relocatable_v<mystl::string>);
+    static_assert(!mystl::is_trivially_relocatable_v<move_only_string>);
+
+    run<copy_only_string>("push_back string, copy on growth");
+    run<move_only_string>("push_back string, move on growth");
+    run<mystl::string>("push_back string, relocate on growth");
+    std::printf("peak RSS %ld KiB\n", bench::peak_rss_kb());
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdio>
+#include <cstring>
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// vector 作为读缓冲区和解码输出：
+// 1. resize(n) 先把 n 个字节清零再被整体覆盖，resize_default_init(n) 省去清零（吞吐按字节计）
+// 2. 逐个 push_back 与 append_uninitialized / append_range 的整块追加
+
+namespace
+{
+    constexpr size_t kBufferBytes = 64 << 20;
+    constexpr int kBufferRounds = 20;
+    constexpr int kChunk = 256;
+    constexpr int kChunks = 200000;
+
+    // 模拟 read：把 src 整体写入 dst
+    void fake_read(unsigned char* dst, const unsigned char* src, size_t n)
+    {
+        std::memcpy(dst, src, n);
+        bench::do_not_optimize(dst[n - 1]);
+    }
+} // namespace
+
+int main()
+{
+    mystl::vector<unsigned char> source(kBufferBytes, 0x5a);
+
+    {
+        bench::timer t;
+        for (int round = 0; round < kBufferRounds; ++round)
+        {
+            mystl::vector<unsigned char> buf;
+            buf.resize(kBufferBytes);
+            fake_read(buf.data(), source.data(), kBufferBytes);
+        }
+        bench::report("resize + read 64 MiB", t.elapsed_ms(), static_cast<double>(kBufferBytes) * kBufferRounds);
+    }
+    {
+        bench::timer t;
+        for (int round = 0; round < kBufferRounds; ++round)
+        {
+            mystl::vector<unsigned char> buf;
+            buf.resize_default_init(kBufferBytes);
+            fake_read(buf.data(), source.data(), kBufferBytes);
+        }
+        bench::report("resize_default_init + read 64 MiB", t.elapsed_ms(), static_cast<double>(kBufferBytes) * kBufferRounds);
+    }
+
+    int chunk[kChunk];
+    for (int i = 0; i < kChunk; ++i) chunk[i] = i;
+    const double ints = static_cast<double>(kChunk) * kChunks;
+    {
+        bench::timer t;
+        mystl::vector<int> out;
+        for (int c = 0; c < kChunks; ++c)
+            for (int i = 0; i < kChunk; ++i) out.push_back(chunk[i]);
+        bench::do_not_optimize(out.back());
+        bench::report("push_back 256-int chunks", t.elapsed_ms(), ints);
+    }
+    {
+        bench::timer t;
+        mystl::vector<int> out;
+        for (int c = 0; c < kChunks; ++c) out.append_range(chunk, chunk + kChunk);
+        bench::do_not_optimize(out.back());
+        bench::report("append_range 256-int chunks", t.elapsed_ms(), ints);
+    }
+    {
+        bench::timer t;
+        mystl::vector<int> out;
+        for (int c = 0; c < kChunks; ++c)
+            std::memcpy(out.append_uninitialized(kChunk), chunk, sizeof(chunk));
+        bench::do_not_optimize(out.back());
+        bench::report("append_uninitialized + memcpy chunks", t.elapsed_ms(), ints);
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "mystl/vector.hpp"
+#include "bench_util.hpp"
+
+// 平凡可复制元素的大缓冲区扩容：realloc / mremap 原地扩展与“分配新块 + 复制 + 释放旧块”的对比。
+// vector<int> 逐个 push_back 到 1 GiB，再从 1 MiB 起每次 reserve 两倍直到 1 GiB。
+// copy 模式使用不提供 reallocate 的分配器，vector 只能走原来的复制路径。
+// 峰值 RSS 是整个进程的最大值，两种模式分别在子进程中运行。
+
+namespace
+{
+    constexpr size_t kBytes = size_t(1) << 30;
+    constexpr size_t kElements = kBytes / sizeof(int);
+
+    // 转发到 mystl::allocator，但不提供 reallocate
+    template<class T>
+    struct copy_only_allocator
+    {
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        T* allocate(size_t n) { return mystl::allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) noexcept { mystl::allocator<T>().deallocate(p, n); }
+        size_t max_size() const noexcept { return mystl::allocator<T>().max_size(); }
+        bool operator==(const copy_only_allocator&) const noexcept { return true; }
+        bool operator!=(const copy_only_allocator&) const noexcept { return false; }
+    };
+
+    template<class Alloc>
+    void run(const char* name)
+    {
+        std::printf("[%s]\n", name);
+        {
+            bench::timer t;
+            mystl::vector<int, Alloc> v;
+            for (size_t i = 0; i < kElements; ++i) v.push_back(static_cast<int>(i));
+            bench::do_not_optimize(v.back());
+            bench::report("vector<int> push_back to 1 GiB", t.elapsed_ms(), static_cast<double>(kElements));
+        }
+        {
+            // 每次只写新增部分，耗时主要是扩容本身
+            bench::timer t;
+            mystl::vector<int, Alloc> v;
+            size_t count = 0;
+            for (size_t n = (size_t(1) << 20) / sizeof(int); n <= kElements; n *= 2)
+            {
+                v.reserve(n);
+                v.resize_default_init(n);
+                std::memset(v.data() + count, 1, (n - count) * sizeof(int));
+                count = n;
+            }
+            bench::do_not_optimize(v.back());
+            bench::report("reserve x2 from 1 MiB to 1 GiB", t.elapsed_ms(), static_cast<double>(kElements));
+        }
+        std::printf("peak RSS %ld MiB\n\n", bench::peak_rss_kb() / 1024);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        if (std::strcmp(argv[1], "copy") == 0)
+            run<copy_only_allocator<int>>("allocate + copy + free");
+        else
+            run<mystl::allocator<int>>("realloc in place");
+        return 0;
+    }
+
+    // 分别在子进程中运行两种模式
+    std::fflush(stdout);
+    std::string self = argv[0];
+    std::system((self + " copy").c_str());
+    std::system((self + " realloc").c_str());
+    return 0;
+}
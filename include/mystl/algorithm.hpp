@@ -748,7 +748,7 @@ namespace mystl
         
         for (auto i = first + 1; i != last; ++i)
         {
-            auto key = mystl::move(*i);
+            typename iterator_traits<RandomIt>::value_type key = mystl::move(*i);
             auto j = i;
             
             for (; j != first && comp(key, *(j - 1)); --j)
@@ -863,17 +863,19 @@ namespace mystl
     {
         if (first >= last) return;
         
-        auto pivot = mystl::move(*first);
+        typename iterator_traits<RandomIt>::value_type pivot = mystl::move(*first);
         auto i = first;
         auto j = last - 1;
         
         while (i < j)
         {
-            while (i < j && !comp(pivot, *j)) --j;
-            if (i < j) *i = mystl::move(*j);
+            // 从右向左找小于基准的元素填到左边的空位
+            while (i < j && !comp(*j, pivot)) --j;
+            if (i < j) *i++ = mystl::move(*j);
             
+            // 从左向右找不小于基准的元素填到右边的空位
             while (i < j && comp(*i, pivot)) ++i;
-            if (i < j) *j = mystl::move(*i);
+            if (i < j) *j-- = mystl::move(*i);
         }
         *i = mystl::move(pivot);
         
@@ -912,7 +914,7 @@ namespace mystl
                  typename iterator_traits<RandomIt>::difference_type topIndex,
                  Compare comp)
     {
-        auto value = mystl::move(*(first + holeIndex));
+        typename iterator_traits<RandomIt>::value_type value = mystl::move(*(first + holeIndex));
         while (holeIndex > topIndex && comp(*(first + (holeIndex - 1) / 2), value))
         {
             *(first + holeIndex) = mystl::move(*(first + (holeIndex - 1) / 2));
@@ -928,9 +930,9 @@ namespace mystl
                    typename iterator_traits<RandomIt>::difference_type len,
                    Compare comp)
     {
-        auto value = mystl::move(*(first + holeIndex));
+        typename iterator_traits<RandomIt>::value_type value = mystl::move(*(first + holeIndex));
         typename iterator_traits<RandomIt>::difference_type child;
-        while (holeIndex < (len - 1) / 2)
+        while (2 * holeIndex + 1 < len)
         {
             child = 2 * holeIndex + 1;
             if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
@@ -1033,7 +1035,7 @@ namespace mystl
             // 对每个子序列进行插入排序
             for (auto i = first + gap; i != last; ++i)
             {
-                auto temp = mystl::move(*i);
+                typename iterator_traits<RandomIt>::value_type temp = mystl::move(*i);
                 auto j = i;
                 
                 for (; j >= first + gap && comp(temp, *(j - gap)); j -= gap)
@@ -1073,17 +1075,19 @@ namespace mystl
         }
         
         // 否则使用快速排序
-        auto pivot = mystl::move(*first);
+        typename iterator_traits<RandomIt>::value_type pivot = mystl::move(*first);
         auto i = first;
         auto j = last - 1;
         
         while (i < j)
         {
-            while (i < j && !comp(pivot, *j)) --j;
-            if (i < j) *i = mystl::move(*j);
+            // 从右向左找小于基准的元素填到左边的空位
+            while (i < j && !comp(*j, pivot)) --j;
+            if (i < j) *i++ = mystl::move(*j);
             
+            // 从左向右找不小于基准的元素填到右边的空位
             while (i < j && comp(*i, pivot)) ++i;
-            if (i < j) *j = mystl::move(*i);
+            if (i < j) *j-- = mystl::move(*i);
         }
         *i = mystl::move(pivot);
         
@@ -1241,7 +1245,7 @@ namespace mystl
     template<class ForwardIt, class T>
     ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& value)
     {
-        return lower_bound(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
+        return mystl::lower_bound(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
     }
 
 
@@ -1277,7 +1281,7 @@ namespace mystl
     template<class ForwardIt, class T>
     ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& value)
     {
-        return upper_bound(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
+        return mystl::upper_bound(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
     }
 
 
@@ -1295,7 +1299,7 @@ namespace mystl
     template<class ForwardIt, class T>
     bool binary_search(ForwardIt first, ForwardIt last, const T& value)
     {
-        return binary_search(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
+        return mystl::binary_search(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
     }
 
 
@@ -1316,7 +1320,7 @@ namespace mystl
     mystl::pair<ForwardIt, ForwardIt> 
     equal_range(ForwardIt first, ForwardIt last, const T& value)
     {
-        return equal_range(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
+        return mystl::equal_range(first, last, value, mystl::less<typename iterator_traits<ForwardIt>::value_type>());
     }
 
 
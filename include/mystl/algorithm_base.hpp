@@ -201,6 +201,92 @@ namespace mystl
 
 
 
+    /*****************************************************************************************/
+    // 分块迭代器的拆分
+    // 把分块区间（如 deque 的迭代器区间）拆成每块内的原生指针区间，逐块调用 op(local_first, local_last, result)，
+    // 块内的调用再按原生指针分派到 memmove。按输入拆分时 op 的返回值作为下一块的 result
+    /*****************************************************************************************/
+    // 按输入区间拆分，从前往后
+    template<class SegIt, class OutputIt, class Op>
+    OutputIt segmented_input_forward(SegIt first, SegIt last, OutputIt result, Op op)
+    {
+        using traits = segmented_iterator_traits<SegIt>;
+        auto sfirst = traits::segment(first);
+        auto slast = traits::segment(last);
+        if (sfirst == slast)
+        {
+            return op(traits::local(first), traits::local(last), result);
+        }
+        result = op(traits::local(first), traits::end(sfirst), result);
+        for (++sfirst; sfirst != slast; ++sfirst)
+        {
+            result = op(traits::begin(sfirst), traits::end(sfirst), result);
+        }
+        return op(traits::begin(slast), traits::local(last), result);
+    }
+
+    // 按输入区间拆分，从后往前，result 为目标区间的尾后位置
+    template<class SegIt, class BidirIt, class Op>
+    BidirIt segmented_input_backward(SegIt first, SegIt last, BidirIt result, Op op)
+    {
+        using traits = segmented_iterator_traits<SegIt>;
+        auto sfirst = traits::segment(first);
+        auto slast = traits::segment(last);
+        if (sfirst == slast)
+        {
+            return op(traits::local(first), traits::local(last), result);
+        }
+        result = op(traits::begin(slast), traits::local(last), result);
+        for (--slast; slast != sfirst; --slast)
+        {
+            result = op(traits::begin(slast), traits::end(slast), result);
+        }
+        return op(traits::local(first), traits::end(sfirst), result);
+    }
+
+    // 按输出区间拆分，从前往后：每次取目标块剩余空间与剩余元素中较少的一段
+    template<class RandomIt, class SegIt, class Op>
+    SegIt segmented_output_forward(RandomIt first, RandomIt last, SegIt result, Op op)
+    {
+        using traits = segmented_iterator_traits<SegIt>;
+        using Distance = typename iterator_traits<RandomIt>::difference_type;
+        while (first != last)
+        {
+            auto dest = traits::local(result);
+            const Distance room = traits::end(traits::segment(result)) - dest;
+            const Distance n = last - first < room ? last - first : room;
+            op(first, first + n, dest);
+            first += n;
+            result += n;
+        }
+        return result;
+    }
+
+    // 按输出区间拆分，从后往前，result 为目标区间的尾后位置；它位于块首时这一段写入前一块
+    template<class RandomIt, class SegIt, class Op>
+    SegIt segmented_output_backward(RandomIt first, RandomIt last, SegIt result, Op op)
+    {
+        using traits = segmented_iterator_traits<SegIt>;
+        using Distance = typename iterator_traits<RandomIt>::difference_type;
+        while (first != last)
+        {
+            auto seg = traits::segment(result);
+            auto dest = traits::local(result);
+            if (dest == traits::begin(seg))
+            {
+                --seg;
+                dest = traits::end(seg);
+            }
+            const Distance room = dest - traits::begin(seg);
+            const Distance n = last - first < room ? last - first : room;
+            op(last - n, last, dest);
+            last -= n;
+            result -= n;
+        }
+        return result;
+    }
+
+
     /*****************************************************************************************/
     // copy
     // 把 [first, last)区间内的元素拷贝到 [result, result + (last - first))内
@@ -233,19 +319,32 @@ namespace mystl
     template<class InputIt, class OutputIt>
     OutputIt copy(InputIt first, InputIt last, OutputIt result)
     {
-        using input_category = typename iterator_traits<InputIt>::iterator_category;
-        using output_category = typename iterator_traits<OutputIt>::iterator_category;
-        using value_type = typename iterator_traits<InputIt>::value_type;
+        // 分块迭代器按块拆分后逐块复制
+        if constexpr (is_segmented_iterator_v<InputIt>)
+        {
+            return segmented_input_forward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::copy(f, l, r); });
+        }
+        else if constexpr (is_segmented_iterator_v<OutputIt> && is_random_access_iterator_v<InputIt>)
+        {
+            return segmented_output_forward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::copy(f, l, r); });
+        }
+        else
+        {
+            using value_type = typename iterator_traits<InputIt>::value_type;
         
-        // 只有当输入和输出都是随机访问迭代器，且类型可平凡复制时才使用 memmove
-        //使用memmove不使用memcpy，因为memcpy无法处理重叠的内存区域、
-        //符合is_trivially_copy_assignable_v的类型都符合is_trivially_move_assignable_v
-        constexpr bool can_use_memmove = 
-            is_same_v<input_category, random_access_iterator_tag> &&
-            is_same_v<output_category, random_access_iterator_tag> &&
-            is_trivially_copy_assignable_v<value_type>;
+            // 只有当输入和输出都是连续迭代器、元素类型相同且可平凡复制时才使用 memmove
+            //使用memmove不使用memcpy，因为memcpy无法处理重叠的内存区域、
+            //符合is_trivially_copy_assignable_v的类型都符合is_trivially_move_assignable_v
+            constexpr bool can_use_memmove = 
+                is_contiguous_iterator_v<InputIt> &&
+                is_contiguous_iterator_v<OutputIt> &&
+                is_trivially_copy_assignable_v<value_type> &&
+                is_same_v<remove_cv_t<value_type>, remove_cv_t<typename iterator_traits<OutputIt>::value_type>>;
         
-        return copy_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+            return copy_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+        }
     }
 
 
@@ -278,16 +377,28 @@ namespace mystl
     template<class BidirIt1, class BidirIt2>
     BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 result)
     {
-        using input_category = typename iterator_traits<BidirIt1>::iterator_category;
-        using output_category = typename iterator_traits<BidirIt2>::iterator_category;
-        using value_type = typename iterator_traits<BidirIt1>::value_type;
+        if constexpr (is_segmented_iterator_v<BidirIt1>)
+        {
+            return segmented_input_backward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::copy_backward(f, l, r); });
+        }
+        else if constexpr (is_segmented_iterator_v<BidirIt2> && is_random_access_iterator_v<BidirIt1>)
+        {
+            return segmented_output_backward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::copy_backward(f, l, r); });
+        }
+        else
+        {
+            using value_type = typename iterator_traits<BidirIt1>::value_type;
         
-        constexpr bool can_use_memmove = 
-            is_same_v<input_category, random_access_iterator_tag> &&
-            is_same_v<output_category, random_access_iterator_tag> &&
-            is_trivially_copy_assignable_v<value_type>;
+            constexpr bool can_use_memmove = 
+                is_contiguous_iterator_v<BidirIt1> &&
+                is_contiguous_iterator_v<BidirIt2> &&
+                is_trivially_copy_assignable_v<value_type> &&
+                is_same_v<remove_cv_t<value_type>, remove_cv_t<typename iterator_traits<BidirIt2>::value_type>>;
         
-        return copy_backward_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+            return copy_backward_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+        }
     }
 
 
@@ -320,7 +431,7 @@ namespace mystl
     {
         if (count > 0)
         {
-            std::memmove(result.base(), first.base(), count * sizeof(*first.base()));
+            std::memmove(iterator_base(result), iterator_base(first), count * sizeof(*iterator_base(first)));
             return result + count;
         }
         return result;
@@ -339,16 +450,24 @@ namespace mystl
     template<class InputIt, class Size, class OutputIt>
     OutputIt copy_n(InputIt first, Size count, OutputIt result)
     {
-        using input_category = typename iterator_traits<InputIt>::iterator_category;
-        using output_category = typename iterator_traits<OutputIt>::iterator_category;
-        using value_type = typename iterator_traits<InputIt>::value_type;
+        // 涉及分块迭代器时转为区间复制，由 copy 按块拆分
+        if constexpr ((is_segmented_iterator_v<InputIt> || is_segmented_iterator_v<OutputIt>) &&
+                      is_random_access_iterator_v<InputIt>)
+        {
+            return count > 0 ? mystl::copy(first, first + count, result) : result;
+        }
+        else
+        {
+            using value_type = typename iterator_traits<InputIt>::value_type;
         
-        constexpr bool can_use_memmove = 
-            is_same_v<input_category, random_access_iterator_tag> &&
-            is_same_v<output_category, random_access_iterator_tag> &&
-            is_trivially_copy_assignable_v<value_type>;
+            constexpr bool can_use_memmove = 
+                is_contiguous_iterator_v<InputIt> &&
+                is_contiguous_iterator_v<OutputIt> &&
+                is_trivially_copy_assignable_v<value_type> &&
+                is_same_v<remove_cv_t<value_type>, remove_cv_t<typename iterator_traits<OutputIt>::value_type>>;
         
-        return copy_n_dispatch(first, count, result, bool_constant<can_use_memmove>{});
+            return copy_n_dispatch(first, count, result, bool_constant<can_use_memmove>{});
+        }
     }
 
 
@@ -384,16 +503,28 @@ namespace mystl
     template<class InputIt, class OutputIt>
     OutputIt move(InputIt first, InputIt last, OutputIt result)
     {
-        using input_category = typename iterator_traits<InputIt>::iterator_category;
-        using output_category = typename iterator_traits<OutputIt>::iterator_category;
-        using value_type = typename iterator_traits<InputIt>::value_type;
+        if constexpr (is_segmented_iterator_v<InputIt>)
+        {
+            return segmented_input_forward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::move(f, l, r); });
+        }
+        else if constexpr (is_segmented_iterator_v<OutputIt> && is_random_access_iterator_v<InputIt>)
+        {
+            return segmented_output_forward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::move(f, l, r); });
+        }
+        else
+        {
+            using value_type = typename iterator_traits<InputIt>::value_type;
         
-        constexpr bool can_use_memmove = 
-            is_same_v<input_category, random_access_iterator_tag> &&
-            is_same_v<output_category, random_access_iterator_tag> &&
-            is_trivially_move_assignable_v<value_type>;
+            constexpr bool can_use_memmove = 
+                is_contiguous_iterator_v<InputIt> &&
+                is_contiguous_iterator_v<OutputIt> &&
+                is_trivially_move_assignable_v<value_type> &&
+                is_same_v<remove_cv_t<value_type>, remove_cv_t<typename iterator_traits<OutputIt>::value_type>>;
         
-        return move_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+            return move_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+        }
     }
 
 
@@ -426,16 +557,28 @@ namespace mystl
     template<class BidirIt1, class BidirIt2>
     BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 result)
     {
-        using input_category = typename iterator_traits<BidirIt1>::iterator_category;
-        using output_category = typename iterator_traits<BidirIt2>::iterator_category;
-        using value_type = typename iterator_traits<BidirIt1>::value_type;
+        if constexpr (is_segmented_iterator_v<BidirIt1>)
+        {
+            return segmented_input_backward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::move_backward(f, l, r); });
+        }
+        else if constexpr (is_segmented_iterator_v<BidirIt2> && is_random_access_iterator_v<BidirIt1>)
+        {
+            return segmented_output_backward(first, last, result,
+                [](auto f, auto l, auto r) { return mystl::move_backward(f, l, r); });
+        }
+        else
+        {
+            using value_type = typename iterator_traits<BidirIt1>::value_type;
         
-        constexpr bool can_use_memmove = 
-            is_same_v<input_category, random_access_iterator_tag> &&
-            is_same_v<output_category, random_access_iterator_tag> &&
-            is_trivially_move_assignable_v<value_type>;
+            constexpr bool can_use_memmove = 
+                is_contiguous_iterator_v<BidirIt1> &&
+                is_contiguous_iterator_v<BidirIt2> &&
+                is_trivially_move_assignable_v<value_type> &&
+                is_same_v<remove_cv_t<value_type>, remove_cv_t<typename iterator_traits<BidirIt2>::value_type>>;
         
-        return move_backward_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+            return move_backward_dispatch(first, last, result, bool_constant<can_use_memmove>{});
+        }
     }
 
 
@@ -444,9 +587,9 @@ namespace mystl
     // fill
     // 为 [first, last)区间内的所有元素填充新值
     /*****************************************************************************************/
-    // 单字节类型的特化版本
+    // 单字节类型且迭代器连续时的特化版本
     template<class ForwardIt, class T>
-    typename enable_if<is_byte_type<T>::value>::type
+    typename enable_if<is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>>::type
     fill(ForwardIt first, ForwardIt last, const T& value)
     {
         unsigned char tmp = static_cast<unsigned char>(value);
@@ -455,12 +598,33 @@ namespace mystl
 
     // 一般类型的实现
     template<class ForwardIt, class T>
-    typename enable_if<!is_byte_type<T>::value>::type
+    typename enable_if<!(is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>)>::type
     fill(ForwardIt first, ForwardIt last, const T& value)
     {
-        for (; first != last; ++first)
+        if constexpr (is_segmented_iterator_v<ForwardIt>)
+        {
+            // 分块迭代器逐块填充，块内是原生指针，单字节类型走 memset
+            using traits = segmented_iterator_traits<ForwardIt>;
+            auto sfirst = traits::segment(first);
+            auto slast = traits::segment(last);
+            if (sfirst == slast)
+            {
+                mystl::fill(traits::local(first), traits::local(last), value);
+                return;
+            }
+            mystl::fill(traits::local(first), traits::end(sfirst), value);
+            for (++sfirst; sfirst != slast; ++sfirst)
+            {
+                mystl::fill(traits::begin(sfirst), traits::end(sfirst), value);
+            }
+            mystl::fill(traits::begin(slast), traits::local(last), value);
+        }
+        else
         {
-            *first = value;
+            for (; first != last; ++first)
+            {
+                *first = value;
+            }
         }
     }
 
@@ -469,9 +633,9 @@ namespace mystl
     // fill_n
     // 从 first 位置开始填充 n 个值
     /*****************************************************************************************/
-    // 单字节类型的特化版本
+    // 单字节类型且迭代器连续时的特化版本
     template<class OutputIt, class Size, class T>
-    typename enable_if<is_byte_type<T>::value, OutputIt>::type
+    typename enable_if<is_byte_type<T>::value && is_contiguous_iterator_v<OutputIt>, OutputIt>::type
     fill_n(OutputIt first, Size count, const T& value)
     {
         if (count > 0)
@@ -484,14 +648,27 @@ namespace mystl
 
     // 一般类型的实现
     template<class OutputIt, class Size, class T>
-    typename enable_if<!is_byte_type<T>::value, OutputIt>::type
+    typename enable_if<!(is_byte_type<T>::value && is_contiguous_iterator_v<OutputIt>), OutputIt>::type
     fill_n(OutputIt first, Size count, const T& value)
     {
-        for (; count > 0; --count, ++first)
+        if constexpr (is_segmented_iterator_v<OutputIt>)
+        {
+            if (count <= 0)
+            {
+                return first;
+            }
+            OutputIt last = first + count;
+            mystl::fill(first, last, value);
+            return last;
+        }
+        else
         {
-            *first = value;
+            for (; count > 0; --count, ++first)
+            {
+                *first = value;
+            }
+            return first;
         }
-        return first;
     }
 
 
@@ -499,11 +676,22 @@ namespace mystl
     /*****************************************************************************************/
     // iter_swap
     // 将两个迭代器所指对象对调
+    // 解引用得到代理对象（如 soa_vector、dynamic_bitset 的迭代器）时经 value_type 的临时对象三次赋值
     /*****************************************************************************************/
     template<class ForwardIt1, class ForwardIt2>
     void iter_swap(ForwardIt1 a, ForwardIt2 b) 
     {
-        mystl::swap(*a, *b);
+        if constexpr (is_lvalue_reference_v<typename iterator_traits<ForwardIt1>::reference> &&
+                      is_lvalue_reference_v<typename iterator_traits<ForwardIt2>::reference>)
+        {
+            mystl::swap(*a, *b);
+        }
+        else
+        {
+            typename iterator_traits<ForwardIt1>::value_type tmp = mystl::move(*a);
+            *a = mystl::move(*b);
+            *b = mystl::move(tmp);
+        }
     }
 
     
@@ -2,7 +2,23 @@
 
 #include <cstdlib>  // for malloc, free
 #include <cstdint>  // for uintptr_t
+#include <cstring>  // for memcpy
 #include <new>      // for bad_alloc
+#include <mutex>    // for mutex, lock_guard
+#include <atomic>   // for atomic
+#include <ostream>  // for ostream
+#include <typeinfo> // for typeid
+#if defined(__GNUG__)
+#include <cxxabi.h> // for __cxa_demangle
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h> // for malloc_trim
+#elif defined(_WIN32)
+#include <malloc.h> // for _aligned_malloc
+#endif
+#if defined(__linux__)
+#include <sys/mman.h> // for mmap, madvise
+#endif
 #include "expectdef.hpp"
 #include "util.hpp"
 #include "algorithm.hpp"
@@ -17,6 +33,170 @@ namespace mystl
     };
 
 
+    // 按任意对齐要求（2 的幂）直接向系统申请内存，须用 aligned_free 释放
+    inline void* aligned_malloc(size_t bytes, size_t align) 
+    {
+#if defined(_WIN32)
+        void* p = ::_aligned_malloc(bytes, align);
+#else
+        // aligned_alloc 要求大小是对齐值的整数倍
+        void* p = std::aligned_alloc(align, (bytes + align - 1) & ~(align - 1));
+#endif
+        if (!p) throw std::bad_alloc();
+        return p;
+    }
+
+    inline void aligned_free(void* p) noexcept 
+    {
+#if defined(_WIN32)
+        ::_aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+    // 把 malloc / aligned_malloc 得到的大块调整为 new_bytes，内容保留到新旧大小中较小者。
+    // glibc 对 mmap 的大块使用 mremap，只改页表不复制数据；失败时抛出 bad_alloc，原内存不变。
+    // aligned 为 true 时 p 来自 aligned_malloc：realloc 的结果不满足 align 时再复制到新的对齐内存，
+    // 这一步分配失败则保留未对齐的结果，因此只能用于 align 仅是性能偏好（不影响正确性）的场合
+    inline void* system_realloc(void* p, size_t new_bytes, bool aligned, size_t align)
+    {
+#if defined(_WIN32)
+        void* q = aligned ? ::_aligned_realloc(p, new_bytes, align) : std::realloc(p, new_bytes);
+        if (!q) throw std::bad_alloc();
+        return q;
+#else
+        if (aligned) new_bytes = (new_bytes + align - 1) & ~(align - 1);
+        void* q = std::realloc(p, new_bytes);
+        if (!q) throw std::bad_alloc();
+        if (!aligned || reinterpret_cast<std::uintptr_t>(q) % align == 0) return q;
+        void* r = std::aligned_alloc(align, new_bytes);
+        if (!r) return q;
+        std::memcpy(r, q, new_bytes);
+        std::free(q);
+        return r;
+#endif
+    }
+
+
+    // 透明大页的大小（x86-64 / AArch64 的 2 MiB 页）
+    constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+    // 用 mmap 申请按 HUGE_PAGE_SIZE 对齐的匿名内存，并建议内核使用透明大页
+    // bytes 须为 HUGE_PAGE_SIZE 的整数倍；不支持或失败时返回 nullptr，由调用者退回 malloc
+    inline void* huge_page_alloc(size_t bytes) noexcept 
+    {
+#if defined(__linux__)
+        // 多映射一页，裁掉首尾得到对齐的区间，内核才能用大页映射整个区间
+        size_t length = bytes + HUGE_PAGE_SIZE;
+        void* p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return nullptr;
+
+        auto addr = reinterpret_cast<std::uintptr_t>(p);
+        auto aligned = (addr + HUGE_PAGE_SIZE - 1) & ~std::uintptr_t(HUGE_PAGE_SIZE - 1);
+        size_t head = aligned - addr;
+        size_t tail = length - head - bytes;
+        if (head) ::munmap(p, head);
+        if (tail) ::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+#if defined(MADV_HUGEPAGE)
+        ::madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);  // 只是建议，失败不影响使用
+#endif
+        return reinterpret_cast<void*>(aligned);
+#else
+        (void)bytes;
+        return nullptr;
+#endif
+    }
+
+    // 释放 huge_page_alloc 申请的内存，bytes 须与申请时一致
+    inline void huge_page_free(void* p, size_t bytes) noexcept 
+    {
+#if defined(__linux__)
+        ::munmap(p, bytes);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+
+
+    //------------------------------------------------------------------------------
+    // 内存池统计：定义 MYSTL_POOL_STATS 后才会在热路径上计数，否则计数代码完全不生成
+    // 该宏必须在所有翻译单元中保持一致
+    //------------------------------------------------------------------------------
+#ifdef MYSTL_POOL_STATS
+    #define MYSTL_POOL_STAT(expr) (expr)
+#else
+    #define MYSTL_POOL_STAT(expr) ((void)0)
+#endif
+
+    // 单个尺寸等级的统计
+    struct size_class_stats 
+    {
+        size_t size{0};              // 尺寸等级（字节），0 表示超过 MAX_BYTES 的大对象
+        size_t allocations{0};       // 分配次数
+        size_t frees{0};             // 释放次数
+        size_t free_list_hits{0};    // 直接从空闲列表取到的次数
+        size_t chunk_carves{0};      // 从大块内存切分的次数
+        size_t malloc_fallbacks{0};  // 直接使用 malloc 的次数
+        size_t bytes_live{0};        // 已分配未释放的字节数
+        size_t bytes_reserved{0};    // 为该尺寸等级从大块内存切分出的字节数
+    };
+
+    // 输出一个尺寸等级的统计，文本格式
+    inline void dump_size_class_text(std::ostream& os, const size_class_stats& s) 
+    {
+        if (s.size) os << s.size; else os << "large";
+        os << "\tallocs=" << s.allocations << " frees=" << s.frees
+           << " hits=" << s.free_list_hits << " carves=" << s.chunk_carves
+           << " malloc=" << s.malloc_fallbacks << " live=" << s.bytes_live
+           << " reserved=" << s.bytes_reserved << '\n';
+    }
+
+    // 输出一个尺寸等级的统计，JSON 格式
+    inline void dump_size_class_json(std::ostream& os, const size_class_stats& s) 
+    {
+        os << "{\"size\":" << s.size << ",\"allocations\":" << s.allocations
+           << ",\"frees\":" << s.frees << ",\"free_list_hits\":" << s.free_list_hits
+           << ",\"chunk_carves\":" << s.chunk_carves << ",\"malloc_fallbacks\":" << s.malloc_fallbacks
+           << ",\"bytes_live\":" << s.bytes_live << ",\"bytes_reserved\":" << s.bytes_reserved << '}';
+    }
+
+    // 内存池统计快照
+    template<size_t NumClasses>
+    struct pool_stats 
+    {
+        size_class_stats classes[NumClasses];  // 各尺寸等级，按尺寸递增
+        size_class_stats large;                // 超过 MAX_BYTES 的大对象
+        size_t chunk_count{0};                 // 持有的大块内存数量
+        size_t bytes_reserved{0};              // 持有的大块内存总字节数
+
+        void dump_text(std::ostream& os) const 
+        {
+            os << "chunks=" << chunk_count << " reserved=" << bytes_reserved << '\n';
+            for (const auto& c : classes) 
+            {
+                if (c.allocations || c.bytes_reserved) dump_size_class_text(os, c);
+            }
+            if (large.allocations) dump_size_class_text(os, large);
+        }
+
+        void dump_json(std::ostream& os) const 
+        {
+            os << "{\"chunk_count\":" << chunk_count << ",\"bytes_reserved\":" << bytes_reserved
+               << ",\"size_classes\":[";
+            for (size_t i = 0; i < NumClasses; ++i) 
+            {
+                if (i) os << ',';
+                dump_size_class_json(os, classes[i]);
+            }
+            os << "],\"large\":";
+            dump_size_class_json(os, large);
+            os << '}';
+        }
+    };
+
+
     //------------------------------------------------------------------------------
     // 内存池实现：为特定类型T提供内存分配和管理
     //------------------------------------------------------------------------------
@@ -24,51 +204,188 @@ namespace mystl
     class MemoryPool 
     {
     private:
-        // 管理大块内存的结构：跟踪所有分配的内存块
+        // 大块内存头部：直接存放在每个大块内存的起始处，不再单独分配记录
         struct MemoryChunk 
         {
-            char* memory;       // 实际内存块的起始地址
             MemoryChunk* next;  // 链表结构，指向下一个大块内存
+            size_t size;        // 可切分的字节数，不含头部
+            size_t used;        // 已切分出去的字节数，仅在切换到新块时更新
+            size_t mapped;      // 由 huge_page_alloc 映射的总字节数，0 表示来自 malloc
         };
 
+        // 回收扫描时使用的临时记录
+        struct ChunkUsage 
+        {
+            char* begin;        // 大块内存的可用起始地址（释放后仍用于查找，不能再访问 MemoryChunk）
+            size_t size;        // 可切分的字节数
+            size_t used;        // 已切分出去的字节数
+            size_t free_bytes;  // 位于空闲列表中的字节数
+        };
+
+    public:
         // 常量定义
-        static constexpr size_t NUM_FREE_LISTS = 16;  // 空闲列表数量，管理不同大小的内存块
         static constexpr size_t ALIGN = alignof(max_align_t);  // 内存对齐要求
         static constexpr size_t BLOCK_SIZE = BlockSize;  // 每次分配的大块内存大小
         static constexpr size_t MAX_BYTES = 256;  // 小对象的阈值，超过此大小直接使用malloc
+        static constexpr size_t NUM_FREE_LISTS = MAX_BYTES / ALIGN;  // 空闲列表数量，每个ALIGN的倍数对应一个列表
+        static constexpr size_t CACHE_LINE_SIZE = 64;  // 缓存行大小，对齐要求不超过它的小对象使用缓存行尺寸等级
+        static constexpr size_t MAX_ALIGN = 4096;      // 保证支持的最大对齐要求（页大小），更大的对齐同样可用
+        static constexpr size_t NUM_CACHE_LINE_LISTS = MAX_BYTES / CACHE_LINE_SIZE;  // 缓存行尺寸等级的空闲列表数量
+        static constexpr size_t CHUNK_HEADER = (sizeof(MemoryChunk) + ALIGN - 1) & ~(ALIGN - 1);  // 大块内存头部占用的字节数
 
+    private:
         // 成员变量
         MemoryBlock* free_lists[NUM_FREE_LISTS]{};  // 空闲列表数组，每个列表管理特定大小的块
+        MemoryBlock* cache_line_lists[NUM_CACHE_LINE_LISTS]{};  // 按缓存行对齐的空闲列表，尺寸为 CACHE_LINE_SIZE 的倍数
         MemoryChunk* chunks{nullptr};  // 已分配的大块内存链表
         char* memory_chunk{nullptr};   // 当前正在使用的内存块指针
         size_t chunk_size{0};          // 当前内存块剩余大小
+        size_t free_bytes_{0};         // 空闲列表中的总字节数
+        size_t trim_threshold_{0};     // 自动回收阈值，0 表示不自动回收
+        size_t next_trim_at_{0};       // 下一次自动回收的触发点
+        size_t next_chunk_size_{BLOCK_SIZE};  // 下一个大块内存的可切分字节数
+        size_t growth_factor_{1};             // 大块内存的几何增长倍数，1 表示固定为 BLOCK_SIZE
+        size_t max_chunk_size_{BLOCK_SIZE};   // 几何增长的上限
+        bool huge_pages_{false};              // 是否用 mmap + MADV_HUGEPAGE 申请大块内存
+#ifdef MYSTL_POOL_STATS
+        size_class_stats stats_[NUM_FREE_LISTS];  // 各尺寸等级的统计
+        size_class_stats large_stats_;            // 大对象的统计
+#endif
 
+    public:
         // 工具函数：计算对齐后的大小
         static size_t align_up(size_t n) noexcept 
         {
             return (n + ALIGN - 1) & ~(ALIGN - 1);  // 向上取整到ALIGN的倍数
         }
 
-        // 工具函数：计算合适的空闲列表索引
+        // 工具函数：计算合适的空闲列表索引，bytes 须已按 ALIGN 对齐
         static size_t free_list_index(size_t bytes) noexcept 
         {
-            return (bytes + sizeof(MemoryBlock) - 1) / sizeof(MemoryBlock) - 1;
+            return bytes / ALIGN - 1;
+        }
+
+        // 工具函数：向上取整到 CACHE_LINE_SIZE 的倍数
+        static size_t cache_line_bytes(size_t bytes) noexcept 
+        {
+            return (bytes + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1);
+        }
+
+        // 工具函数：计算缓存行空闲列表索引，bytes 须已按 CACHE_LINE_SIZE 对齐
+        static size_t cache_line_index(size_t bytes) noexcept 
+        {
+            return bytes / CACHE_LINE_SIZE - 1;
+        }
+
+    private:
+
+        // 大块内存头部之后的可用起始地址，malloc 的结果已满足 ALIGN 对齐
+        static char* chunk_begin(MemoryChunk* c) noexcept 
+        {
+            return reinterpret_cast<char*>(c) + CHUNK_HEADER;
+        }
+
+        static void free_chunk(MemoryChunk* c) noexcept 
+        {
+            if (c->mapped) huge_page_free(c, c->mapped);
+            else std::free(c);
         }
 
         // 分配新的内存块
         void allocate_chunk() 
         {
-            // 分配额外的空间用于对齐
-            char* new_memory = static_cast<char*>(std::malloc(BLOCK_SIZE + ALIGN));
-            if (!new_memory) throw std::bad_alloc();
+            size_t size = next_chunk_size_;
+            size_t mapped = 0;
+            void* memory = nullptr;
+            if (huge_pages_) 
+            {
+                // 按大页取整，取整多出的尾部同样可以切分
+                mapped = (CHUNK_HEADER + size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+                memory = huge_page_alloc(mapped);
+                if (memory) size = mapped - CHUNK_HEADER;
+                else mapped = 0;  // 映射失败时退回 malloc
+            }
+            if (!memory) 
+            {
+                memory = std::malloc(CHUNK_HEADER + size);
+                if (!memory) throw std::bad_alloc();
+            }
+
+            if (memory_chunk) chunks->used = chunks->size - chunk_size;  // 旧块剩余部分不再使用
+            chunks = ::new (memory) MemoryChunk{chunks, size, 0, mapped};
+            memory_chunk = chunk_begin(chunks);
+            chunk_size = size;
 
-            // 计算对齐后的内存地址
-            char* aligned_memory = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(new_memory) + ALIGN - 1) & ~(ALIGN - 1));
+            if (growth_factor_ > 1) 
+                next_chunk_size_ = mystl::min(next_chunk_size_ * growth_factor_, max_chunk_size_);
+        }
+
+        // 查找包含 p 的大块内存，usage 已按起始地址排序
+        static ChunkUsage* find_chunk(ChunkUsage* usage, size_t count, const void* p) noexcept 
+        {
+            const char* addr = static_cast<const char*>(p);
+            size_t lo = 0, hi = count;
+            while (lo < hi) 
+            {
+                size_t mid = lo + (hi - lo) / 2;
+                if (usage[mid].begin <= addr) lo = mid + 1;
+                else hi = mid;
+            }
+            if (lo == 0) return nullptr;
+            ChunkUsage* u = usage + lo - 1;
+            return addr < u->begin + u->size ? u : nullptr;
+        }
 
-            // 保存并更新内存块信息
-            chunks = new MemoryChunk{new_memory, chunks};
-            memory_chunk = aligned_memory;
-            chunk_size = BLOCK_SIZE;
+        // 当前块的切分位置距离下一个缓存行边界的字节数
+        size_t cache_line_padding() const noexcept 
+        {
+            auto addr = reinterpret_cast<std::uintptr_t>(memory_chunk);
+            return ((addr + CACHE_LINE_SIZE - 1) & ~std::uintptr_t(CACHE_LINE_SIZE - 1)) - addr;
+        }
+
+        // 回收扫描：把空闲列表 list 中每个 bytes 大小的块计入所属大块内存
+        static void count_free_bytes(ChunkUsage* usage, size_t count, MemoryBlock* list, size_t bytes) noexcept 
+        {
+            for (MemoryBlock* b = list; b; b = b->next) 
+            {
+                if (ChunkUsage* u = find_chunk(usage, count, b)) u->free_bytes += bytes;
+            }
+        }
+
+        // 回收扫描：从空闲列表 list 中摘除属于可释放大块的内存块
+        void unlink_releasable(ChunkUsage* usage, size_t count, MemoryBlock*& list, size_t bytes) noexcept 
+        {
+            MemoryBlock** link = &list;
+            while (*link) 
+            {
+                ChunkUsage* u = find_chunk(usage, count, *link);
+                if (u && u->free_bytes == u->used) 
+                {
+                    *link = (*link)->next;
+                    free_bytes_ -= bytes;
+                    MYSTL_POOL_STAT(stats_[free_list_index(bytes)].bytes_reserved -= bytes);
+                }
+                else 
+                {
+                    link = &(*link)->next;
+                }
+            }
+        }
+
+#ifdef MYSTL_POOL_STATS
+        void count_allocation(size_t index, size_t bytes, size_t count = 1) noexcept 
+        {
+            stats_[index].allocations += count;
+            stats_[index].bytes_live += bytes * count;
+        }
+#endif
+
+        // 空闲字节超过触发点时自动回收，并把下一次触发点推后，避免碎片化时反复扫描
+        void maybe_auto_trim() noexcept 
+        {
+            if (trim_threshold_ == 0 || free_bytes_ <= next_trim_at_) return;
+            release_unused();
+            next_trim_at_ = mystl::max(trim_threshold_, free_bytes_ * 2);
         }
 
     public:
@@ -81,8 +398,7 @@ namespace mystl
             while (chunks) 
             {
                 MemoryChunk* next = chunks->next;
-                std::free(chunks->memory);
-                delete chunks;
+                free_chunk(chunks);
                 chunks = next;
             }
         }
@@ -91,13 +407,29 @@ namespace mystl
         MemoryPool(const MemoryPool&) = delete;
         MemoryPool& operator=(const MemoryPool&) = delete;
 
-        // 分配内存
+        // 分配内存，满足 alignof(T)
         T* allocate(size_t n = 1) 
         {
             if (n == 0) return nullptr;
-            
-            size_t bytes = align_up(n * sizeof(T));
+            if constexpr (alignof(T) > ALIGN)
+                return static_cast<T*>(allocate_bytes(align_up(n * sizeof(T)), alignof(T)));
+            else
+                return static_cast<T*>(allocate_bytes(align_up(n * sizeof(T))));
+        }
 
+        // 释放内存
+        void deallocate(T* p, size_t n = 1) noexcept 
+        {
+            if (!p) return;
+            if constexpr (alignof(T) > ALIGN)
+                deallocate_bytes(p, align_up(n * sizeof(T)), alignof(T));
+            else
+                deallocate_bytes(p, align_up(n * sizeof(T)));
+        }
+
+        // 按字节分配，bytes 须已按 ALIGN 对齐且不为 0
+        void* allocate_bytes(size_t bytes) 
+        {
             // 小对象从空闲列表分配
             if (bytes <= MAX_BYTES) 
             {
@@ -105,8 +437,10 @@ namespace mystl
                 // 如果空闲列表有可用块，直接使用
                 if (free_lists[index]) 
                 {
-                    T* result = reinterpret_cast<T*>(free_lists[index]);
-                    free_lists[index] = free_lists[index]->next;
+                    MemoryBlock* result = free_lists[index];
+                    free_lists[index] = result->next;
+                    free_bytes_ -= bytes;
+                    MYSTL_POOL_STAT((count_allocation(index, bytes), ++stats_[index].free_list_hits));
                     return result;
                 }
 
@@ -118,57 +452,936 @@ namespace mystl
                     {
                         void* p = std::malloc(bytes);
                         if (!p) throw std::bad_alloc();
-                        return static_cast<T*>(p);
+                        MYSTL_POOL_STAT((count_allocation(index, bytes), ++stats_[index].malloc_fallbacks));
+                        return p;
                     }
                     
                     // 分配新的内存块
                     allocate_chunk();
                 }
 
-                T* result = reinterpret_cast<T*>(memory_chunk);
+                char* result = memory_chunk;
                 memory_chunk += bytes;
                 chunk_size -= bytes;
+                MYSTL_POOL_STAT((count_allocation(index, bytes), ++stats_[index].chunk_carves,
+                                 stats_[index].bytes_reserved += bytes));
                 return result;
             }
 
             // 大对象直接用malloc
             void* p = std::malloc(bytes);
             if (!p) throw std::bad_alloc();
-            return static_cast<T*>(p);
+            MYSTL_POOL_STAT((++large_stats_.allocations, ++large_stats_.malloc_fallbacks,
+                             large_stats_.bytes_live += bytes));
+            return p;
         }
 
-        // 释放内存
-        void deallocate(T* p, size_t n = 1) noexcept 
+        // 按字节释放，bytes 须与分配时一致
+        void deallocate_bytes(void* p, size_t bytes) noexcept 
         {
-            if (!p) return;
-            
-            size_t bytes = align_up(n * sizeof(T));
             if (bytes <= MAX_BYTES) 
             {
                 // 小对象放回对应的空闲列表
                 size_t index = free_list_index(bytes);
-                auto block = reinterpret_cast<MemoryBlock*>(p);
+                MYSTL_POOL_STAT((++stats_[index].frees, stats_[index].bytes_live -= bytes));
+                auto block = static_cast<MemoryBlock*>(p);
                 block->next = free_lists[index];
                 free_lists[index] = block;
+                free_bytes_ += bytes;
+                maybe_auto_trim();
             }
             else 
             {
                 // 大对象直接释放
+                MYSTL_POOL_STAT((++large_stats_.frees, large_stats_.bytes_live -= bytes));
                 std::free(p);
             }
         }
+
+        // 批量分配 n 个 bytes 大小的块写入 out[0, n)，bytes 须已按 ALIGN 对齐且不为 0
+        // 先取空闲列表，不足的部分从当前大块内存一次连续切分，块在内存中相邻，切分开销按批摊薄
+        // 抛出异常时已取得的块全部归还
+        template<class P>
+        void allocate_batch(size_t bytes, P** out, size_t n) 
+        {
+            size_t i = 0;
+            if (bytes > MAX_BYTES) 
+            {
+                try 
+                {
+                    for (; i < n; ++i) out[i] = static_cast<P*>(allocate_bytes(bytes));
+                }
+                catch (...) 
+                {
+                    deallocate_batch(bytes, out, i);
+                    throw;
+                }
+                return;
+            }
+
+            size_t index = free_list_index(bytes);
+            MemoryBlock* list = free_lists[index];
+            for (; i < n && list; ++i) 
+            {
+                out[i] = reinterpret_cast<P*>(list);
+                list = list->next;
+            }
+            free_lists[index] = list;
+            free_bytes_ -= i * bytes;
+            MYSTL_POOL_STAT((count_allocation(index, bytes, i), stats_[index].free_list_hits += i));
+
+            while (i < n) 
+            {
+                if (chunk_size < bytes || !memory_chunk) 
+                {
+                    try 
+                    {
+                        allocate_chunk();
+                    }
+                    catch (...) 
+                    {
+                        deallocate_batch(bytes, out, i);
+                        throw;
+                    }
+                }
+                size_t take = mystl::min(n - i, chunk_size / bytes);
+                for (size_t k = 0; k < take; ++k) out[i++] = reinterpret_cast<P*>(memory_chunk + k * bytes);
+                memory_chunk += take * bytes;
+                chunk_size -= take * bytes;
+                MYSTL_POOL_STAT((count_allocation(index, bytes, take), stats_[index].chunk_carves += take,
+                                 stats_[index].bytes_reserved += take * bytes));
+            }
+        }
+
+        // 批量释放 allocate_batch 得到的块，bytes 须与分配时一致
+        template<class P>
+        void deallocate_batch(size_t bytes, P* const* ptrs, size_t n) noexcept 
+        {
+            if (bytes > MAX_BYTES) 
+            {
+                for (size_t i = 0; i < n; ++i) deallocate_bytes(ptrs[i], bytes);
+                return;
+            }
+
+            // 逆序入栈，下一次批量分配按原来的顺序取出
+            size_t index = free_list_index(bytes);
+            for (size_t i = n; i > 0; --i) 
+            {
+                auto block = reinterpret_cast<MemoryBlock*>(ptrs[i - 1]);
+                block->next = free_lists[index];
+                free_lists[index] = block;
+            }
+            free_bytes_ += n * bytes;
+            MYSTL_POOL_STAT((stats_[index].frees += n, stats_[index].bytes_live -= n * bytes));
+            maybe_auto_trim();
+        }
+
+        // 按字节分配并满足 align 对齐（2 的幂），bytes 须已按 ALIGN 对齐且不为 0
+        // 对齐要求不超过 ALIGN 时等同于 allocate_bytes(bytes)；
+        // 不超过 CACHE_LINE_SIZE 的小对象使用缓存行尺寸等级，其余直接向系统申请对齐内存
+        void* allocate_bytes(size_t bytes, size_t align) 
+        {
+            static_assert(BLOCK_SIZE >= MAX_BYTES + CACHE_LINE_SIZE, "BlockSize too small for cache-line size classes");
+
+            if (align <= ALIGN) return allocate_bytes(bytes);
+            if (align > CACHE_LINE_SIZE || bytes > MAX_BYTES) 
+            {
+                void* p = aligned_malloc(bytes, align);
+                MYSTL_POOL_STAT((++large_stats_.allocations, ++large_stats_.malloc_fallbacks,
+                                 large_stats_.bytes_live += bytes));
+                return p;
+            }
+
+            // 缓存行尺寸等级的统计并入同尺寸的普通等级
+            bytes = cache_line_bytes(bytes);
+            [[maybe_unused]] size_t index = free_list_index(bytes);  // 仅统计使用
+            MemoryBlock*& list = cache_line_lists[cache_line_index(bytes)];
+            if (list) 
+            {
+                MemoryBlock* result = list;
+                list = result->next;
+                free_bytes_ -= bytes;
+                MYSTL_POOL_STAT((count_allocation(index, bytes), ++stats_[index].free_list_hits));
+                return result;
+            }
+
+            size_t pad = cache_line_padding();
+            if (!memory_chunk || chunk_size < pad + bytes) 
+            {
+                allocate_chunk();
+                pad = cache_line_padding();
+            }
+            if (pad) 
+            {
+                // 对齐跳过的部分是 ALIGN 的倍数，作为普通小块放入空闲列表，不浪费
+                size_t pad_index = free_list_index(pad);
+                auto block = reinterpret_cast<MemoryBlock*>(memory_chunk);
+                block->next = free_lists[pad_index];
+                free_lists[pad_index] = block;
+                free_bytes_ += pad;
+                memory_chunk += pad;
+                chunk_size -= pad;
+                MYSTL_POOL_STAT(stats_[pad_index].bytes_reserved += pad);
+            }
+
+            char* result = memory_chunk;
+            memory_chunk += bytes;
+            chunk_size -= bytes;
+            MYSTL_POOL_STAT((count_allocation(index, bytes), ++stats_[index].chunk_carves,
+                             stats_[index].bytes_reserved += bytes));
+            return result;
+        }
+
+        // 按字节释放，bytes 和 align 须与分配时一致
+        void deallocate_bytes(void* p, size_t bytes, size_t align) noexcept 
+        {
+            if (align <= ALIGN) 
+            {
+                deallocate_bytes(p, bytes);
+                return;
+            }
+            if (align > CACHE_LINE_SIZE || bytes > MAX_BYTES) 
+            {
+                MYSTL_POOL_STAT((++large_stats_.frees, large_stats_.bytes_live -= bytes));
+                aligned_free(p);
+                return;
+            }
+
+            bytes = cache_line_bytes(bytes);
+            MYSTL_POOL_STAT((++stats_[free_list_index(bytes)].frees,
+                             stats_[free_list_index(bytes)].bytes_live -= bytes));
+            MemoryBlock*& list = cache_line_lists[cache_line_index(bytes)];
+            auto block = static_cast<MemoryBlock*>(p);
+            block->next = list;
+            list = block;
+            free_bytes_ += bytes;
+            maybe_auto_trim();
+        }
+
+        // 把 allocate_bytes(old_bytes, align) 得到的块调整为 new_bytes，内容保留到新旧大小中较小者
+        // 只处理新旧大小都超过 MAX_BYTES、直接来自系统的大块，其余情况返回 nullptr，由调用者分配新块并复制；
+        // 失败时抛出 bad_alloc，原内存不变。align 超过 ALIGN 时只尽力对齐，见 system_realloc
+        void* reallocate_bytes(void* p, size_t old_bytes, size_t new_bytes, size_t align)
+        {
+            if (old_bytes <= MAX_BYTES || new_bytes <= MAX_BYTES) return nullptr;
+            void* q = system_realloc(p, new_bytes, align > ALIGN, align);
+            MYSTL_POOL_STAT((++large_stats_.allocations, ++large_stats_.frees,
+                             large_stats_.bytes_live += new_bytes - old_bytes));
+            return q;
+        }
+
+        // 把所有块都已回到空闲列表中的大块内存释放掉，返回释放的字节数
+        // 只在回收时扫描空闲列表，分配/释放的热路径没有额外开销
+        size_t release_unused() noexcept 
+        {
+            size_t count = 0;
+            for (MemoryChunk* c = chunks; c; c = c->next) ++count;
+            if (count == 0) return 0;
+
+            auto usage = static_cast<ChunkUsage*>(std::malloc(count * sizeof(ChunkUsage)));
+            if (!usage) return 0;
+
+            // memory_chunk 非空时，链表头就是当前正在切分的块
+            MemoryChunk* current = memory_chunk ? chunks : nullptr;
+            if (current) current->used = current->size - chunk_size;
+            size_t i = 0;
+            for (MemoryChunk* c = chunks; c; c = c->next) usage[i++] = ChunkUsage{chunk_begin(c), c->size, c->used, 0};
+            mystl::sort(usage, usage + count, [](const ChunkUsage& a, const ChunkUsage& b)
+            {
+                return a.begin < b.begin;
+            });
+
+            // 统计每个大块内存中空闲的字节数
+            for (size_t index = 0; index < NUM_FREE_LISTS; ++index) 
+            {
+                count_free_bytes(usage, count, free_lists[index], (index + 1) * ALIGN);
+            }
+            for (size_t index = 0; index < NUM_CACHE_LINE_LISTS; ++index) 
+            {
+                count_free_bytes(usage, count, cache_line_lists[index], (index + 1) * CACHE_LINE_SIZE);
+            }
+
+            // 从空闲列表中摘除属于可释放大块的内存块
+            for (size_t index = 0; index < NUM_FREE_LISTS; ++index) 
+            {
+                unlink_releasable(usage, count, free_lists[index], (index + 1) * ALIGN);
+            }
+            for (size_t index = 0; index < NUM_CACHE_LINE_LISTS; ++index) 
+            {
+                unlink_releasable(usage, count, cache_line_lists[index], (index + 1) * CACHE_LINE_SIZE);
+            }
+
+            // 释放大块内存
+            size_t released = 0;
+            MemoryChunk** link = &chunks;
+            while (*link) 
+            {
+                MemoryChunk* c = *link;
+                ChunkUsage* u = find_chunk(usage, count, chunk_begin(c));
+                if (u->free_bytes == u->used) 
+                {
+                    if (c == current) 
+                    {
+                        // 当前正在切分的块也被释放了
+                        memory_chunk = nullptr;
+                        chunk_size = 0;
+                    }
+                    *link = c->next;
+                    released += c->size;
+                    free_chunk(c);
+                }
+                else 
+                {
+                    link = &c->next;
+                }
+            }
+
+            std::free(usage);
+            return released;
+        }
+
+        // 释放未使用的大块内存，并尽量把 malloc 堆顶的空闲内存交还操作系统
+        size_t trim() noexcept 
+        {
+            size_t released = release_unused();
+#if defined(__GLIBC__)
+            ::malloc_trim(0);
+#endif
+            return released;
+        }
+
+        // 设置自动回收阈值：空闲列表中的字节数超过该值时，释放操作会顺带执行 release_unused
+        // 传入 0 关闭自动回收
+        void set_trim_threshold(size_t bytes) noexcept 
+        {
+            trim_threshold_ = bytes;
+            next_trim_at_ = bytes;
+        }
+
+        // 大块内存的几何增长：每申请一个新块，下一块的大小乘以 factor，直到 max_chunk_size
+        // 块越大，节点在地址空间中越集中，遍历时的 TLB 缺失越少；factor 为 1 时恢复固定的 BLOCK_SIZE
+        // 只影响之后申请的大块内存
+        void set_chunk_growth(size_t factor, size_t max_chunk_size) noexcept 
+        {
+            growth_factor_ = factor ? factor : 1;
+            max_chunk_size_ = mystl::max(max_chunk_size, BLOCK_SIZE);
+            next_chunk_size_ = growth_factor_ > 1 ? mystl::min(next_chunk_size_, max_chunk_size_) : BLOCK_SIZE;
+        }
+
+        // 开启后大块内存用 mmap 按 HUGE_PAGE_SIZE 对齐申请并建议内核使用透明大页，
+        // 每块至少 HUGE_PAGE_SIZE；非 Linux 平台或映射失败时退回 malloc
+        void set_huge_pages(bool enable) noexcept 
+        {
+            huge_pages_ = enable;
+        }
+
+        // 当前持有的大块内存数量
+        size_t chunk_count() const noexcept 
+        {
+            size_t count = 0;
+            for (MemoryChunk* c = chunks; c; c = c->next) ++count;
+            return count;
+        }
+
+        // 当前持有的大块内存的可切分总字节数
+        size_t bytes_reserved() const noexcept 
+        {
+            size_t bytes = 0;
+            for (MemoryChunk* c = chunks; c; c = c->next) bytes += c->size;
+            return bytes;
+        }
+
+        using stats_type = pool_stats<NUM_FREE_LISTS>;
+
+        // 统计快照；未定义 MYSTL_POOL_STATS 时只有大块内存的数量和总字节数
+        stats_type stats() const noexcept 
+        {
+            stats_type result;
+#ifdef MYSTL_POOL_STATS
+            for (size_t i = 0; i < NUM_FREE_LISTS; ++i) result.classes[i] = stats_[i];
+            result.large = large_stats_;
+#endif
+            for (size_t i = 0; i < NUM_FREE_LISTS; ++i) result.classes[i].size = (i + 1) * ALIGN;
+            result.large.size = 0;
+            result.chunk_count = chunk_count();
+            result.bytes_reserved = bytes_reserved();
+            return result;
+        }
     };
 
 
 
+    //------------------------------------------------------------------------------
+    // 并发内存池：每个线程持有按尺寸分级的空闲块弹匣（magazine），
+    // 分配和释放只操作本线程的弹匣，不加锁；
+    // 弹匣取空或溢出时，才加锁与中心内存池成批交换内存块
+    //------------------------------------------------------------------------------
+    template<class T, size_t BlockSize = 4096>
+    class ConcurrentMemoryPool 
+    {
+    private:
+        using central_pool = MemoryPool<T, BlockSize>;
+
+        static constexpr size_t MAX_BYTES = central_pool::MAX_BYTES;
+        static constexpr size_t NUM_FREE_LISTS = central_pool::NUM_FREE_LISTS;
+        static constexpr size_t BATCH_COUNT = 32;  // 与中心池每次交换的块数
+        static constexpr size_t MAGAZINE_CAPACITY = BATCH_COUNT * 2;  // 弹匣容量，超过后归还一批
+
+        // 弹匣：本线程持有的某一尺寸的空闲块链表
+        struct Magazine 
+        {
+            MemoryBlock* head{nullptr};
+            size_t count{0};
+        };
+
+        // 线程缓存：线程退出时把所有空闲块归还中心池
+        struct ThreadCache 
+        {
+            Magazine magazines[NUM_FREE_LISTS];
+
+            ~ThreadCache() 
+            {
+                ConcurrentMemoryPool& pool = ConcurrentMemoryPool::instance();
+                std::lock_guard<std::mutex> lock(pool.mutex_);
+                for (size_t i = 0; i < NUM_FREE_LISTS; ++i) 
+                {
+                    pool.drain_locked(magazines[i], (i + 1) * central_pool::ALIGN, magazines[i].count);
+                }
+                cache_destroyed() = true;
+            }
+        };
+
+        central_pool central_;  // 中心内存池，只在持有 mutex_ 时访问
+        std::mutex mutex_;
+
+#ifdef MYSTL_POOL_STATS
+        // 弹匣上的分配/释放发生在锁外，计数使用原子变量
+        struct AtomicClassStats 
+        {
+            std::atomic<size_t> allocations{0};
+            std::atomic<size_t> frees{0};
+            std::atomic<size_t> free_list_hits{0};
+            std::atomic<size_t> malloc_fallbacks{0};
+            std::atomic<size_t> bytes_live{0};
+        };
+        AtomicClassStats stats_[NUM_FREE_LISTS + 1];  // 最后一项统计大对象
+
+        static void bump(std::atomic<size_t>& counter, size_t value = 1) noexcept 
+        {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        static void drop(std::atomic<size_t>& counter, size_t value) noexcept 
+        {
+            counter.fetch_sub(value, std::memory_order_relaxed);
+        }
+#endif
+
+        ConcurrentMemoryPool() = default;
+
+        static ThreadCache& local_cache() noexcept 
+        {
+            static thread_local ThreadCache cache;
+            return cache;
+        }
+
+        // 线程缓存析构后（线程退出阶段）仍可能有释放操作，此时直接走中心池
+        static bool& cache_destroyed() noexcept 
+        {
+            static thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        // 从中心池取一批内存块填充弹匣，调用者须持有锁
+        void refill_locked(Magazine& mag, size_t bytes) 
+        {
+            for (size_t i = 0; i < BATCH_COUNT; ++i) 
+            {
+                auto block = static_cast<MemoryBlock*>(central_.allocate_bytes(bytes));
+                block->next = mag.head;
+                mag.head = block;
+                ++mag.count;
+            }
+        }
+
+        // 从弹匣归还 count 个内存块到中心池，调用者须持有锁
+        void drain_locked(Magazine& mag, size_t bytes, size_t count) noexcept 
+        {
+            for (; count > 0 && mag.head; --count) 
+            {
+                MemoryBlock* block = mag.head;
+                mag.head = block->next;
+                --mag.count;
+                central_.deallocate_bytes(block, bytes);
+            }
+        }
+
+    public:
+        // 进程内唯一实例；有意不析构，保证线程退出时归还内存块总是安全的
+        static ConcurrentMemoryPool& instance() 
+        {
+            static ConcurrentMemoryPool* pool = new ConcurrentMemoryPool;
+            return *pool;
+        }
+
+        ConcurrentMemoryPool(const ConcurrentMemoryPool&) = delete;
+        ConcurrentMemoryPool& operator=(const ConcurrentMemoryPool&) = delete;
+
+        // 分配内存，满足 alignof(T)
+        T* allocate(size_t n = 1) 
+        {
+            if (n == 0) return nullptr;
+            return static_cast<T*>(allocate_bytes(central_pool::align_up(n * sizeof(T)), alignof(T)));
+        }
+
+        // 释放内存
+        void deallocate(T* p, size_t n = 1) noexcept 
+        {
+            if (!p) return;
+            deallocate_bytes(p, central_pool::align_up(n * sizeof(T)), alignof(T));
+        }
+
+        // 按字节分配，bytes 须已按 ALIGN 对齐且不为 0
+        void* allocate_bytes(size_t bytes) 
+        {
+            // 大对象直接用malloc，本身是线程安全的
+            if (bytes > MAX_BYTES) 
+            {
+                void* p = std::malloc(bytes);
+                if (!p) throw std::bad_alloc();
+                MYSTL_POOL_STAT((bump(stats_[NUM_FREE_LISTS].allocations), bump(stats_[NUM_FREE_LISTS].malloc_fallbacks),
+                                 bump(stats_[NUM_FREE_LISTS].bytes_live, bytes)));
+                return p;
+            }
+
+            size_t index = central_pool::free_list_index(bytes);
+            if (cache_destroyed()) 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                void* p = central_.allocate_bytes(bytes);
+                MYSTL_POOL_STAT((bump(stats_[index].allocations), bump(stats_[index].bytes_live, bytes)));
+                return p;
+            }
+
+            Magazine& mag = local_cache().magazines[index];
+            if (!mag.head) 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                refill_locked(mag, bytes);
+            }
+            else 
+            {
+                MYSTL_POOL_STAT(bump(stats_[index].free_list_hits));
+            }
+
+            MemoryBlock* result = mag.head;
+            mag.head = result->next;
+            --mag.count;
+            MYSTL_POOL_STAT((bump(stats_[index].allocations), bump(stats_[index].bytes_live, bytes)));
+            return result;
+        }
+
+        // 按字节释放，bytes 须与分配时一致；可以在与分配不同的线程中释放
+        void deallocate_bytes(void* p, size_t bytes) noexcept 
+        {
+            if (bytes > MAX_BYTES) 
+            {
+                MYSTL_POOL_STAT((bump(stats_[NUM_FREE_LISTS].frees), drop(stats_[NUM_FREE_LISTS].bytes_live, bytes)));
+                std::free(p);
+                return;
+            }
+
+            size_t index = central_pool::free_list_index(bytes);
+            MYSTL_POOL_STAT((bump(stats_[index].frees), drop(stats_[index].bytes_live, bytes)));
+
+            if (cache_destroyed()) 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                central_.deallocate_bytes(p, bytes);
+                return;
+            }
+
+            Magazine& mag = local_cache().magazines[index];
+            auto block = static_cast<MemoryBlock*>(p);
+            block->next = mag.head;
+            mag.head = block;
+
+            // 弹匣溢出时归还一批，避免生产者/消费者线程模式下内存块堆积在单个线程
+            if (++mag.count > MAGAZINE_CAPACITY) 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                drain_locked(mag, bytes, BATCH_COUNT);
+            }
+        }
+
+        // 批量分配 n 个 bytes 大小的块写入 out[0, n)：先取本线程弹匣，
+        // 不足的部分只加一次锁，由中心池连续切分
+        template<class P>
+        void allocate_batch(size_t bytes, P** out, size_t n) 
+        {
+            size_t i = 0;
+            if (bytes > MAX_BYTES) 
+            {
+                try 
+                {
+                    for (; i < n; ++i) out[i] = static_cast<P*>(allocate_bytes(bytes));
+                }
+                catch (...) 
+                {
+                    deallocate_batch(bytes, out, i);
+                    throw;
+                }
+                return;
+            }
+
+            size_t index = central_pool::free_list_index(bytes);
+            if (!cache_destroyed()) 
+            {
+                Magazine& mag = local_cache().magazines[index];
+                for (; i < n && mag.head; ++i) 
+                {
+                    out[i] = reinterpret_cast<P*>(mag.head);
+                    mag.head = mag.head->next;
+                    --mag.count;
+                }
+                MYSTL_POOL_STAT(bump(stats_[index].free_list_hits, i));
+            }
+            if (i < n) 
+            {
+                try 
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    central_.allocate_batch(bytes, out + i, n - i);
+                }
+                catch (...) 
+                {
+                    deallocate_batch(bytes, out, i);
+                    throw;
+                }
+            }
+            MYSTL_POOL_STAT((bump(stats_[index].allocations, n), bump(stats_[index].bytes_live, n * bytes)));
+        }
+
+        // 批量释放 allocate_batch 得到的块，bytes 须与分配时一致
+        template<class P>
+        void deallocate_batch(size_t bytes, P* const* ptrs, size_t n) noexcept 
+        {
+            for (size_t i = 0; i < n; ++i) deallocate_bytes(ptrs[i], bytes);
+        }
+
+        // 按字节分配并满足 align 对齐；超过 ALIGN 的对齐要求不经过弹匣：
+        // 缓存行尺寸等级加锁访问中心池，更大的直接向系统申请
+        void* allocate_bytes(size_t bytes, size_t align) 
+        {
+            if (align <= central_pool::ALIGN) return allocate_bytes(bytes);
+
+            void* p;
+            if (align > central_pool::CACHE_LINE_SIZE || bytes > MAX_BYTES) 
+            {
+                p = aligned_malloc(bytes, align);
+            }
+            else 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                p = central_.allocate_bytes(bytes, align);
+            }
+            MYSTL_POOL_STAT((bump(stats_[aligned_stat_index(bytes, align)].allocations),
+                             bump(stats_[aligned_stat_index(bytes, align)].bytes_live, aligned_stat_bytes(bytes, align))));
+            return p;
+        }
+
+        // 按字节释放，bytes 和 align 须与分配时一致
+        void deallocate_bytes(void* p, size_t bytes, size_t align) noexcept 
+        {
+            if (align <= central_pool::ALIGN) 
+            {
+                deallocate_bytes(p, bytes);
+                return;
+            }
+
+            MYSTL_POOL_STAT((bump(stats_[aligned_stat_index(bytes, align)].frees),
+                             drop(stats_[aligned_stat_index(bytes, align)].bytes_live, aligned_stat_bytes(bytes, align))));
+            if (align > central_pool::CACHE_LINE_SIZE || bytes > MAX_BYTES) 
+            {
+                aligned_free(p);
+            }
+            else 
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                central_.deallocate_bytes(p, bytes, align);
+            }
+        }
+
+        // 调整大块的大小，语义同 MemoryPool::reallocate_bytes；大块直接来自系统，不需要加锁
+        void* reallocate_bytes(void* p, size_t old_bytes, size_t new_bytes, size_t align)
+        {
+            if (old_bytes <= MAX_BYTES || new_bytes <= MAX_BYTES) return nullptr;
+            void* q = system_realloc(p, new_bytes, align > central_pool::ALIGN, align);
+            MYSTL_POOL_STAT((bump(stats_[NUM_FREE_LISTS].allocations), bump(stats_[NUM_FREE_LISTS].frees),
+                             drop(stats_[NUM_FREE_LISTS].bytes_live, old_bytes),
+                             bump(stats_[NUM_FREE_LISTS].bytes_live, new_bytes)));
+            return q;
+        }
+
+        // 先把本线程弹匣中的块全部归还中心池，再释放中心池中完全空闲的大块内存
+        // 其他线程弹匣中缓存的块仍被视为在使用中
+        size_t release_unused() noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            drain_local_locked();
+            return central_.release_unused();
+        }
+
+        size_t trim() noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            drain_local_locked();
+            return central_.trim();
+        }
+
+        void set_trim_threshold(size_t bytes) noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            central_.set_trim_threshold(bytes);
+        }
+
+        void set_chunk_growth(size_t factor, size_t max_chunk_size) noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            central_.set_chunk_growth(factor, max_chunk_size);
+        }
+
+        void set_huge_pages(bool enable) noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            central_.set_huge_pages(enable);
+        }
+
+        size_t chunk_count() noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return central_.chunk_count();
+        }
+
+        size_t bytes_reserved() noexcept 
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return central_.bytes_reserved();
+        }
+
+        using stats_type = typename central_pool::stats_type;
+
+        // 统计快照：切分和大块内存的数据来自中心池，
+        // 分配/释放/命中来自弹匣层，free_list_hits 表示直接从本线程弹匣取到的次数
+        stats_type stats() noexcept 
+        {
+            stats_type result;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                result = central_.stats();
+            }
+#ifdef MYSTL_POOL_STATS
+            for (size_t i = 0; i <= NUM_FREE_LISTS; ++i) 
+            {
+                size_class_stats& dst = i < NUM_FREE_LISTS ? result.classes[i] : result.large;
+                dst.allocations = stats_[i].allocations.load(std::memory_order_relaxed);
+                dst.frees = stats_[i].frees.load(std::memory_order_relaxed);
+                dst.free_list_hits = stats_[i].free_list_hits.load(std::memory_order_relaxed);
+                dst.malloc_fallbacks += stats_[i].malloc_fallbacks.load(std::memory_order_relaxed);
+                dst.bytes_live = stats_[i].bytes_live.load(std::memory_order_relaxed);
+            }
+#endif
+            return result;
+        }
+
+    private:
+#ifdef MYSTL_POOL_STATS
+        // 超对齐分配计入的统计项及字节数，与中心池的做法一致
+        static size_t aligned_stat_index(size_t bytes, size_t align) noexcept 
+        {
+            if (align > central_pool::CACHE_LINE_SIZE || bytes > MAX_BYTES) return NUM_FREE_LISTS;
+            return central_pool::free_list_index(central_pool::cache_line_bytes(bytes));
+        }
+
+        static size_t aligned_stat_bytes(size_t bytes, size_t align) noexcept 
+        {
+            if (align > central_pool::CACHE_LINE_SIZE || bytes > MAX_BYTES) return bytes;
+            return central_pool::cache_line_bytes(bytes);
+        }
+#endif
+
+        void drain_local_locked() noexcept 
+        {
+            if (cache_destroyed()) return;
+            ThreadCache& cache = local_cache();
+            for (size_t i = 0; i < NUM_FREE_LISTS; ++i) 
+            {
+                drain_locked(cache.magazines[i], (i + 1) * central_pool::ALIGN, cache.magazines[i].count);
+            }
+        }
+    };
+
+
+
+    //------------------------------------------------------------------------------
+    // 进程级尺寸分级内存池：按对齐后的字节数分级，
+    // allocator<T> 及其所有 rebind 共享同一组空闲列表，不同元素类型之间可以复用内存
+    //------------------------------------------------------------------------------
+#ifdef MYSTL_CONCURRENT_POOL
+    using size_class_pool_type = ConcurrentMemoryPool<char>;
+#else
+    using size_class_pool_type = MemoryPool<char>;
+#endif
+
+    // 有意不析构：静态存储期的容器可能在内存池之后才析构
+    inline size_class_pool_type& size_class_pool() 
+    {
+#ifdef MYSTL_CONCURRENT_POOL
+        return size_class_pool_type::instance();
+#else
+        static size_class_pool_type* pool = new size_class_pool_type;
+        return *pool;
+#endif
+    }
+
+
+
+    //------------------------------------------------------------------------------
+    // 按元素类型的分配统计：定位哪些容器在走超过 MAX_BYTES 的 malloc 路径
+    // 只在定义 MYSTL_POOL_STATS 时由 allocator<T> 记录
+    //------------------------------------------------------------------------------
+    struct allocator_type_stats 
+    {
+        const char* type_name;                     // typeid(T).name()
+        size_t type_size;                          // sizeof(T)
+        std::atomic<size_t> allocations{0};        // 分配次数
+        std::atomic<size_t> large_allocations{0};  // 超过 MAX_BYTES、直接使用 malloc 的分配次数
+        std::atomic<size_t> bytes_live{0};         // 已分配未释放的字节数
+        allocator_type_stats* next{nullptr};       // 全局链表
+    };
+
+    inline std::atomic<allocator_type_stats*>& allocator_stats_list() noexcept 
+    {
+        static std::atomic<allocator_type_stats*> head{nullptr};
+        return head;
+    }
+
+    // 把一个类型的统计挂到全局链表头部
+    inline bool register_allocator_stats(allocator_type_stats& stats) noexcept 
+    {
+        auto& head = allocator_stats_list();
+        stats.next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(stats.next, &stats, std::memory_order_release, std::memory_order_relaxed)) 
+        {
+        }
+        return true;
+    }
+
+    // 每个元素类型一份统计，平凡析构，程序退出阶段仍可安全访问
+    template<class T>
+    allocator_type_stats& allocator_stats_for() noexcept 
+    {
+        static allocator_type_stats stats{typeid(T).name(), sizeof(T)};
+        static bool registered = register_allocator_stats(stats);
+        (void)registered;
+        return stats;
+    }
+
+    // 遍历所有已记录的元素类型统计
+    template<class F>
+    void for_each_allocator_stats(F f) 
+    {
+        for (auto s = allocator_stats_list().load(std::memory_order_acquire); s; s = s->next) f(*s);
+    }
+
+    // 输出可读的类型名
+    inline void write_type_name(std::ostream& os, const char* name) 
+    {
+#if defined(__GNUG__)
+        int status = 0;
+        char* readable = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        if (status == 0 && readable) 
+        {
+            os << readable;
+            std::free(readable);
+            return;
+        }
+#endif
+        os << name;
+    }
+
+    inline void dump_allocator_stats_text(std::ostream& os) 
+    {
+        for_each_allocator_stats([&os](const allocator_type_stats& s)
+        {
+            write_type_name(os, s.type_name);
+            os << "\tsize=" << s.type_size
+               << " allocs=" << s.allocations.load(std::memory_order_relaxed)
+               << " large=" << s.large_allocations.load(std::memory_order_relaxed)
+               << " live=" << s.bytes_live.load(std::memory_order_relaxed) << '\n';
+        });
+    }
+
+    inline void dump_allocator_stats_json(std::ostream& os) 
+    {
+        os << '[';
+        bool first = true;
+        for_each_allocator_stats([&os, &first](const allocator_type_stats& s)
+        {
+            if (!first) os << ',';
+            first = false;
+            os << "{\"type\":\"";
+            write_type_name(os, s.type_name);
+            os << "\",\"size\":" << s.type_size
+               << ",\"allocations\":" << s.allocations.load(std::memory_order_relaxed)
+               << ",\"large_allocations\":" << s.large_allocations.load(std::memory_order_relaxed)
+               << ",\"bytes_live\":" << s.bytes_live.load(std::memory_order_relaxed) << '}';
+        });
+        os << ']';
+    }
+
+
+
     //------------------------------------------------------------------------------    
     // STL分配器封装：符合STL分配器要求的接口
     //------------------------------------------------------------------------------
+    // 所有类型共享 size_class_pool()；定义 MYSTL_CONCURRENT_POOL 后该内存池是线程安全的
     template<class T>
     class allocator 
     {
     private:
-        static MemoryPool<T> pool;  // 每个类型使用独立的内存池
+        // 元素数换算为内存池的尺寸等级
+        static size_t pool_bytes(size_t n) noexcept 
+        {
+            return MemoryPool<char>::align_up(n * sizeof(T));
+        }
+
+        // 分配的对齐要求：至少 alignof(T)；
+        // 浮点数与不窄于 4 字节的整数的数组不小于一个缓存行时按缓存行对齐，便于向量化代码使用对齐加载。
+        // 字节数组（字符串等）不在此列：缓存行尺寸等级按 64 字节取整，65 字节会占用 128 字节
+        static size_t pool_align(size_t n) noexcept 
+        {
+            constexpr size_t line = MemoryPool<char>::CACHE_LINE_SIZE;
+            constexpr bool simd_element = is_floating_point<T>::value || (is_integral<T>::value && sizeof(T) >= 4);
+            if (simd_element && n * sizeof(T) >= line)
+                return mystl::max(alignof(T), line);
+            return alignof(T);
+        }
+
+#ifdef MYSTL_POOL_STATS
+        static void count_allocation(size_t bytes, size_t count = 1) noexcept 
+        {
+            allocator_type_stats& s = allocator_stats_for<T>();
+            s.allocations.fetch_add(count, std::memory_order_relaxed);
+            if (bytes > MemoryPool<char>::MAX_BYTES) s.large_allocations.fetch_add(count, std::memory_order_relaxed);
+            s.bytes_live.fetch_add(bytes * count, std::memory_order_relaxed);
+        }
+
+        static void count_deallocation(size_t bytes, size_t count = 1) noexcept 
+        {
+            allocator_stats_for<T>().bytes_live.fetch_sub(bytes * count, std::memory_order_relaxed);
+        }
+#endif
 
     public:
         // STL要求的类型定义
@@ -212,13 +1425,66 @@ namespace mystl
         {
             if (n > max_size()) 
                 throw length_error("allocator<T>::allocate() - Integer overflow.");
-            return pool.allocate(n);
+            if (n == 0) return nullptr;
+            auto p = static_cast<pointer>(size_class_pool().allocate_bytes(pool_bytes(n), pool_align(n)));
+            MYSTL_POOL_STAT(count_allocation(pool_bytes(n)));
+            return p;
         }
 
         // 内存释放
         void deallocate(pointer p, size_type n) noexcept 
         {
-            pool.deallocate(p, n);
+            if (!p) return;
+            MYSTL_POOL_STAT(count_deallocation(pool_bytes(n)));
+            size_class_pool().deallocate_bytes(p, pool_bytes(n), pool_align(n));
+        }
+
+        // 把 allocate(old_n) 得到的内存调整为 new_n 个元素，内容按字节保留，不调用构造、析构函数，
+        // 只能用于可平凡重定位的元素。超过内存池小对象阈值的大块交给 realloc，Linux 上大块经 mremap 原地扩展；
+        // 不适用（小块或超对齐类型）时返回 nullptr，原内存不变，由调用者分配新空间
+        pointer reallocate(pointer p, size_type old_n, size_type new_n) 
+        {
+            if (!p || alignof(T) > MemoryPool<char>::ALIGN) return nullptr;
+            if (new_n > max_size()) 
+                throw length_error("allocator<T>::reallocate() - Integer overflow.");
+            void* q = size_class_pool().reallocate_bytes(p, pool_bytes(old_n), pool_bytes(new_n), pool_align(new_n));
+            if (!q) return nullptr;
+            MYSTL_POOL_STAT((count_deallocation(pool_bytes(old_n)), count_allocation(pool_bytes(new_n))));
+            return static_cast<pointer>(q);
+        }
+
+        // 批量分配 n 个单元素的块（节点容器的节点），写入 out[0, n)
+        // 尽量从同一个大块内存连续切分；超对齐类型逐个分配
+        void allocate_batch(pointer* out, size_type n) 
+        {
+            if (pool_align(1) > MemoryPool<char>::ALIGN) 
+            {
+                size_type i = 0;
+                try 
+                {
+                    for (; i < n; ++i) out[i] = allocate(1);
+                }
+                catch (...) 
+                {
+                    deallocate_batch(out, i);
+                    throw;
+                }
+                return;
+            }
+            size_class_pool().allocate_batch(pool_bytes(1), out, n);
+            MYSTL_POOL_STAT(count_allocation(pool_bytes(1), n));
+        }
+
+        // 批量释放 allocate_batch 或 allocate(1) 得到的块
+        void deallocate_batch(pointer* p, size_type n) noexcept 
+        {
+            if (pool_align(1) > MemoryPool<char>::ALIGN) 
+            {
+                for (size_type i = 0; i < n; ++i) deallocate(p[i], 1);
+                return;
+            }
+            MYSTL_POOL_STAT(count_deallocation(pool_bytes(1), n));
+            size_class_pool().deallocate_batch(pool_bytes(1), p, n);
         }
 
         // 返回最大可分配大小
@@ -228,9 +1494,59 @@ namespace mystl
         }
     };
 
-    // 静态内存池实例
-    template<class T>
-    MemoryPool<T> allocator<T>::pool;
+    //------------------------------------------------------------------------------
+    // 节点容器的批量分配：分配器提供 allocate_batch / deallocate_batch 时一次取得一批节点，
+    // 否则（如 arena_allocator、polymorphic_allocator）逐个调用 allocate(1)
+    //------------------------------------------------------------------------------
+    constexpr size_t NODE_BATCH_SIZE = 64;  // 节点容器批量构建时每批分配的节点数
+
+    template<class Alloc, class = void>
+    struct has_allocate_batch : false_type {};
+
+    template<class Alloc>
+    struct has_allocate_batch<Alloc, void_t<decltype(std::declval<Alloc&>().allocate_batch(
+        std::declval<typename Alloc::pointer*>(), size_t()))>> : true_type {};
+
+    // 分配器是否提供 reallocate(p, old_n, new_n)，见 allocator::reallocate
+    template<class Alloc, class = void>
+    struct has_reallocate : false_type {};
+
+    template<class Alloc>
+    struct has_reallocate<Alloc, void_t<decltype(std::declval<Alloc&>().reallocate(
+        std::declval<typename Alloc::pointer>(), size_t(), size_t()))>> : true_type {};
+
+    // 分配 n 个节点写入 out[0, n)；抛出异常时不持有任何节点
+    template<class Alloc>
+    void allocate_nodes(Alloc& alloc, typename Alloc::pointer* out, size_t n) 
+    {
+        if constexpr (has_allocate_batch<Alloc>::value) 
+        {
+            alloc.allocate_batch(out, n);
+        }
+        else 
+        {
+            size_t i = 0;
+            try 
+            {
+                for (; i < n; ++i) out[i] = alloc.allocate(1);
+            }
+            catch (...) 
+            {
+                while (i > 0) alloc.deallocate(out[--i], 1);
+                throw;
+            }
+        }
+    }
+
+    // 释放 n 个尚未构造元素的节点
+    template<class Alloc>
+    void deallocate_nodes(Alloc& alloc, typename Alloc::pointer* p, size_t n) noexcept 
+    {
+        if constexpr (has_allocate_batch<Alloc>::value) 
+            alloc.deallocate_batch(p, n);
+        else 
+            for (size_t i = 0; i < n; ++i) alloc.deallocate(p[i], 1);
+    }
 
     // 计算最大可分配大小
     template <class Alloc>
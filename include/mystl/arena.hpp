@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstdlib>  // for malloc, free
+#include <cstdint>  // for uintptr_t
+#include <new>      // for bad_alloc
+#include "expectdef.hpp"
+#include "util.hpp"
+#include "algorithm_base.hpp"
+
+namespace mystl
+{
+    //------------------------------------------------------------------------------
+    // 单调内存区域：只做指针前移式分配，释放是空操作，
+    // reset() 一次性回收全部内存，适合请求级的临时对象
+    //------------------------------------------------------------------------------
+    class monotonic_arena
+    {
+    private:
+        // 自行申请的缓冲区头部，直接存放在缓冲区起始处
+        struct Buffer
+        {
+            Buffer* next;  // 更早申请的缓冲区
+            size_t size;   // 缓冲区总字节数（含头部）
+        };
+
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 4096;  // 默认的首个缓冲区大小
+        static constexpr size_t GROWTH_FACTOR = 2;           // 缓冲区几何增长倍数
+
+        char* cur_{nullptr};          // 当前缓冲区中下一个可用地址
+        char* end_{nullptr};          // 当前缓冲区末尾
+        Buffer* buffers_{nullptr};    // 自行申请的缓冲区链表，头部是最新（最大）的一个
+        char* initial_{nullptr};      // 调用者提供的初始缓冲区
+        size_t initial_size_{0};
+        size_t next_size_;            // 下一次申请的缓冲区大小
+
+        static char* align_ptr(char* p, size_t align) noexcept
+        {
+            return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(p) + align - 1) & ~(align - 1));
+        }
+
+        // 申请一个至少能放下 bytes 字节（按 align 对齐）的新缓冲区
+        void grow(size_t bytes, size_t align)
+        {
+            size_t need = sizeof(Buffer) + bytes + align;
+            size_t size = mystl::max(next_size_, need);
+            auto buffer = static_cast<Buffer*>(std::malloc(size));
+            if (!buffer) throw std::bad_alloc();
+
+            buffer->next = buffers_;
+            buffer->size = size;
+            buffers_ = buffer;
+            cur_ = reinterpret_cast<char*>(buffer + 1);
+            end_ = reinterpret_cast<char*>(buffer) + size;
+            next_size_ = size * GROWTH_FACTOR;
+        }
+
+    public:
+        // 从空区域开始，首次分配时申请 initial_size 字节
+        explicit monotonic_arena(size_t initial_size = DEFAULT_BUFFER_SIZE) noexcept
+            : next_size_(initial_size ? initial_size : DEFAULT_BUFFER_SIZE)
+        {
+        }
+
+        // 先使用调用者提供的缓冲区（如栈上数组），用完后再向堆申请
+        monotonic_arena(void* buffer, size_t size) noexcept
+            : cur_(static_cast<char*>(buffer)), end_(static_cast<char*>(buffer) + size),
+              initial_(static_cast<char*>(buffer)), initial_size_(size),
+              next_size_(size ? size * GROWTH_FACTOR : DEFAULT_BUFFER_SIZE)
+        {
+        }
+
+        ~monotonic_arena()
+        {
+            release();
+        }
+
+        monotonic_arena(const monotonic_arena&) = delete;
+        monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+        // 分配 bytes 字节，按 align 对齐，align 必须是 2 的幂
+        void* allocate(size_t bytes, size_t align = alignof(max_align_t))
+        {
+            char* p = align_ptr(cur_, align);
+            if (!cur_ || p > end_ || static_cast<size_t>(end_ - p) < bytes)
+            {
+                grow(bytes, align);
+                p = align_ptr(cur_, align);
+            }
+            cur_ = p + bytes;
+            return p;
+        }
+
+        // 单调区域不单独回收内存
+        void deallocate(void*, size_t) noexcept {}
+
+        // 回收全部内存：保留最新（最大）的缓冲区供下一轮复用，其余交还给系统
+        // 之前分配出去的所有内存都随之失效
+        void reset() noexcept
+        {
+            if (!buffers_)
+            {
+                cur_ = initial_;
+                end_ = initial_ ? initial_ + initial_size_ : nullptr;
+                return;
+            }
+
+            Buffer* keep = buffers_;
+            Buffer* rest = keep->next;
+            while (rest)
+            {
+                Buffer* next = rest->next;
+                std::free(rest);
+                rest = next;
+            }
+            keep->next = nullptr;
+            cur_ = reinterpret_cast<char*>(keep + 1);
+            end_ = reinterpret_cast<char*>(keep) + keep->size;
+        }
+
+        // 回收全部内存并把所有自行申请的缓冲区交还给系统
+        void release() noexcept
+        {
+            while (buffers_)
+            {
+                Buffer* next = buffers_->next;
+                std::free(buffers_);
+                buffers_ = next;
+            }
+            cur_ = initial_;
+            end_ = initial_ ? initial_ + initial_size_ : nullptr;
+        }
+
+        // 自行申请的缓冲区总字节数
+        size_t bytes_reserved() const noexcept
+        {
+            size_t total = 0;
+            for (Buffer* b = buffers_; b; b = b->next) total += b->size;
+            return total;
+        }
+    };
+
+
+
+    //------------------------------------------------------------------------------
+    // 单调内存区域的分配器适配：接口与 mystl::allocator 相同（含 rebind），
+    // 可以作为任何容器的 Alloc 参数；不可默认构造，必须指定所用的区域
+    //------------------------------------------------------------------------------
+    template<class T>
+    class arena_allocator
+    {
+    private:
+        template<class U> friend class arena_allocator;
+
+        monotonic_arena* arena_;
+
+    public:
+        // STL要求的类型定义
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        // 允许分配器在不同类型间转换
+        template<typename U>
+        struct rebind { using other = arena_allocator<U>; };
+
+        // 构造函数
+        explicit arena_allocator(monotonic_arena& arena) noexcept : arena_(&arena) {}
+
+        // 允许从其他类型的分配器构造，共享同一区域
+        template<typename U>
+        arena_allocator(const arena_allocator<U>& other) noexcept : arena_(other.arena_) {}
+
+        // 比较操作：使用同一区域的分配器可以互相释放对方的内存
+        template <class U>
+        bool operator==(const arena_allocator<U>& other) const noexcept
+        {
+            return arena_ == other.arena_;
+        }
+
+        template <class U>
+        bool operator!=(const arena_allocator<U>& other) const noexcept
+        {
+            return arena_ != other.arena_;
+        }
+
+        // 内存分配
+        pointer allocate(size_type n)
+        {
+            if (n > max_size())
+                throw length_error("arena_allocator<T>::allocate() - Integer overflow.");
+            if (n == 0) return nullptr;
+            return static_cast<pointer>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        // 内存释放：由区域统一回收
+        void deallocate(pointer, size_type) noexcept {}
+
+        // 返回最大可分配大小
+        size_type max_size() const noexcept
+        {
+            return size_type(-1) / sizeof(T);
+        }
+
+        monotonic_arena* arena() const noexcept { return arena_; }
+    };
+
+} // namespace mystl
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+
+#include "functional.hpp"
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // 桶策略
+    // hashtable 通过 BucketPolicy 决定桶数与桶下标：
+    //   static size_t next_size(size_t n)  返回不小于 n 的合法桶数（超过上限时返回上限）
+    //   void reset(size_t n)               桶数变为 n 之后调用，可在此预先计算
+    //   size_t index(size_t hash) const    把哈希值映射到 [0, n)
+    // 只用到哈希值低位的策略声明 static constexpr bool needs_mixed_hash = true，
+    // hashtable 对未声明 is_avalanching 的哈希函数先用 hash_mix 混合再交给 index
+    // 查找的每一步都要调用 index，它的代价直接体现在查找吞吐量上
+    /*****************************************************************************************/
+    namespace bucket_detail
+    {
+        // 质数表，相邻两项约为两倍
+        inline constexpr size_t PRIMES[] =
+        {
+            53,         97,           193,         389,       769,
+            1543,       3079,         6151,        12289,     24593,
+            49157,      98317,        196613,      393241,    786433,
+            1572869,    3145739,      6291469,     12582917,  25165843,
+            50331653,   100663319,    201326611,   402653189, 805306457,
+            1610612741, 3221225473ul, 4294967291ul
+        };
+        inline constexpr size_t NUM_PRIMES = sizeof(PRIMES) / sizeof(PRIMES[0]);
+
+        inline size_t next_prime(size_t n) noexcept
+        {
+            for (size_t i = 0; i < NUM_PRIMES; ++i)
+            {
+                if (PRIMES[i] >= n)
+                    return PRIMES[i];
+            }
+            return PRIMES[NUM_PRIMES - 1];
+        }
+    } // namespace bucket_detail
+
+    // 质数桶数，哈希值对桶数取模。对恒等映射的用户哈希也能分布均匀，但 64 位除法需要 20 到 40 个周期
+    struct prime_bucket_policy
+    {
+        static size_t next_size(size_t n) noexcept { return bucket_detail::next_prime(n); }
+
+        void reset(size_t n) noexcept { buckets_ = n; }
+
+        size_t index(size_t hash) const noexcept { return hash % buckets_; }
+
+    private:
+        size_t buckets_ = 1;
+    };
+
+    // 2 的幂桶数，直接取哈希值的低位，只需一次与运算。
+    // 用户提供的哈希函数可能是恒等映射（如 std::hash<int>），不混合的话只用到键的低位，步长为 2 的幂的键会全部落在少数几个桶中，
+    // 所以声明 needs_mixed_hash，由 hashtable 对这类哈希函数先混合一次；mystl::hash 的输出已经混合，不再重复
+    struct power2_bucket_policy
+    {
+        static constexpr bool needs_mixed_hash = true;
+        static constexpr size_t MIN_BUCKETS = 64;
+        static constexpr size_t MAX_BUCKETS = size_t(1) << (sizeof(size_t) * 8 - 2);
+
+        static size_t next_size(size_t n) noexcept
+        {
+            size_t cap = MIN_BUCKETS;
+            while (cap < n && cap < MAX_BUCKETS) cap <<= 1;
+            return cap;
+        }
+
+        void reset(size_t n) noexcept { mask_ = n - 1; }
+
+        size_t index(size_t hash) const noexcept { return hash & mask_; }
+
+    private:
+        size_t mask_ = 0;
+    };
+
+    // 质数桶数，用预先计算的倒数代替除法（Lemire 的 fastmod）：
+    // M = ⌊(2^64 - 1) / d⌋ + 1，a mod d = ((M * a mod 2^64) * d) >> 64，对 32 位的 a 和 d 精确成立。
+    // 桶数都在 32 位以内，64 位哈希值先把高低两半异或折叠成 32 位；没有 128 位整数的平台退回取模
+    struct fast_prime_bucket_policy
+    {
+        static size_t next_size(size_t n) noexcept { return bucket_detail::next_prime(n); }
+
+        void reset(size_t n) noexcept
+        {
+            buckets_ = n;
+            multiplier_ = ~std::uint64_t(0) / n + 1;
+        }
+
+        size_t index(size_t hash) const noexcept
+        {
+            const std::uint64_t h = static_cast<std::uint64_t>(hash);
+            const std::uint32_t folded = static_cast<std::uint32_t>(h ^ (h >> 32));
+#if defined(__SIZEOF_INT128__)
+            const std::uint64_t lowbits = multiplier_ * folded;
+            return static_cast<size_t>((static_cast<unsigned __int128>(lowbits) * buckets_) >> 64);
+#else
+            return static_cast<size_t>(folded % buckets_);
+#endif
+        }
+
+    private:
+        std::uint64_t buckets_ = 1;
+        std::uint64_t multiplier_ = 0;
+    };
+
+    // 桶策略是否要求输入已经混合的哈希值，未声明 needs_mixed_hash 时为 false
+    template <class BucketPolicy, class = void>
+    struct bucket_policy_needs_mixed_hash : mystl::false_type {};
+
+    template <class BucketPolicy>
+    struct bucket_policy_needs_mixed_hash<BucketPolicy, void_t<decltype(BucketPolicy::needs_mixed_hash)>>
+        : mystl::bool_constant<BucketPolicy::needs_mixed_hash> {};
+
+    // 未指定桶策略时使用的默认值
+    using default_bucket_policy = prime_bucket_policy;
+} // namespace mystl
@@ -0,0 +1,765 @@
+#pragma once
+
+#include <initializer_list>
+#include <limits>
+
+#include "expectdef.hpp"
+#include "allocator.hpp"
+#include "iterator.hpp"
+#include "uninitialized.hpp"
+#include "algorithm.hpp"
+
+namespace mystl
+{
+    namespace circular_detail
+    {
+        // 不小于 n 的最小 2 的幂，n 为 0 时返回 1
+        inline size_t round_up_pow2(size_t n) noexcept
+        {
+            size_t cap = 1;
+            while (cap < n) cap <<= 1;
+            return cap;
+        }
+
+        // 对象内部的固定缓冲区，N 为 0 时没有内部缓冲区
+        template <class T, size_t N>
+        struct inline_storage
+        {
+            alignas(T) unsigned char buffer[sizeof(T) * N];
+
+            T* data() noexcept { return reinterpret_cast<T*>(buffer); }
+        };
+
+        template <class T>
+        struct inline_storage<T, 0>
+        {
+            T* data() noexcept { return nullptr; }
+        };
+    } // namespace circular_detail
+
+
+
+    /*****************************************************************************************/
+    // 一段连续存放的元素 [first, last)
+    // 环形缓冲区中的元素在存储空间上最多分成两段，批量读写时分别处理这两段，如整段 write / memcpy
+    /*****************************************************************************************/
+    template <class T>
+    struct circular_buffer_span
+    {
+        T* first;
+        T* last;
+
+        T* begin() const noexcept { return first; }
+        T* end() const noexcept { return last; }
+        size_t size() const noexcept { return static_cast<size_t>(last - first); }
+        bool empty() const noexcept { return first == last; }
+    };
+
+
+
+    /*****************************************************************************************/
+    // circular_buffer 的迭代器
+    // 保存存储空间的起点、容量掩码和不回绕的绝对位置，解引用时用 pos & mask 取得实际下标。
+    // 绝对位置只增不绕，同一容器的迭代器直接按位置比较和相减
+    /*****************************************************************************************/
+    template <class T>
+    class circular_buffer_iterator
+    {
+        template <class U>
+        friend class circular_buffer_iterator;
+
+        template <class Value, size_t N, class Alloc>
+        friend class circular_buffer;
+
+        friend struct segmented_iterator_traits<circular_buffer_iterator>;
+
+    public:
+        // 迭代器类型定义
+        using iterator_category = mystl::random_access_iterator_tag;
+        using value_type = remove_cv_t<T>;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = ptrdiff_t;
+        using size_type = size_t;
+
+        // 构造函数
+        circular_buffer_iterator() noexcept : data(nullptr), mask(0), pos(0) {}
+
+        circular_buffer_iterator(pointer d, size_type m, size_type p) noexcept
+            : data(d), mask(m), pos(p) {}
+
+        // 转换为const迭代器
+        operator circular_buffer_iterator<const T>() const noexcept
+        {
+            return circular_buffer_iterator<const T>(data, mask, pos);
+        }
+
+        // 重载操作符
+        reference operator*() const noexcept { return data[pos & mask]; }
+        pointer operator->() const noexcept { return data + (pos & mask); }
+        reference operator[](difference_type n) const noexcept { return data[(pos + n) & mask]; }
+
+        circular_buffer_iterator& operator++() noexcept { ++pos; return *this; }
+        circular_buffer_iterator& operator--() noexcept { --pos; return *this; }
+
+        circular_buffer_iterator operator++(int) noexcept
+        {
+            circular_buffer_iterator tmp = *this;
+            ++pos;
+            return tmp;
+        }
+
+        circular_buffer_iterator operator--(int) noexcept
+        {
+            circular_buffer_iterator tmp = *this;
+            --pos;
+            return tmp;
+        }
+
+        circular_buffer_iterator& operator+=(difference_type n) noexcept { pos += n; return *this; }
+        circular_buffer_iterator& operator-=(difference_type n) noexcept { pos -= n; return *this; }
+
+        circular_buffer_iterator operator+(difference_type n) const noexcept
+        {
+            return circular_buffer_iterator(data, mask, pos + n);
+        }
+
+        circular_buffer_iterator operator-(difference_type n) const noexcept
+        {
+            return circular_buffer_iterator(data, mask, pos - n);
+        }
+
+        template <class U>
+        difference_type operator-(const circular_buffer_iterator<U>& x) const noexcept
+        {
+            return static_cast<difference_type>(pos - x.pos);
+        }
+
+        // 比较操作符，同一容器的迭代器按绝对位置比较
+        template <class U>
+        bool operator==(const circular_buffer_iterator<U>& rhs) const noexcept { return pos == rhs.pos; }
+
+        template <class U>
+        bool operator!=(const circular_buffer_iterator<U>& rhs) const noexcept { return pos != rhs.pos; }
+
+        template <class U>
+        bool operator<(const circular_buffer_iterator<U>& rhs) const noexcept { return pos < rhs.pos; }
+
+        template <class U>
+        bool operator>(const circular_buffer_iterator<U>& rhs) const noexcept { return pos > rhs.pos; }
+
+        template <class U>
+        bool operator<=(const circular_buffer_iterator<U>& rhs) const noexcept { return pos <= rhs.pos; }
+
+        template <class U>
+        bool operator>=(const circular_buffer_iterator<U>& rhs) const noexcept { return pos >= rhs.pos; }
+
+    private:
+        pointer data;      // 存储空间的起点
+        size_type mask;    // 容量 - 1
+        size_type pos;     // 绝对位置，实际下标为 pos & mask
+    };
+
+    template <class T>
+    circular_buffer_iterator<T> operator+(ptrdiff_t n, const circular_buffer_iterator<T>& it) noexcept
+    {
+        return it + n;
+    }
+
+    // 环形缓冲区按“圈”分块：绝对位置 [k * capacity, (k + 1) * capacity) 为第 k 块，每一块都是同一段存储空间。
+    // 容器中的区间最多跨越两块，copy / fill 等算法对每块整段处理
+    template <class T>
+    struct circular_buffer_segment
+    {
+        T* data;
+        size_t capacity;
+        size_t base;       // 块的起始绝对位置
+
+        circular_buffer_segment& operator++() noexcept { base += capacity; return *this; }
+        circular_buffer_segment& operator--() noexcept { base -= capacity; return *this; }
+        bool operator==(const circular_buffer_segment& rhs) const noexcept { return base == rhs.base; }
+        bool operator!=(const circular_buffer_segment& rhs) const noexcept { return base != rhs.base; }
+    };
+
+    template <class T>
+    struct segmented_iterator_traits<circular_buffer_iterator<T>>
+    {
+        static constexpr bool is_segmented = true;
+
+        using iterator = circular_buffer_iterator<T>;
+        using segment_iterator = circular_buffer_segment<T>;
+        using local_iterator = T*;
+
+        static segment_iterator segment(const iterator& it) noexcept
+        {
+            return segment_iterator{it.data, it.mask + 1, it.pos & ~it.mask};
+        }
+        static local_iterator local(const iterator& it) noexcept { return it.data + (it.pos & it.mask); }
+        static local_iterator begin(const segment_iterator& seg) noexcept { return seg.data; }
+        static local_iterator end(const segment_iterator& seg) noexcept { return seg.data + seg.capacity; }
+    };
+
+
+
+    /*****************************************************************************************/
+    // circular_buffer 的实现
+    // 容量总是 2 的幂，第 i 个元素位于 (head_ + i) & mask_，头尾的插入与删除都是 O(1) 且不移动元素。
+    // N 为 0 时存储空间来自分配器，满了之后按两倍扩容；N 不为 0 时使用对象内部容纳 N 个元素的固定缓冲区，
+    // 不访问分配器，满了之后再插入抛出 length_error。
+    // 覆盖模式（set_overwrite(true)）下容器满时在尾部插入会覆盖最旧的元素（头部插入覆盖最新的元素），容量不再变化
+    /*****************************************************************************************/
+    template <class T, size_t N = 0, class Allocator = mystl::allocator<T>>
+    class circular_buffer
+    {
+        static_assert((N & (N - 1)) == 0, "circular_buffer capacity must be a power of two");
+
+    public:
+        //------------------------------------------------------------------------------
+        // 类型定义
+        //------------------------------------------------------------------------------
+        using value_type = typename Allocator::value_type;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = typename allocator_type::reference;
+        using const_reference = typename allocator_type::const_reference;
+        using pointer = typename allocator_type::pointer;
+        using const_pointer = typename allocator_type::const_pointer;
+
+        using iterator = circular_buffer_iterator<value_type>;
+        using const_iterator = circular_buffer_iterator<const value_type>;
+        using reverse_iterator = mystl::reverse_iterator<iterator>;
+        using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;
+
+        using span = circular_buffer_span<value_type>;
+        using const_span = circular_buffer_span<const value_type>;
+
+        static constexpr size_type inline_capacity = N;   // 固定容量，为 0 时容量可变
+        static constexpr size_type INIT_CAPACITY = 16;    // 可变容量第一次分配的元素个数
+
+    private:
+        //------------------------------------------------------------------------------
+        // 成员变量
+        //------------------------------------------------------------------------------
+        pointer data_;          // 存储空间，N 不为 0 时指向内部缓冲区
+        size_type mask_;        // 容量 - 1，没有存储空间时为 0
+        size_type head_;        // 第一个元素的实际下标
+        size_type size_;        // 元素个数
+        bool overwrite_;        // 容器满时是否覆盖另一端的元素
+        allocator_type alloc_;  // 内存分配器实例，只用于 N 为 0 的情况
+        circular_detail::inline_storage<value_type, N> inline_;
+
+    public:
+        //------------------------------------------------------------------------------
+        // 构造/析构函数
+        //------------------------------------------------------------------------------
+
+        // 默认构造函数：N 为 0 时不分配内存，第一次插入时分配
+        // inline_ 声明在最后（热字段在前），data_ 在函数体内指向它，避免使用尚未初始化的成员
+        circular_buffer() noexcept
+            : mask_(N == 0 ? 0 : N - 1), head_(0), size_(0), overwrite_(false)
+        {
+            data_ = inline_.data();
+        }
+
+        explicit circular_buffer(const allocator_type& alloc) noexcept
+            : mask_(N == 0 ? 0 : N - 1), head_(0), size_(0), overwrite_(false), alloc_(alloc)
+        {
+            data_ = inline_.data();
+        }
+
+        // 预留至少 capacity 个元素的空间（向上取整为 2 的幂），注意参数是容量而不是元素个数
+        explicit circular_buffer(size_type capacity, const allocator_type& alloc = allocator_type())
+            : circular_buffer(alloc)
+        {
+            reserve(capacity);
+        }
+
+        // 迭代器范围构造
+        template <class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        circular_buffer(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : circular_buffer(alloc)
+        {
+            append(first, last);
+        }
+
+        circular_buffer(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : circular_buffer(alloc)
+        {
+            append(init.begin(), init.end());
+        }
+
+        // 深拷贝：保持相同的容量与覆盖模式
+        circular_buffer(const circular_buffer& other)
+            : circular_buffer(other.alloc_)
+        {
+            overwrite_ = other.overwrite_;
+            reserve(other.capacity());
+            append(other.begin(), other.end());
+        }
+
+        // 移动构造：N 为 0 时直接接管存储空间，否则逐个移动元素
+        circular_buffer(circular_buffer&& other) noexcept(N == 0 || is_nothrow_move_constructible<T>::value)
+            : circular_buffer(other.alloc_)
+        {
+            take_from(other);
+        }
+
+        ~circular_buffer()
+        {
+            clear();
+            release_storage();
+        }
+
+        //------------------------------------------------------------------------------
+        // 赋值操作
+        //------------------------------------------------------------------------------
+
+        circular_buffer& operator=(const circular_buffer& other)
+        {
+            if (this != &other)
+            {
+                circular_buffer tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        circular_buffer& operator=(circular_buffer&& other) noexcept(N == 0 || is_nothrow_move_constructible<T>::value)
+        {
+            if (this != &other)
+            {
+                clear();
+                release_storage();
+                take_from(other);
+            }
+            return *this;
+        }
+
+        circular_buffer& operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            append(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 迭代器
+        //------------------------------------------------------------------------------
+
+        iterator begin() noexcept { return iterator(data_, mask_, head_); }
+        const_iterator begin() const noexcept { return const_iterator(data_, mask_, head_); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator(data_, mask_, head_ + size_); }
+        const_iterator end() const noexcept { return const_iterator(data_, mask_, head_ + size_); }
+        const_iterator cend() const noexcept { return end(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return rend(); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 元素访问
+        //------------------------------------------------------------------------------
+
+        reference operator[](size_type pos) { return data_[(head_ + pos) & mask_]; }
+        const_reference operator[](size_type pos) const { return data_[(head_ + pos) & mask_]; }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("circular_buffer::at");
+            }
+            return (*this)[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("circular_buffer::at");
+            }
+            return (*this)[pos];
+        }
+
+        reference front() { return data_[head_]; }
+        const_reference front() const { return data_[head_]; }
+
+        reference back() { return data_[(head_ + size_ - 1) & mask_]; }
+        const_reference back() const { return data_[(head_ + size_ - 1) & mask_]; }
+
+        // 元素按存储顺序分成的两段：第一段从 front() 开始，第二段（可能为空）从存储空间起点开始
+        span array_one() noexcept { return span{data_ + head_, data_ + head_ + first_span_size()}; }
+        const_span array_one() const noexcept { return const_span{data_ + head_, data_ + head_ + first_span_size()}; }
+
+        span array_two() noexcept { return span{data_, data_ + (size_ - first_span_size())}; }
+        const_span array_two() const noexcept { return const_span{data_, data_ + (size_ - first_span_size())}; }
+
+
+
+        //------------------------------------------------------------------------------
+        // 容量操作
+        //------------------------------------------------------------------------------
+
+        bool empty() const noexcept { return size_ == 0; }
+        bool full() const noexcept { return size_ == capacity(); }
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return data_ == nullptr ? 0 : mask_ + 1; }
+
+        size_type max_size() const noexcept
+        {
+            if (N != 0) return N;
+            // 容量必须是 2 的幂
+            size_type limit = mystl::max_size(alloc_);
+            size_type cap = size_type(1) << (std::numeric_limits<size_type>::digits - 1);
+            while (cap > limit) cap >>= 1;
+            return cap;
+        }
+
+        // 保证容量至少为 new_cap；固定容量的缓冲区无法扩大，超出时抛出 length_error
+        void reserve(size_type new_cap)
+        {
+            if (new_cap <= capacity()) return;
+            if (N != 0 || new_cap > max_size())
+            {
+                throw length_error("circular_buffer::reserve");
+            }
+            reallocate(circular_detail::round_up_pow2(new_cap));
+        }
+
+        // 覆盖模式
+        bool overwrite() const noexcept { return overwrite_; }
+        void set_overwrite(bool on) noexcept { overwrite_ = on; }
+
+
+
+        //------------------------------------------------------------------------------
+        // 修改器
+        //------------------------------------------------------------------------------
+
+        // 清空所有元素，保留存储空间
+        void clear() noexcept
+        {
+            pop_front(size_);
+            head_ = 0;
+        }
+
+        // 在尾部构造元素
+        template <class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (size_ == capacity())
+            {
+                if (overwrite_ && size_ != 0)
+                {
+                    // 最旧元素的位置正是新的队尾：赋值覆盖后头部后移一格
+                    pointer slot = data_ + head_;
+                    *slot = value_type(mystl::forward<Args>(args)...);
+                    head_ = (head_ + 1) & mask_;
+                    return *slot;
+                }
+                grow_emplace(false, mystl::forward<Args>(args)...);
+                return back();
+            }
+            mystl::construct(data_ + ((head_ + size_) & mask_), mystl::forward<Args>(args)...);
+            ++size_;
+            return back();
+        }
+
+        // 在头部构造元素
+        template <class... Args>
+        reference emplace_front(Args&&... args)
+        {
+            if (size_ == capacity())
+            {
+                if (overwrite_ && size_ != 0)
+                {
+                    // 覆盖最新的元素，它的位置成为新的头部
+                    pointer slot = data_ + ((head_ + size_ - 1) & mask_);
+                    *slot = value_type(mystl::forward<Args>(args)...);
+                    head_ = (head_ - 1) & mask_;
+                    return *slot;
+                }
+                grow_emplace(true, mystl::forward<Args>(args)...);
+                return front();
+            }
+            const size_type new_head = (head_ - 1) & mask_;
+            mystl::construct(data_ + new_head, mystl::forward<Args>(args)...);
+            head_ = new_head;
+            ++size_;
+            return front();
+        }
+
+        void push_back(const value_type& value) { emplace_back(value); }
+        void push_back(value_type&& value) { emplace_back(mystl::move(value)); }
+        void push_front(const value_type& value) { emplace_front(value); }
+        void push_front(value_type&& value) { emplace_front(mystl::move(value)); }
+
+        void pop_front()
+        {
+            if (empty()) return;
+            mystl::destroy_at(data_ + head_);
+            head_ = (head_ + 1) & mask_;
+            --size_;
+        }
+
+        // 删除头部的 n 个元素（n 不超过 size()），批量读取 array_one / array_two 之后调用
+        void pop_front(size_type n) noexcept
+        {
+            if constexpr (!is_trivially_destructible<value_type>::value)
+            {
+                for (size_type i = 0; i < n; ++i)
+                {
+                    mystl::destroy_at(data_ + ((head_ + i) & mask_));
+                }
+            }
+            head_ = (head_ + n) & mask_;
+            size_ -= n;
+        }
+
+        void pop_back()
+        {
+            if (empty()) return;
+            mystl::destroy_at(data_ + ((head_ + size_ - 1) & mask_));
+            --size_;
+        }
+
+        // 在尾部追加 [first, last)。前向迭代器且空间足够（或可以扩容）时一次预留，
+        // 再整段构造到尾部的两段空闲空间中，可平凡复制的元素最多两次 memmove；
+        // 覆盖模式下放不下时逐个插入，最旧的元素依次被覆盖
+        template <class InputIt>
+        void append(InputIt first, InputIt last)
+        {
+            if constexpr (is_forward_iterator<InputIt>::value)
+            {
+                const size_type n = static_cast<size_type>(mystl::distance(first, last));
+                if (!overwrite_ || size_ + n <= capacity())
+                {
+                    if (size_ + n > capacity())
+                    {
+                        if (N != 0)
+                        {
+                            throw length_error("circular_buffer is full");
+                        }
+                        reserve(size_ + n);
+                    }
+                    mystl::uninitialized_copy(first, last, end());
+                    size_ += n;
+                    return;
+                }
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        void swap(circular_buffer& other) noexcept(N == 0 || is_nothrow_move_constructible<T>::value)
+        {
+            if (this == &other) return;
+            if constexpr (N == 0)
+            {
+                mystl::swap(data_, other.data_);
+                mystl::swap(mask_, other.mask_);
+                mystl::swap(head_, other.head_);
+                mystl::swap(size_, other.size_);
+                mystl::swap(overwrite_, other.overwrite_);
+                mystl::swap(alloc_, other.alloc_);
+            }
+            else
+            {
+                circular_buffer tmp(mystl::move(other));
+                other = mystl::move(*this);
+                *this = mystl::move(tmp);
+            }
+        }
+
+        allocator_type get_allocator() const noexcept { return alloc_; }
+
+    private:
+        //------------------------------------------------------------------------------
+        // 辅助函数
+        //------------------------------------------------------------------------------
+
+        // 第一段（从 head_ 到存储空间末尾或最后一个元素）的元素个数
+        size_type first_span_size() const noexcept
+        {
+            const size_type to_end = capacity() - head_;
+            return size_ < to_end ? size_ : to_end;
+        }
+
+        void release_storage() noexcept
+        {
+            if (N == 0 && data_ != nullptr)
+            {
+                alloc_.deallocate(data_, mask_ + 1);
+                data_ = nullptr;
+                mask_ = 0;
+            }
+        }
+
+        // 接管 other 的内容（要求自身为空且没有动态存储空间）
+        void take_from(circular_buffer& other) noexcept(N == 0 || is_nothrow_move_constructible<T>::value)
+        {
+            overwrite_ = other.overwrite_;
+            if constexpr (N == 0)
+            {
+                data_ = other.data_;
+                mask_ = other.mask_;
+                head_ = other.head_;
+                size_ = other.size_;
+                alloc_ = other.alloc_;
+                other.data_ = nullptr;
+                other.mask_ = 0;
+                other.head_ = 0;
+                other.size_ = 0;
+            }
+            else
+            {
+                head_ = 0;
+                for (auto it = other.begin(); it != other.end(); ++it)
+                {
+                    mystl::construct(data_ + size_, mystl::move(*it));
+                    ++size_;
+                }
+                other.clear();
+            }
+        }
+
+        // 把元素按逻辑顺序搬到容量为 new_cap 的新空间中 [offset, offset + size_)，任一步失败时原数据不变
+        pointer move_to_new_storage(size_type new_cap, size_type offset)
+        {
+            pointer new_data = alloc_.allocate(new_cap);
+            pointer cur = new_data + offset;
+            try
+            {
+                span one = array_one();
+                span two = array_two();
+                cur = mystl::uninitialized_move_if_noexcept(one.first, one.last, cur);
+                mystl::uninitialized_move_if_noexcept(two.first, two.last, cur);
+            }
+            catch (...)
+            {
+                mystl::destroy(new_data + offset, cur);
+                alloc_.deallocate(new_data, new_cap);
+                throw;
+            }
+            return new_data;
+        }
+
+        // 销毁原有元素并改用 new_data，第一个元素位于 new_head
+        void adopt(pointer new_data, size_type new_cap, size_type new_head) noexcept
+        {
+            const size_type count = size_;
+            pop_front(size_);
+            release_storage();
+            data_ = new_data;
+            mask_ = new_cap - 1;
+            head_ = new_head;
+            size_ = count;
+        }
+
+        void reallocate(size_type new_cap)
+        {
+            adopt(move_to_new_storage(new_cap, 0), new_cap, 0);
+        }
+
+        // 容器已满时插入：固定容量抛出异常；否则扩容为两倍，
+        // 先在新空间构造新元素（参数可能引用本容器中的元素），再搬迁原有元素
+        template <class... Args>
+        void grow_emplace(bool at_front, Args&&... args)
+        {
+            if constexpr (N != 0)
+            {
+                throw length_error("circular_buffer is full");
+            }
+            else
+            {
+                const size_type cap = capacity();
+                if (cap >= max_size())
+                {
+                    throw length_error("circular_buffer::emplace");
+                }
+                const size_type new_cap = cap == 0 ? size_type(INIT_CAPACITY) : cap * 2;
+                // 头部插入时新元素放在新空间末尾，原有元素从下标 0 开始，逻辑上首尾相接
+                const size_type slot = at_front ? new_cap - 1 : size_;
+                value_type tmp(mystl::forward<Args>(args)...);
+                pointer new_data = move_to_new_storage(new_cap, 0);
+                try
+                {
+                    mystl::construct(new_data + slot, mystl::move(tmp));
+                }
+                catch (...)
+                {
+                    mystl::destroy(new_data, new_data + size_);
+                    alloc_.deallocate(new_data, new_cap);
+                    throw;
+                }
+                adopt(new_data, new_cap, at_front ? slot : 0);
+                ++size_;
+            }
+        }
+    };
+
+    // 固定容量的环形缓冲区，元素存放在对象内部
+    template <class T, size_t N>
+    using ring_buffer = circular_buffer<T, N>;
+
+
+
+    //------------------------------------------------------------------------------
+    // 非成员函数
+    //------------------------------------------------------------------------------
+
+    template <class T, size_t N, class Alloc>
+    bool operator==(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, size_t N, class Alloc>
+    bool operator!=(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, size_t N, class Alloc>
+    bool operator<(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, size_t N, class Alloc>
+    bool operator>(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, size_t N, class Alloc>
+    bool operator<=(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, size_t N, class Alloc>
+    bool operator>=(const circular_buffer<T, N, Alloc>& lhs, const circular_buffer<T, N, Alloc>& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, size_t N, class Alloc>
+    void swap(circular_buffer<T, N, Alloc>& lhs, circular_buffer<T, N, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
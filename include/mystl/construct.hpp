@@ -17,6 +17,16 @@ namespace mystl
         ::new ((void*)ptr) T();
     }
 
+    // 默认初始化（而非值初始化）：平凡类型不写内存，内容不确定
+    struct default_init_t { explicit default_init_t() = default; };
+    inline constexpr default_init_t default_init{};
+
+    template <class T>
+    void construct(T* ptr, default_init_t) 
+    {
+        ::new ((void*)ptr) T;
+    }
+
     // 可解引用类型版本 - 无参数
     template <class T>
     typename enable_if<!is_pointer<T>::value && is_dereferenceable<T>::value>::type
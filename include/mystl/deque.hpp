@@ -11,20 +11,26 @@
 namespace mystl 
 {
 
-    // 设置 buffer 大小
-    inline size_t deque_buf_size(size_t size) 
+    // 设置 buffer 大小：默认每个缓冲区 512 字节，元素超过 512 字节时每个缓冲区只放一个元素
+    constexpr size_t deque_buf_size(size_t size) noexcept
     {
         return size < 512 ? size_t(512 / size) : size_t(1);
     }
 
+    // BufSize 为每个缓冲区的元素个数，为 0 时使用默认大小
+    constexpr size_t deque_buf_size(size_t buf_size, size_t size) noexcept
+    {
+        return buf_size != 0 ? buf_size : deque_buf_size(size);
+    }
+
     // deque 的迭代器设计
-    template <class T>
+    template <class T, size_t BufSize = 0>
     class deque_iterator 
     {
-        template <class U>
+        template <class U, size_t N>
         friend class deque_iterator;  // 允许不同类型迭代器互相访问
 
-        template <class Value, class Alloc>
+        template <class Value, class Alloc, size_t N>
         friend class deque;  // 保留 deque 作为友元
 
     public:
@@ -64,9 +70,9 @@ namespace mystl
         }
 
         // 转换为const迭代器
-        operator deque_iterator<const T>() const noexcept
+        operator deque_iterator<const T, BufSize>() const noexcept
         {
-            return deque_iterator<const T>(static_cast<const T*>(cur), 
+            return deque_iterator<const T, BufSize>(static_cast<const T*>(cur), 
                                            static_cast<const T*>(first),
                                            static_cast<const T*>(last),
                                            const_cast<const_map_pointer>(node));
@@ -74,7 +80,7 @@ namespace mystl
 
         // 从const_iterator到iterator的隐式转换
         template <class U>
-        deque_iterator(const deque_iterator<U>& other, typename enable_if<is_same<U, const T>::value>::type* = nullptr)
+        deque_iterator(const deque_iterator<U, BufSize>& other, typename enable_if<is_same<U, const T>::value>::type* = nullptr)
             : cur(const_cast<pointer>(other.cur)), 
               first(const_cast<pointer>(other.first)),
               last(const_cast<pointer>(other.last)),
@@ -226,9 +232,9 @@ namespace mystl
         map_pointer node;      // 指向控制中心
 
         // 私有辅助函数
-        static size_type buffer_size() noexcept
+        static constexpr size_type buffer_size() noexcept
         {
-            return deque_buf_size(sizeof(value_type));
+            return deque_buf_size(BufSize, sizeof(value_type));
         }
 
         void set_node(map_pointer new_node) noexcept
@@ -239,12 +245,35 @@ namespace mystl
         }
     };
 
+    // deque 的迭代器按缓冲区分块：块迭代器是 map 指针，块内是原生指针
+    template <class T, size_t BufSize>
+    struct segmented_iterator_traits<deque_iterator<T, BufSize>>
+    {
+        static constexpr bool is_segmented = true;
+
+        using iterator = deque_iterator<T, BufSize>;
+        using segment_iterator = typename iterator::map_pointer;
+        using local_iterator = typename iterator::pointer;
+
+        static segment_iterator segment(const iterator& it) noexcept { return it.get_node(); }
+        static local_iterator local(const iterator& it) noexcept { return it.get_cur(); }
+        static local_iterator begin(segment_iterator seg) noexcept { return *seg; }
+        static local_iterator end(segment_iterator seg) noexcept
+        {
+            return *seg + deque_buf_size(BufSize, sizeof(T));
+        }
+    };
+
 
 
     /*****************************************************************************************/
     // deque 的实现
+    // BufSize 为每个缓冲区容纳的元素个数，为 0 时每个缓冲区约 512 字节；
+    // 大元素（如数百字节的消息）默认每个缓冲区只有一个元素，可以用 BufSize 放大缓冲区。
+    // 头尾弹出后变空的缓冲区先放入备用缓存（最多 MAX_SPARE_BLOCKS 个），两端需要新缓冲区时优先取用，
+    // 队列式的稳定流量（一端 push、另一端 pop）不再反复调用分配器
     /*****************************************************************************************/ 
-    template <class T, class Allocator = mystl::allocator<T>>
+    template <class T, class Allocator = mystl::allocator<T>, size_t BufSize = 0>
     class deque 
     {
     public:
@@ -258,8 +287,8 @@ namespace mystl
         using pointer = typename allocator_type::pointer;
         using const_pointer = typename allocator_type::const_pointer;
         
-        using iterator = deque_iterator<value_type>;
-        using const_iterator = deque_iterator<const value_type>;
+        using iterator = deque_iterator<value_type, BufSize>;
+        using const_iterator = deque_iterator<const value_type, BufSize>;
         using reverse_iterator = mystl::reverse_iterator<iterator>;
         using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;  
         
@@ -272,6 +301,10 @@ namespace mystl
         iterator finish_;          // 指向最后一个元素的下一个位置
         map_pointer map_;         // 控制中心，存储缓冲区的地址
         size_type map_size_;      // 控制中心大小
+
+        static constexpr size_type MAX_SPARE_BLOCKS = 2;   // 备用缓冲区的最大个数
+        pointer spare_[MAX_SPARE_BLOCKS] = {};             // 已分配但未使用的缓冲区
+        size_type spare_count_ = 0;                        // 备用缓冲区的个数
         
         // 分配器
         allocator_type alloc_;    // 元素分配器
@@ -287,7 +320,15 @@ namespace mystl
             create_map_and_nodes(0);
         }
 
-        explicit deque(size_type count) 
+        // 使用指定的分配器构造空 deque
+        explicit deque(const allocator_type& alloc)
+            : map_(nullptr), map_size_(0), alloc_(alloc), map_alloc_(alloc)
+        {
+            create_map_and_nodes(0);
+        }
+
+        explicit deque(size_type count, const allocator_type& alloc = allocator_type()) 
+            : alloc_(alloc), map_alloc_(alloc)
         {
             create_map_and_nodes(count);
             try 
@@ -307,7 +348,8 @@ namespace mystl
             }
         }
 
-        deque(size_type count, const T& value) 
+        deque(size_type count, const T& value, const allocator_type& alloc = allocator_type()) 
+            : alloc_(alloc), map_alloc_(alloc)
         {
             create_map_and_nodes(count);
             try 
@@ -328,8 +370,9 @@ namespace mystl
 
         // 迭代器范围构造函数
         template <class InputIt>
-        deque(InputIt first, InputIt last,
+        deque(InputIt first, InputIt last, const allocator_type& alloc = allocator_type(),
               typename enable_if<!is_integral<InputIt>::value>::type* = nullptr)
+            : alloc_(alloc), map_alloc_(alloc)
         {
             create_map_and_nodes(mystl::distance(first, last));
             try 
@@ -349,7 +392,8 @@ namespace mystl
         }
 
         // 添加初始化列表构造函数
-        deque(std::initializer_list<T> init)
+        deque(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc), map_alloc_(alloc)
         {
             create_map_and_nodes(init.size());
             try 
@@ -369,6 +413,7 @@ namespace mystl
         }
 
         deque(const deque& other)
+            : alloc_(other.alloc_), map_alloc_(other.map_alloc_)
         {
             create_map_and_nodes(other.size());
             try 
@@ -391,18 +436,29 @@ namespace mystl
             : start_(other.start_),
               finish_(other.finish_),
               map_(other.map_),
-              map_size_(other.map_size_)
+              map_size_(other.map_size_),
+              alloc_(other.alloc_),
+              map_alloc_(other.map_alloc_)
         {
             other.start_ = iterator();
             other.finish_ = iterator();
             other.map_ = nullptr;
             other.map_size_ = 0;
+            for (size_type i = 0; i < other.spare_count_; ++i) spare_[i] = other.spare_[i];
+            spare_count_ = other.spare_count_;
+            other.spare_count_ = 0;
         }
 
         ~deque() 
         {
             clear();
-            map_alloc_.deallocate(map_, map_size_);
+            release_spare_blocks();
+            if (map_ != nullptr)
+            {
+                // clear() 保留了起始缓冲区，这里一并释放
+                alloc_.deallocate(*start_.node, buffer_size());
+                map_alloc_.deallocate(map_, map_size_);
+            }
         }   
 
 
@@ -491,7 +547,7 @@ namespace mystl
         {
             // 考虑三个限制因素：
             // 1. 分配器的限制
-            size_type alloc_max = mystl::allocator<T>().max_size();
+            size_type alloc_max = alloc_.max_size();
             
             // 2. difference_type的限制（通常是ptrdiff_t）
             size_type diff_max = std::numeric_limits<difference_type>::max();
@@ -577,6 +633,7 @@ namespace mystl
                     throw;
                 }
             }
+            release_spare_blocks();  // 备用缓冲区一并释放
         }
 
 
@@ -635,7 +692,7 @@ namespace mystl
             for (map_pointer node = start_.node + 1; node < finish_.node; ++node) 
             {
                 mystl::destroy(*node, *node + buffer_size());  // 直接使用 destroy
-                alloc_.deallocate(*node, buffer_size());
+                deallocate_block(*node);
             }
 
             if (start_.node != finish_.node) 
@@ -643,7 +700,7 @@ namespace mystl
                 // 有多个缓冲区时
                 mystl::destroy(start_.cur, start_.last);
                 mystl::destroy(finish_.first, finish_.cur);
-                alloc_.deallocate(*finish_.node, buffer_size());
+                deallocate_block(*finish_.node);
             }
             else 
             {
@@ -684,79 +741,43 @@ namespace mystl
         // 在pos位置插入n个元素
         iterator insert(iterator pos, size_type n, const T& value)
         {
+            const difference_type elems_before = pos - start_;
             if (n == 0) return pos;
-            
-            const size_type elems_before = pos - start_;
-            if (elems_before < size() / 2)
+
+            if (pos.cur == start_.cur)
             {
-                // 在前半段插入
+                // 在头部插入：直接在前端预留的空间上构造
                 iterator new_start = reserve_elements_at_front(n);
-                iterator old_start = start_;
-                
-                try 
+                try
                 {
-                    // 先复制原有元素
-                    mystl::uninitialized_copy(old_start, pos, new_start);
-                    try 
-                    {
-                        // 再填充新元素
-                        mystl::fill_n(new_start + elems_before, n, value);
-                    }
-                    catch (...) 
-                    {
-                        // 如果填充失败：
-                        // 把原始数据写回原来的位置
-                        mystl::copy(new_start, new_start + elems_before, old_start);
-                        // 销毁新位置的数据
-                        mystl::destroy(new_start, new_start + elems_before);
-                        // 释放新分配的内存
-                        destroy_nodes_at_front(new_start);
-                        throw;
-                    }
+                    mystl::uninitialized_fill(new_start, start_, value);
                 }
-                catch (...) 
+                catch (...)
                 {
                     destroy_nodes_at_front(new_start);
                     throw;
                 }
-                start_ = new_start;  // 所有操作都成功后才更新start_
+                start_ = new_start;
             }
-            else 
+            else if (pos.cur == finish_.cur)
             {
-                // 在后半段插入
+                // 在尾部插入
                 iterator new_finish = reserve_elements_at_back(n);
-                iterator old_finish = finish_;
-                
-                try 
+                try
                 {
-                    // 先移动后面的元素
-                    mystl::uninitialized_copy(pos, old_finish, finish_ + n);
-                    try 
-                    {
-                        // 再填充新元素
-                        mystl::fill_n(pos, n, value);
-                    }
-                    catch (...) 
-                    {
-                        // 如果填充失败：
-                        // 把原始数据写回原来的位置
-                        mystl::copy(finish_ + n, finish_ + n + (old_finish - pos), iterator(pos));
-                        // 销毁新位置的数据
-                        mystl::destroy(finish_ + n, finish_ + n + (old_finish - pos));
-                        // 释放新分配的内存
-                        destroy_nodes_at_back(new_finish);
-                        throw;
-                    }
+                    mystl::uninitialized_fill(finish_, new_finish, value);
                 }
-                catch (...) 
+                catch (...)
                 {
                     destroy_nodes_at_back(new_finish);
                     throw;
                 }
-                
-                finish_ = finish_ + n;  // 所有操作都成功后才更新finish_
+                finish_ = new_finish;
+            }
+            else
+            {
+                fill_insert_aux(pos, n, value);
             }
-            
             return start_ + elems_before;
         }
 
@@ -765,80 +786,53 @@ namespace mystl
         iterator insert(iterator pos, InputIt first, InputIt last,
                         typename enable_if<!is_integral<InputIt>::value>::type* = nullptr)
         {
-            if (first == last) return pos;
-            
-            const size_type n = mystl::distance(first, last);
-            const size_type elems_before = pos - start_;
-            
-            if (elems_before < size() / 2)
+            const difference_type elems_before = pos - start_;
+            if constexpr (!is_forward_iterator<InputIt>::value)
             {
-                // 在前半段插入
-                iterator new_start = reserve_elements_at_front(n);
-                iterator old_start = start_;
-                
-                try 
+                // 输入迭代器只能遍历一次，逐个插入
+                for (; first != last; ++first, ++pos)
                 {
-                    // 先复制原有元素
-                    mystl::uninitialized_copy(old_start, pos, new_start);
-                    try 
+                    pos = insert(pos, *first);
+                }
+            }
+            else
+            {
+                const size_type n = mystl::distance(first, last);
+                if (n == 0) return pos;
+
+                if (pos.cur == start_.cur)
+                {
+                    iterator new_start = reserve_elements_at_front(n);
+                    try
                     {
-                        // 再插入新元素
-                        mystl::uninitialized_copy(first, last, new_start + elems_before);
+                        mystl::uninitialized_copy(first, last, new_start);
                     }
-                    catch (...) 
+                    catch (...)
                     {
-                        // 把原始数据写回原来的位置
-                        mystl::copy(new_start, new_start + elems_before, old_start);
-                        // 销毁新位置的数据
-                        mystl::destroy(new_start, new_start + elems_before);
-                        // 释放新分配的内存
                         destroy_nodes_at_front(new_start);
                         throw;
                     }
+                    start_ = new_start;
                 }
-                catch (...) 
-                {
-                    destroy_nodes_at_front(new_start);
-                    throw;
-                }
-                
-                start_ = new_start;  // 所有操作都成功后才更新start_
-            }
-            else 
-            {
-                // 在后半段插入
-                iterator new_finish = reserve_elements_at_back(n);
-                iterator old_finish = finish_;
-                
-                try 
+                else if (pos.cur == finish_.cur)
                 {
-                    // 先移动后面的元素
-                    mystl::uninitialized_copy(pos, old_finish, finish_ + n);
-                    try 
+                    iterator new_finish = reserve_elements_at_back(n);
+                    try
                     {
-                        // 再插入新元素
-                        mystl::uninitialized_copy(first, last, pos);
+                        mystl::uninitialized_copy(first, last, finish_);
                     }
-                    catch (...) 
+                    catch (...)
                     {
-                        // 把原始数据写回原来的位置
-                        mystl::copy(finish_ + n, finish_ + n + (old_finish - pos), pos);
-                        // 销毁新位置的数据
-                        mystl::destroy(finish_ + n, finish_ + n + (old_finish - pos));
-                        // 释放新分配的内存
                         destroy_nodes_at_back(new_finish);
                         throw;
                     }
+                    finish_ = new_finish;
                 }
-                catch (...) 
+                else
                 {
-                    destroy_nodes_at_back(new_finish);
-                    throw;
+                    range_insert_aux(pos, first, last, n);
                 }
-                
-                finish_ = finish_ + n;  // 所有操作都成功后才更新finish_
             }
-            
             return start_ + elems_before;
         }
 
@@ -850,80 +844,21 @@ namespace mystl
 
 
         // 在指定位置就地构造元素
+        // 头尾直接在空闲位置构造；中间位置先构造临时对象，再按单个元素插入
         template <class... Args>
         iterator emplace(iterator pos, Args&&... args)
         {
-            const size_type elems_before = pos - start_;
-            if (elems_before < size() / 2)
+            if (pos.cur == start_.cur)
             {
-                // 在前半段插入
-                iterator new_start = reserve_elements_at_front(1);
-                iterator old_start = start_;
-                
-                try 
-                {
-                    // 先复制原有元素
-                    mystl::uninitialized_copy(old_start, pos, new_start);
-                    try 
-                    {
-                        // 直接在位置构造新元素
-                        mystl::construct(new_start.cur + elems_before, mystl::forward<Args>(args)...);
-                    }
-                    catch (...) 
-                    {
-                        // 把原始数据写回原来的位置
-                        mystl::copy(new_start, new_start + elems_before, old_start);
-                        // 销毁新位置的数据
-                        mystl::destroy(new_start, new_start + elems_before);
-                        // 释放新分配的内存
-                        destroy_nodes_at_front(new_start);
-                        throw;
-                    }
-                }
-                catch (...) 
-                {
-                    destroy_nodes_at_front(new_start);
-                    throw;
-                }
-                
-                start_ = new_start;  // 所有操作都成功后才更新start_
+                push_front_aux(mystl::forward<Args>(args)...);
+                return start_;
             }
-            else 
+            else if (pos.cur == finish_.cur)
             {
-                // 在后半段插入
-                iterator new_finish = reserve_elements_at_back(1);
-                iterator old_finish = finish_;
-                
-                try 
-                {
-                    // 先移动后面的元素
-                    mystl::uninitialized_copy(pos, old_finish, finish_ + 1);
-                    try 
-                    {
-                        // 直接在位置构造新元素
-                        mystl::construct(pos.cur, mystl::forward<Args>(args)...);
-                    }
-                    catch (...) 
-                    {
-                        // 把原始数据写回原来的位置
-                        mystl::copy(finish_ + 1, finish_ + 1 + (old_finish - pos), pos);
-                        // 销毁新位置的数据
-                        mystl::destroy(finish_ + 1, finish_ + 1 + (old_finish - pos));
-                        // 释放新分配的内存
-                        destroy_nodes_at_back(new_finish);
-                        throw;
-                    }
-                }
-                catch (...) 
-                {
-                    destroy_nodes_at_back(new_finish);
-                    throw;
-                }
-                
-                finish_ = finish_ + 1;  // 所有操作都成功后才更新finish_
+                push_back_aux(mystl::forward<Args>(args)...);
+                return finish_ - 1;
             }
-            
-            return start_ + elems_before;
+            return insert_aux(pos, value_type(mystl::forward<Args>(args)...));
         }
 
         // 在尾部就地构造元素
@@ -969,8 +904,8 @@ namespace mystl
             // 如果当前缓冲区为空，需要释放它
             if (finish_.cur == finish_.first)
             {
-                // 释放缓冲区
-                alloc_.deallocate(finish_.first, buffer_size());
+                // 释放缓冲区（优先放入备用缓存）
+                deallocate_block(finish_.first);
                 // 移动到前一个缓冲区
                 finish_.set_node(finish_.node - 1);
                 finish_.cur = finish_.last;
@@ -989,10 +924,10 @@ namespace mystl
             //这里需要先++start_.cur，再判断是否为空
             ++start_.cur;
             
-            // 如果当前缓冲区为空，需要释放
+            // 如果当前缓冲区为空，需要释放（优先放入备用缓存）
             if (start_.cur == start_.last) 
             {
-                alloc_.deallocate(start_.first, buffer_size());
+                deallocate_block(start_.first);
                 start_.set_node(start_.node + 1);
                 start_.cur = start_.first;
             } 
@@ -1002,56 +937,43 @@ namespace mystl
         // 删除pos位置的元素
         iterator erase(iterator pos)
         {
-            iterator next = pos;
-            ++next;
-            
-            difference_type elems_after = end() - next;
-            if (elems_after > 0)
-            {
-                // 如果不是最后一个元素，需要逐个移动后面的元素
-                for (iterator curr = pos; curr != end() - 1; ++curr)
-                {
-                    *curr = mystl::move(*(curr + 1));
-                }
-            }
-            
-            // 销毁最后一个元素
-            mystl::destroy_at(finish_.cur - 1);
-            --finish_;
-            
-            return next == end() ? end() : pos;  // 如果删除的是最后一个元素，返回end()，否则返回pos
+            return erase(pos, pos + 1);
         }
 
         // 删除[first, last)范围内的元素
+        // 移动前后两段中较短的一段去填补空缺，空出的缓冲区归还（优先放入备用缓存）
         iterator erase(iterator first, iterator last)
         {
             if (first == last)
                 return first;
 
-            // 计算要移动的元素个数和要删除的元素个数
-            difference_type elems_after = end() - last;
-            difference_type n = last - first;
-            iterator new_finish = first + elems_after;
-            
-            if (elems_after > 0)
+            const difference_type n = last - first;
+            const difference_type elems_before = first - start_;
+            if (elems_before < (difference_type(size()) - n) / 2)
             {
-                // 如果last后还有元素，需要逐个移动它们
-                for (iterator curr = first; curr != first + elems_after; ++curr)
+                // 前面的元素较少：整体后移，再销毁头部
+                mystl::move_backward(start_, first, last);
+                iterator new_start = start_ + n;
+                mystl::destroy(start_, new_start);
+                for (map_pointer node = start_.node; node < new_start.node; ++node)
                 {
-                    *curr = mystl::move(*(curr + n));
+                    deallocate_block(*node);
                 }
+                start_ = new_start;
             }
-            
-            // 销毁多余元素
-            for (iterator it = new_finish; it != end(); ++it)
+            else
             {
-                mystl::destroy_at(it.cur);
+                // 后面的元素较少：整体前移，再销毁尾部
+                mystl::move(last, finish_, first);
+                iterator new_finish = finish_ - n;
+                mystl::destroy(new_finish, finish_);
+                for (map_pointer node = new_finish.node + 1; node <= finish_.node; ++node)
+                {
+                    deallocate_block(*node);
+                }
+                finish_ = new_finish;
             }
-            
-            // 更新finish_位置
-            finish_ = new_finish;
-            
-            return first;  // 返回被删除范围的起始位置
+            return start_ + elems_before;
         }
 
         
@@ -1062,8 +984,15 @@ namespace mystl
             mystl::swap(finish_, other.finish_);
             mystl::swap(map_, other.map_);
             mystl::swap(map_size_, other.map_size_);
+            for (size_type i = 0; i < MAX_SPARE_BLOCKS; ++i) mystl::swap(spare_[i], other.spare_[i]);
+            mystl::swap(spare_count_, other.spare_count_);
+            mystl::swap(alloc_, other.alloc_);
+            mystl::swap(map_alloc_, other.map_alloc_);
         }
 
+        // 返回分配器的副本
+        allocator_type get_allocator() const noexcept { return alloc_; }
+
         
 
     private:
@@ -1072,9 +1001,41 @@ namespace mystl
         //------------------------------------------------------------------------------   
 
         // 获取缓冲区大小
-        static size_type buffer_size() noexcept
+        static constexpr size_type buffer_size() noexcept
+        {
+            return deque_buf_size(BufSize, sizeof(value_type));
+        }
+
+        // 取得一个缓冲区：优先使用备用缓存
+        pointer allocate_block()
+        {
+            if (spare_count_ > 0)
+            {
+                return spare_[--spare_count_];
+            }
+            return alloc_.allocate(buffer_size());
+        }
+
+        // 归还一个缓冲区：备用缓存未满时留作下次使用
+        void deallocate_block(pointer block) noexcept
+        {
+            if (spare_count_ < MAX_SPARE_BLOCKS)
+            {
+                spare_[spare_count_++] = block;
+            }
+            else
+            {
+                alloc_.deallocate(block, buffer_size());
+            }
+        }
+
+        // 释放所有备用缓冲区
+        void release_spare_blocks() noexcept
         {
-            return deque_buf_size(sizeof(value_type));
+            while (spare_count_ > 0)
+            {
+                alloc_.deallocate(spare_[--spare_count_], buffer_size());
+            }
         }
         
          
@@ -1111,7 +1072,7 @@ namespace mystl
             start_.set_node(nstart);
             finish_.set_node(nfinish);
             start_.cur = start_.first;
-            finish_.cur = start_.first + num_elements;  // 修改这里：直接设置为起始位置加上元素个数
+            finish_.cur = finish_.first + num_elements % buffer_size();  // 元素可能跨越多个缓冲区
         }
 
 
@@ -1121,7 +1082,8 @@ namespace mystl
             size_type vacancies = start_.cur - start_.first;
             if (n > vacancies)
             {
-                size_type new_nodes = (n - vacancies) / buffer_size() + 1;
+                // 向上取整：多分配的缓冲区不会被 start_ 覆盖到，会在下次预留时被覆盖而泄漏
+                size_type new_nodes = (n - vacancies + buffer_size() - 1) / buffer_size();
                 
                 // 保存原始状态
                 map_pointer old_start_node = start_.node;
@@ -1136,23 +1098,20 @@ namespace mystl
                     try
                     {
                         for (i = 1; i <= new_nodes; ++i)
-                            *(start_.node - i) = alloc_.allocate(buffer_size());
+                            *(start_.node - i) = allocate_block();
                     }
                     catch (...)
                     {
                         // 清理已分配的缓冲区
                         for (size_type j = 1; j < i; ++j)
-                            alloc_.deallocate(*(start_.node - j), buffer_size());
+                            deallocate_block(*(start_.node - j));
                         
                         // 恢复原始状态
                         start_.node = old_start_node;
                         throw;
                     }
 
-                    iterator new_start;
-                    new_start.set_node(start_.node - new_nodes);
-                    new_start.cur = new_start.last - (n - vacancies);
-                    return new_start;
+                    return start_ - difference_type(n);  // 返回新的起始位置
                 }
                 catch (...)
                 {
@@ -1162,7 +1121,7 @@ namespace mystl
                 }
             }
             else
-                return iterator(start_.cur - n, start_.first, start_.last, start_.node);
+                return start_ - difference_type(n);
         }
 
         // 在后端预留n个元素的空间
@@ -1171,7 +1130,7 @@ namespace mystl
             size_type vacancies = (finish_.last - finish_.cur) - 1;  // 当前缓冲区后端的空闲空间
             if (n > vacancies)
             {
-                size_type new_nodes = (n - vacancies) / buffer_size() + 1;
+                size_type new_nodes = (n - vacancies + buffer_size() - 1) / buffer_size();
                 
                 // 保存原始状态
                 map_pointer old_finish_node = finish_.node;
@@ -1186,20 +1145,20 @@ namespace mystl
                     try
                     {
                         for (i = 1; i <= new_nodes; ++i)
-                            *(finish_.node + i) = alloc_.allocate(buffer_size());
+                            *(finish_.node + i) = allocate_block();
                     }
                     catch (...)
                     {
                         // 清理已分配的缓冲区
                         for (size_type j = 1; j < i; ++j)
-                            alloc_.deallocate(*(finish_.node + j), buffer_size());
+                            deallocate_block(*(finish_.node + j));
                         
                         // 恢复原始状态
                         finish_.node = old_finish_node;
                         throw;
                     }
                     
-                    return iterator(finish_.cur + n, finish_.first, finish_.last, finish_.node);  // 返回新的结束位置
+                    return finish_ + difference_type(n);  // 返回新的结束位置
                 }
                 catch (...)
                 {
@@ -1208,7 +1167,7 @@ namespace mystl
                     throw;
                 }
             }
-            return iterator(finish_.cur + n, finish_.first, finish_.last, finish_.node);  // 当前缓冲区空间足够
+            return finish_ + difference_type(n);  // 当前缓冲区空间足够
         }
 
         // 确保map后端有足够空间
@@ -1299,9 +1258,8 @@ namespace mystl
             {
                 if (*n != nullptr)  // 检查指针是否有效
                 {
-                    mystl::destroy(*n, *n + buffer_size());  // 先销毁对象
-                    alloc_.deallocate(*n, buffer_size());    // 再释放内存
-                    *n = nullptr;                            // 设置为空指针
+                    deallocate_block(*n);  // 新预留的缓冲区里没有已构造的对象，由调用者负责销毁自己构造的元素
+                    *n = nullptr;          // 设置为空指针
                 }
             }
         }
@@ -1313,93 +1271,220 @@ namespace mystl
             {
                 if (*n != nullptr)  // 检查指针是否有效
                 {
-                    mystl::destroy(*n, *n + buffer_size());  // 先销毁对象
-                    alloc_.deallocate(*n, buffer_size());    // 再释放内存
-                    *n = nullptr;                            // 设置为空指针
+                    deallocate_block(*n);  // 新预留的缓冲区里没有已构造的对象，由调用者负责销毁自己构造的元素
+                    *n = nullptr;          // 设置为空指针
                 }
             }
         }
 
-        // 在pos位置插入元素的辅助函数
+        // 在pos位置插入元素的辅助函数（pos 不在头尾）
+        // 在较短的一侧补一个元素，再把 pos 与这一侧之间的元素整体平移一格
         template <class V>  // V可以是T&或T&&
         iterator insert_aux(iterator pos, V&& value)
         {
-            const size_type elems_before = pos - start_;
-            
-            if (elems_before < size() / 2)
+            value_type x_copy(mystl::forward<V>(value));  // value 可能引用容器内的元素
+            const difference_type index = pos - start_;
+            if (size_type(index) < size() / 2)
             {
-                // 在前半段插入
-                iterator new_start = reserve_elements_at_front(1);
-                
-                try 
+                push_front_aux(mystl::move(front()));
+                iterator front1 = start_ + 1;
+                pos = start_ + index;
+                mystl::move(front1 + 1, pos + 1, front1);
+            }
+            else
+            {
+                push_back_aux(mystl::move(back()));
+                pos = start_ + index;
+                mystl::move_backward(pos, finish_ - 2, finish_ - 1);
+            }
+            *pos = mystl::move(x_copy);
+            return pos;
+        }
+
+        // 在中间位置插入n个value
+        // 预留空间可能使 map 重新分配，pos 需要在预留后按下标重新计算
+        void fill_insert_aux(iterator pos, size_type n, const value_type& value)
+        {
+            const difference_type elems_before = pos - start_;
+            const difference_type count = static_cast<difference_type>(n);
+            const size_type length = size();
+            value_type x_copy(value);
+            if (elems_before < difference_type(length / 2))
+            {
+                iterator new_start = reserve_elements_at_front(n);
+                iterator old_start = start_;
+                pos = start_ + elems_before;
+                try
                 {
-                    // 先构造新元素
-                    mystl::construct(new_start.cur, mystl::forward<V>(value));
-                    
-                    try 
+                    if (elems_before >= count)
                     {
-                        // 再复制原有元素
-                        mystl::uninitialized_copy(start_, pos, new_start + 1);
-                        start_ = new_start;  // 更新start_
+                        // 前段的头 n 个元素移到新空间，其余前移 n 格，空出的位置填充
+                        iterator start_n = start_ + count;
+                        mystl::uninitialized_move(start_, start_n, new_start);
+                        start_ = new_start;
+                        mystl::move(start_n, pos, old_start);
+                        mystl::fill(pos - count, pos, x_copy);
                     }
-                    catch (...) 
+                    else
                     {
-                        mystl::destroy_at(new_start.cur);
-                        destroy_nodes_at_front(new_start);
-                        throw;
+                        // 前段整体移到新空间，新空间余下的部分与原前段的位置填充
+                        iterator mid = mystl::uninitialized_move(start_, pos, new_start);
+                        try
+                        {
+                            mystl::uninitialized_fill(mid, start_, x_copy);
+                        }
+                        catch (...)
+                        {
+                            mystl::destroy(new_start, mid);
+                            throw;
+                        }
+                        start_ = new_start;
+                        mystl::fill(old_start, pos, x_copy);
                     }
                 }
-                catch (...) 
+                catch (...)
                 {
                     destroy_nodes_at_front(new_start);
                     throw;
                 }
             }
-            else 
+            else
             {
-                // 在后半段插入
-                iterator new_finish = reserve_elements_at_back(1);
-                
-                try 
+                iterator new_finish = reserve_elements_at_back(n);
+                iterator old_finish = finish_;
+                const difference_type elems_after = difference_type(length) - elems_before;
+                pos = finish_ - elems_after;
+                try
                 {
-                    // 先在新位置构造最后一个元素
-                    mystl::construct(finish_.cur, back());
-                    
-                    try 
+                    if (elems_after > count)
                     {
-                        // 移动元素
-                        mystl::uninitialized_move_backward(pos, finish_ - 1, finish_);
-                        
-                        // 在pos位置构造新元素
-                        mystl::construct(start_ + elems_before, mystl::forward<V>(value));
-                        
-                        ++finish_;     // 更新finish_
+                        iterator finish_n = finish_ - count;
+                        mystl::uninitialized_move(finish_n, finish_, finish_);
+                        finish_ = new_finish;
+                        mystl::move_backward(pos, finish_n, old_finish);
+                        mystl::fill(pos, pos + count, x_copy);
                     }
-                    catch (...) 
+                    else
                     {
-                        mystl::destroy_at(finish_.cur);
-                        destroy_nodes_at_back(new_finish);
-                        throw;
+                        mystl::uninitialized_fill(finish_, pos + count, x_copy);
+                        try
+                        {
+                            mystl::uninitialized_move(pos, finish_, pos + count);
+                        }
+                        catch (...)
+                        {
+                            mystl::destroy(finish_, pos + count);
+                            throw;
+                        }
+                        finish_ = new_finish;
+                        mystl::fill(pos, old_finish, x_copy);
                     }
                 }
-                catch (...) 
+                catch (...)
                 {
                     destroy_nodes_at_back(new_finish);
                     throw;
                 }
             }
-            return start_ + elems_before;
         }
 
+        // 在中间位置插入[first, last)，n 为区间长度，步骤与 fill_insert_aux 相同
+        template <class ForwardIt>
+        void range_insert_aux(iterator pos, ForwardIt first, ForwardIt last, size_type n)
+        {
+            const difference_type elems_before = pos - start_;
+            const difference_type count = static_cast<difference_type>(n);
+            const size_type length = size();
+            if (elems_before < difference_type(length / 2))
+            {
+                iterator new_start = reserve_elements_at_front(n);
+                iterator old_start = start_;
+                pos = start_ + elems_before;
+                try
+                {
+                    if (elems_before >= count)
+                    {
+                        iterator start_n = start_ + count;
+                        mystl::uninitialized_move(start_, start_n, new_start);
+                        start_ = new_start;
+                        mystl::move(start_n, pos, old_start);
+                        mystl::copy(first, last, pos - count);
+                    }
+                    else
+                    {
+                        ForwardIt mid = first;
+                        mystl::advance(mid, count - elems_before);
+                        iterator new_mid = mystl::uninitialized_move(start_, pos, new_start);
+                        try
+                        {
+                            mystl::uninitialized_copy(first, mid, new_mid);
+                        }
+                        catch (...)
+                        {
+                            mystl::destroy(new_start, new_mid);
+                            throw;
+                        }
+                        start_ = new_start;
+                        mystl::copy(mid, last, old_start);
+                    }
+                }
+                catch (...)
+                {
+                    destroy_nodes_at_front(new_start);
+                    throw;
+                }
+            }
+            else
+            {
+                iterator new_finish = reserve_elements_at_back(n);
+                iterator old_finish = finish_;
+                const difference_type elems_after = difference_type(length) - elems_before;
+                pos = finish_ - elems_after;
+                try
+                {
+                    if (elems_after > count)
+                    {
+                        iterator finish_n = finish_ - count;
+                        mystl::uninitialized_move(finish_n, finish_, finish_);
+                        finish_ = new_finish;
+                        mystl::move_backward(pos, finish_n, old_finish);
+                        mystl::copy(first, last, pos);
+                    }
+                    else
+                    {
+                        ForwardIt mid = first;
+                        mystl::advance(mid, elems_after);
+                        iterator new_mid = mystl::uninitialized_copy(mid, last, finish_);
+                        try
+                        {
+                            mystl::uninitialized_move(pos, finish_, new_mid);
+                        }
+                        catch (...)
+                        {
+                            mystl::destroy(finish_, new_mid);
+                            throw;
+                        }
+                        finish_ = new_finish;
+                        mystl::copy(first, mid, pos);
+                    }
+                }
+                catch (...)
+                {
+                    destroy_nodes_at_back(new_finish);
+                    throw;
+                }
+            }
+        }
 
-        // 在头部添加元素
-        template <class V>
-        void push_front_aux(V&& value)
+
+        // 在头部构造元素
+        template <class... Args>
+        void push_front_aux(Args&&... args)
         {
             if (start_.cur != start_.first) 
             {
                 // 缓冲区还有空间
-                mystl::construct(start_.cur - 1, mystl::forward<V>(value));
+                mystl::construct(start_.cur - 1, mystl::forward<Args>(args)...);
                 --start_.cur;
             }
             else 
@@ -1408,7 +1493,7 @@ namespace mystl
                 iterator new_start = reserve_elements_at_front(1);
                 try 
                 {
-                    mystl::construct(new_start.cur, mystl::forward<V>(value));
+                    mystl::construct(new_start.cur, mystl::forward<Args>(args)...);
                     start_ = new_start;
                 }
                 catch (...) 
@@ -1419,14 +1504,14 @@ namespace mystl
             }
         }
 
-        // 在尾部添加元素
-        template <class V>
-        void push_back_aux(V&& value)
+        // 在尾部构造元素
+        template <class... Args>
+        void push_back_aux(Args&&... args)
         {
             if (finish_.cur != finish_.last - 1) 
             {
                 // 缓冲区还有空间
-                mystl::construct(finish_.cur, mystl::forward<V>(value));
+                mystl::construct(finish_.cur, mystl::forward<Args>(args)...);
                 ++finish_.cur;
             }
             else 
@@ -1435,7 +1520,7 @@ namespace mystl
                 iterator new_finish = reserve_elements_at_back(1);
                 try 
                 {
-                    mystl::construct(finish_.cur, mystl::forward<V>(value));
+                    mystl::construct(finish_.cur, mystl::forward<Args>(args)...);
                     ++finish_;
                 }
                 catch (...) 
@@ -1455,45 +1540,45 @@ namespace mystl
     // 非成员函数
     //------------------------------------------------------------------------------        
     // 比较运算符
-    template <class T, class Allocator>
-    bool operator==(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator==(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
-    template <class T, class Allocator>
-    bool operator!=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator!=(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return !(lhs == rhs);
     }
 
-    template <class T, class Allocator>
-    bool operator<(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator<(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template <class T, class Allocator>
-    bool operator<=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator<=(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return !(rhs < lhs);
     }
 
-    template <class T, class Allocator>
-    bool operator>(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator>(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return rhs < lhs;
     }
 
-    template <class T, class Allocator>
-    bool operator>=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+    template <class T, class Allocator, size_t BufSize>
+    bool operator>=(const deque<T, Allocator, BufSize>& lhs, const deque<T, Allocator, BufSize>& rhs)
     {
         return !(lhs < rhs);
     }
 
     // 交换两个deque
-    template <class T, class Allocator>
-    void swap(deque<T, Allocator>& lhs, deque<T, Allocator>& rhs) noexcept
+    template <class T, class Allocator, size_t BufSize>
+    void swap(deque<T, Allocator, BufSize>& lhs, deque<T, Allocator, BufSize>& rhs) noexcept
     {
         lhs.swap(rhs);
     }
@@ -0,0 +1,717 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include "vector.hpp"
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // 位操作辅助函数
+    // 以 64 位字为单位，GCC / Clang 使用内建的 popcount / ctz 指令，其他编译器使用可移植的实现
+    /*****************************************************************************************/
+    namespace bit_detail
+    {
+        using word_type = std::uint64_t;
+        constexpr unsigned WORD_BITS = 64;
+        constexpr word_type ALL_ONES = ~word_type(0);
+
+        // 字中 1 的个数
+        inline unsigned popcount(word_type w) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_popcountll(w));
+#else
+            w = w - ((w >> 1) & 0x5555555555555555ULL);
+            w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+            w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<unsigned>((w * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        // 最低位的 1 的位置，w 不能为 0
+        inline unsigned countr_zero(word_type w) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(w));
+#else
+            return popcount((w & (0 - w)) - 1);
+#endif
+        }
+
+        // [offset, 64) 位为 1
+        inline word_type mask_from(unsigned offset) noexcept
+        {
+            return ALL_ONES << offset;
+        }
+
+        // [0, offset) 位为 1，offset 可以为 64
+        inline word_type mask_below(unsigned offset) noexcept
+        {
+            return offset == 0 ? 0 : ALL_ONES >> (WORD_BITS - offset);
+        }
+
+        // 把 w 中 mask 为 1 的位设为 value
+        inline void assign_bits(word_type& w, word_type mask, bool value) noexcept
+        {
+            if (value) w |= mask;
+            else w &= ~mask;
+        }
+
+        // 所需的字数
+        inline size_t word_count(size_t bits) noexcept
+        {
+            return (bits + WORD_BITS - 1) / WORD_BITS;
+        }
+    } // namespace bit_detail
+
+
+
+    /*****************************************************************************************/
+    // bit_reference
+    // 单个位的代理引用，赋值时只修改所在字中的这一位
+    /*****************************************************************************************/
+    class bit_reference
+    {
+    public:
+        using word_type = bit_detail::word_type;
+
+        bit_reference(word_type* word, unsigned offset) noexcept
+            : word_(word), mask_(word_type(1) << offset) {}
+
+        bit_reference(const bit_reference&) = default;
+
+        operator bool() const noexcept { return (*word_ & mask_) != 0; }
+        bool operator~() const noexcept { return !static_cast<bool>(*this); }
+
+        bit_reference& operator=(bool value) noexcept
+        {
+            bit_detail::assign_bits(*word_, mask_, value);
+            return *this;
+        }
+
+        bit_reference& operator=(const bit_reference& other) noexcept
+        {
+            return *this = static_cast<bool>(other);
+        }
+
+        bit_reference& flip() noexcept
+        {
+            *word_ ^= mask_;
+            return *this;
+        }
+
+    private:
+        word_type* word_;
+        word_type mask_;
+    };
+
+    inline void swap(bit_reference a, bit_reference b) noexcept
+    {
+        bool tmp = a;
+        a = static_cast<bool>(b);
+        b = tmp;
+    }
+
+
+
+    /*****************************************************************************************/
+    // bit_iterator
+    // 指向某个字中某一位的随机访问迭代器，IsConst 为 true 时解引用得到 bool
+    /*****************************************************************************************/
+    template<bool IsConst>
+    class bit_iterator
+    {
+    public:
+        using word_type = bit_detail::word_type;
+        using word_pointer = conditional_t<IsConst, const word_type*, word_type*>;
+
+        // 类型定义
+        using iterator_category = mystl::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = conditional_t<IsConst, bool, bit_reference>;
+
+        word_pointer word;  // 所在的字
+        unsigned offset;    // 字内的位置，[0, 64)
+
+    public:
+        // 构造函数
+        bit_iterator() noexcept : word(nullptr), offset(0) {}
+        bit_iterator(word_pointer w, unsigned off) noexcept : word(w), offset(off) {}
+
+        // 类型转换
+        operator bit_iterator<true>() const noexcept
+        {
+            return bit_iterator<true>(word, offset);
+        }
+
+        // 操作符重载
+        reference operator*() const noexcept
+        {
+            if constexpr (IsConst)
+                return (*word >> offset) & 1;
+            else
+                return bit_reference(word, offset);
+        }
+
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        // 迭代器移动
+        bit_iterator& operator++() noexcept
+        {
+            if (++offset == bit_detail::WORD_BITS)
+            {
+                offset = 0;
+                ++word;
+            }
+            return *this;
+        }
+
+        bit_iterator operator++(int) noexcept
+        {
+            bit_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bit_iterator& operator--() noexcept
+        {
+            if (offset-- == 0)
+            {
+                offset = bit_detail::WORD_BITS - 1;
+                --word;
+            }
+            return *this;
+        }
+
+        bit_iterator operator--(int) noexcept
+        {
+            bit_iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bit_iterator& operator+=(difference_type n) noexcept
+        {
+            // 按 64 向下取整，负数同样落在正确的字
+            difference_type pos = static_cast<difference_type>(offset) + n;
+            difference_type words = pos >= 0 ? pos / 64 : -((63 - pos) / 64);
+            word += words;
+            offset = static_cast<unsigned>(pos - words * 64);
+            return *this;
+        }
+
+        bit_iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+        bit_iterator operator+(difference_type n) const noexcept
+        {
+            bit_iterator tmp = *this;
+            return tmp += n;
+        }
+
+        bit_iterator operator-(difference_type n) const noexcept
+        {
+            bit_iterator tmp = *this;
+            return tmp -= n;
+        }
+
+        difference_type operator-(const bit_iterator& other) const noexcept
+        {
+            return (word - other.word) * 64 + static_cast<difference_type>(offset) - static_cast<difference_type>(other.offset);
+        }
+
+        // 比较操作符
+        bool operator==(const bit_iterator& other) const noexcept { return word == other.word && offset == other.offset; }
+        bool operator!=(const bit_iterator& other) const noexcept { return !(*this == other); }
+        bool operator<(const bit_iterator& other) const noexcept
+        {
+            return word < other.word || (word == other.word && offset < other.offset);
+        }
+        bool operator>(const bit_iterator& other) const noexcept { return other < *this; }
+        bool operator<=(const bit_iterator& other) const noexcept { return !(other < *this); }
+        bool operator>=(const bit_iterator& other) const noexcept { return !(*this < other); }
+    };
+
+    template<bool IsConst>
+    bit_iterator<IsConst> operator+(ptrdiff_t n, const bit_iterator<IsConst>& it) noexcept
+    {
+        return it + n;
+    }
+
+
+
+    /*****************************************************************************************/
+    // 位迭代器上的算法重载
+    // 比通用版本更特化，mystl::count / find / fill 作用于位迭代器时按字处理
+    /*****************************************************************************************/
+
+    // 统计 [first, last) 中等于 value 的位数，每个字一次 popcount
+    template<bool IsConst, class T>
+    ptrdiff_t count(bit_iterator<IsConst> first, bit_iterator<IsConst> last, const T& value)
+    {
+        using namespace bit_detail;
+        if (first == last) return 0;
+        ptrdiff_t ones;
+        if (first.word == last.word)
+        {
+            ones = popcount(*first.word & mask_from(first.offset) & mask_below(last.offset));
+        }
+        else
+        {
+            ones = popcount(*first.word & mask_from(first.offset));
+            for (auto w = first.word + 1; w != last.word; ++w) ones += popcount(*w);
+            if (last.offset) ones += popcount(*last.word & mask_below(last.offset));
+        }
+        return static_cast<bool>(value) ? ones : (last - first) - ones;
+    }
+
+    // 查找第一个等于 value 的位，跳过全 0（查找 1 时）或全 1（查找 0 时）的字
+    template<bool IsConst, class T>
+    bit_iterator<IsConst> find(bit_iterator<IsConst> first, bit_iterator<IsConst> last, const T& value)
+    {
+        using namespace bit_detail;
+        if (first == last) return last;
+        const word_type flip = static_cast<bool>(value) ? 0 : ALL_ONES;
+        auto w = first.word;
+        word_type bits = (*w ^ flip) & mask_from(first.offset);
+        while (w != last.word)
+        {
+            if (bits) return bit_iterator<IsConst>(w, countr_zero(bits));
+            ++w;
+            bits = (w != last.word || last.offset) ? (*w ^ flip) : 0;  // 不读取 last 所在的字之外的内存
+        }
+        bits &= mask_below(last.offset);
+        if (bits) return bit_iterator<IsConst>(w, countr_zero(bits));
+        return last;
+    }
+
+    // 把 [first, last) 中的位全部设为 value，中间的整字直接赋值
+    template<class T>
+    void fill(bit_iterator<false> first, bit_iterator<false> last, const T& value)
+    {
+        using namespace bit_detail;
+        if (first == last) return;
+        const bool bit = static_cast<bool>(value);
+        if (first.word == last.word)
+        {
+            assign_bits(*first.word, mask_from(first.offset) & mask_below(last.offset), bit);
+            return;
+        }
+        assign_bits(*first.word, mask_from(first.offset), bit);
+        for (auto w = first.word + 1; w != last.word; ++w) *w = bit ? ALL_ONES : 0;
+        if (last.offset) assign_bits(*last.word, mask_below(last.offset), bit);
+    }
+
+
+
+    /*****************************************************************************************/
+    // dynamic_bitset
+    // 每位一比特的动态位集，存储在 vector<uint64_t> 中。
+    // 不变式：最后一个字中超出 size() 的位始终为 0，count、比较、位运算都可以直接按整字处理
+    /*****************************************************************************************/
+    template<class Allocator = mystl::allocator<std::uint64_t>>
+    class dynamic_bitset
+    {
+        static_assert(is_same<typename Allocator::value_type, std::uint64_t>::value,
+                      "dynamic_bitset requires an allocator of uint64_t");
+
+    public:
+        //------------------------------------------------------------------------------
+        // 类型定义
+        //------------------------------------------------------------------------------
+        using word_type = std::uint64_t;
+        using value_type = bool;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = bit_reference;
+        using const_reference = bool;
+        using iterator = bit_iterator<false>;
+        using const_iterator = bit_iterator<true>;
+        using reverse_iterator = mystl::reverse_iterator<iterator>;
+        using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;
+
+        static constexpr size_type bits_per_word = bit_detail::WORD_BITS;
+        static constexpr size_type npos = static_cast<size_type>(-1);  // find_first / find_next 未找到时的返回值
+
+    private:
+        //------------------------------------------------------------------------------
+        // 成员变量
+        //------------------------------------------------------------------------------
+        vector<word_type, Allocator> words_;  // 位存储，第 i 位位于 words_[i / 64] 的第 i % 64 位
+        size_type size_;                      // 位数
+
+    public:
+        //------------------------------------------------------------------------------
+        // 构造函数
+        //------------------------------------------------------------------------------
+
+        // 默认构造函数
+        dynamic_bitset() noexcept : size_(0) {}
+
+        // 使用指定的分配器构造空位集
+        explicit dynamic_bitset(const allocator_type& alloc) noexcept : words_(alloc), size_(0) {}
+
+        // 创建 count 个值为 value 的位
+        explicit dynamic_bitset(size_type count, bool value = false, const allocator_type& alloc = allocator_type())
+            : words_(bit_detail::word_count(count), value ? bit_detail::ALL_ONES : 0, alloc), size_(count)
+        {
+            clear_unused_bits();
+        }
+
+        // 迭代器范围构造，元素转换为 bool
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        dynamic_bitset(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : words_(alloc), size_(0)
+        {
+            for (; first != last; ++first) push_back(static_cast<bool>(*first));
+        }
+
+        // 使用初始化列表创建位集
+        dynamic_bitset(std::initializer_list<bool> init, const allocator_type& alloc = allocator_type())
+            : dynamic_bitset(init.begin(), init.end(), alloc) {}
+
+        dynamic_bitset(const dynamic_bitset&) = default;
+
+        dynamic_bitset(dynamic_bitset&& other) noexcept
+            : words_(mystl::move(other.words_)), size_(other.size_)
+        {
+            other.size_ = 0;
+        }
+
+        dynamic_bitset& operator=(const dynamic_bitset&) = default;
+
+        dynamic_bitset& operator=(dynamic_bitset&& other) noexcept
+        {
+            if (this != &other)
+            {
+                words_ = mystl::move(other.words_);
+                size_ = other.size_;
+                other.size_ = 0;
+            }
+            return *this;
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 迭代器
+        //------------------------------------------------------------------------------
+
+        iterator begin() noexcept { return iterator(words_.data(), 0); }
+        const_iterator begin() const noexcept { return const_iterator(words_.data(), 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return begin() + static_cast<difference_type>(size_); }
+        const_iterator end() const noexcept { return begin() + static_cast<difference_type>(size_); }
+        const_iterator cend() const noexcept { return end(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 元素访问
+        //------------------------------------------------------------------------------
+
+        reference operator[](size_type pos) noexcept
+        {
+            return reference(words_.data() + pos / bits_per_word, static_cast<unsigned>(pos % bits_per_word));
+        }
+
+        const_reference operator[](size_type pos) const noexcept
+        {
+            return (words_[pos / bits_per_word] >> (pos % bits_per_word)) & 1;
+        }
+
+        // 带边界检查的访问
+        bool test(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("dynamic_bitset::test");
+            }
+            return (*this)[pos];
+        }
+
+        // 底层字数组，最后一个字中超出 size() 的位为 0
+        word_type* data() noexcept { return words_.data(); }
+        const word_type* data() const noexcept { return words_.data(); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 容量操作
+        //------------------------------------------------------------------------------
+
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type num_words() const noexcept { return words_.size(); }
+        size_type capacity() const noexcept { return words_.capacity() * bits_per_word; }
+        size_type max_size() const noexcept { return words_.max_size(); }
+
+        void reserve(size_type bits) { words_.reserve(bit_detail::word_count(bits)); }
+        void shrink_to_fit() { words_.shrink_to_fit(); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 修改器
+        //------------------------------------------------------------------------------
+
+        void clear() noexcept
+        {
+            words_.clear();
+            size_ = 0;
+        }
+
+        // 调整位数，新增的位设为 value
+        void resize(size_type count, bool value = false)
+        {
+            const size_type old_size = size_;
+            words_.resize(bit_detail::word_count(count), value ? bit_detail::ALL_ONES : 0);
+            size_ = count;
+            if (count > old_size && value)
+            {
+                // 原来最后一个字中空闲的位是 0，补上
+                mystl::fill(begin() + static_cast<difference_type>(old_size), end(), true);
+            }
+            clear_unused_bits();
+        }
+
+        void push_back(bool value)
+        {
+            if (size_ % bits_per_word == 0) words_.push_back(0);
+            ++size_;
+            (*this)[size_ - 1] = value;
+        }
+
+        void pop_back() noexcept
+        {
+            if (size_ == 0) return;
+            --size_;
+            if (size_ % bits_per_word == 0) words_.pop_back();
+            else clear_unused_bits();
+        }
+
+        // 所有位设为 1
+        dynamic_bitset& set() noexcept
+        {
+            return fill(true);
+        }
+
+        dynamic_bitset& set(size_type pos, bool value = true) noexcept
+        {
+            (*this)[pos] = value;
+            return *this;
+        }
+
+        // 把 [pos, pos + len) 设为 value，中间的整字直接赋值
+        dynamic_bitset& set(size_type pos, size_type len, bool value) noexcept
+        {
+            mystl::fill(begin() + static_cast<difference_type>(pos),
+                        begin() + static_cast<difference_type>(pos + len), value);
+            return *this;
+        }
+
+        // 所有位设为 0
+        dynamic_bitset& reset() noexcept
+        {
+            return fill(false);
+        }
+
+        dynamic_bitset& reset(size_type pos) noexcept
+        {
+            return set(pos, false);
+        }
+
+        // 所有位取反
+        dynamic_bitset& flip() noexcept
+        {
+            for (auto& w : words_) w = ~w;
+            clear_unused_bits();
+            return *this;
+        }
+
+        dynamic_bitset& flip(size_type pos) noexcept
+        {
+            (*this)[pos].flip();
+            return *this;
+        }
+
+        // 所有位设为 value，按整字赋值
+        dynamic_bitset& fill(bool value) noexcept
+        {
+            for (auto& w : words_) w = value ? bit_detail::ALL_ONES : 0;
+            clear_unused_bits();
+            return *this;
+        }
+
+        void swap(dynamic_bitset& other) noexcept
+        {
+            words_.swap(other.words_);
+            mystl::swap(size_, other.size_);
+        }
+
+        allocator_type get_allocator() const noexcept { return words_.get_allocator(); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 按字统计与查找
+        //------------------------------------------------------------------------------
+
+        // 值为 1 的位数
+        size_type count() const noexcept
+        {
+            size_type n = 0;
+            for (auto w : words_) n += bit_detail::popcount(w);
+            return n;
+        }
+
+        bool any() const noexcept
+        {
+            for (auto w : words_)
+            {
+                if (w) return true;
+            }
+            return false;
+        }
+
+        bool none() const noexcept { return !any(); }
+        bool all() const noexcept { return count() == size_; }
+
+        // 第一个值为 1 的位，没有时返回 npos
+        size_type find_first() const noexcept
+        {
+            return find_from(0);
+        }
+
+        // pos 之后第一个值为 1 的位，没有时返回 npos
+        size_type find_next(size_type pos) const noexcept
+        {
+            if (pos >= size_) return npos;
+            return find_from(pos + 1);
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 整体位运算，两个位集的位数必须相同
+        //------------------------------------------------------------------------------
+
+        dynamic_bitset& operator&=(const dynamic_bitset& other)
+        {
+            check_same_size(other, "dynamic_bitset::operator&=");
+            for (size_type i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+            return *this;
+        }
+
+        dynamic_bitset& operator|=(const dynamic_bitset& other)
+        {
+            check_same_size(other, "dynamic_bitset::operator|=");
+            for (size_type i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+            return *this;
+        }
+
+        dynamic_bitset& operator^=(const dynamic_bitset& other)
+        {
+            check_same_size(other, "dynamic_bitset::operator^=");
+            for (size_type i = 0; i < words_.size(); ++i) words_[i] ^= other.words_[i];
+            return *this;
+        }
+
+        // 差集：清除 other 中为 1 的位
+        dynamic_bitset& operator-=(const dynamic_bitset& other)
+        {
+            check_same_size(other, "dynamic_bitset::operator-=");
+            for (size_type i = 0; i < words_.size(); ++i) words_[i] &= ~other.words_[i];
+            return *this;
+        }
+
+        dynamic_bitset operator~() const
+        {
+            dynamic_bitset tmp(*this);
+            tmp.flip();
+            return tmp;
+        }
+
+        bool operator==(const dynamic_bitset& other) const noexcept
+        {
+            return size_ == other.size_ && words_ == other.words_;
+        }
+
+        bool operator!=(const dynamic_bitset& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+        // 清除最后一个字中超出 size_ 的位，维持不变式
+        void clear_unused_bits() noexcept
+        {
+            const unsigned tail = static_cast<unsigned>(size_ % bits_per_word);
+            if (tail) words_.back() &= bit_detail::mask_below(tail);
+        }
+
+        size_type find_from(size_type pos) const noexcept
+        {
+            if (pos >= size_) return npos;
+            const_iterator it = mystl::find(begin() + static_cast<difference_type>(pos), end(), true);
+            return it == end() ? npos : static_cast<size_type>(it - begin());
+        }
+
+        void check_same_size(const dynamic_bitset& other, const char* what) const
+        {
+            if (size_ != other.size_)
+            {
+                throw invalid_argument(what);
+            }
+        }
+    };
+
+
+
+    //------------------------------------------------------------------------------
+    // 非成员函数
+    //------------------------------------------------------------------------------
+
+    template<class Alloc>
+    dynamic_bitset<Alloc> operator&(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs)
+    {
+        dynamic_bitset<Alloc> tmp(lhs);
+        return tmp &= rhs;
+    }
+
+    template<class Alloc>
+    dynamic_bitset<Alloc> operator|(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs)
+    {
+        dynamic_bitset<Alloc> tmp(lhs);
+        return tmp |= rhs;
+    }
+
+    template<class Alloc>
+    dynamic_bitset<Alloc> operator^(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs)
+    {
+        dynamic_bitset<Alloc> tmp(lhs);
+        return tmp ^= rhs;
+    }
+
+    template<class Alloc>
+    dynamic_bitset<Alloc> operator-(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs)
+    {
+        dynamic_bitset<Alloc> tmp(lhs);
+        return tmp -= rhs;
+    }
+
+    template<class Alloc>
+    void swap(dynamic_bitset<Alloc>& lhs, dynamic_bitset<Alloc>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
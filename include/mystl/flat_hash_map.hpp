@@ -0,0 +1,152 @@
+#pragma once
+#include <initializer_list>
+#include "flat_hashtable.hpp"
+#include "util.hpp"
+
+namespace mystl 
+{
+
+    // 开放寻址的哈希映射，接口与 unordered_map 相同，元素直接存放在槽位数组中。
+    // 插入可能导致重哈希，此时所有迭代器和元素的引用都会失效
+    template <class Key, class T,
+            class HashFcn = mystl::hash<Key>,
+            class EqualKey = mystl::equal_to<Key>,
+            class Alloc = mystl::allocator<mystl::pair<const Key, T>>>
+    class flat_hash_map 
+    {
+    private:
+        using ht = flat_hashtable<mystl::pair<const Key, T>,
+                                  Key, HashFcn,
+                                  mystl::select1st<mystl::pair<const Key, T>>,
+                                  EqualKey, Alloc>;
+        ht rep;
+
+    public:
+        using key_type = typename ht::key_type;
+        using data_type = T;
+        using mapped_type = T;
+        using value_type = typename ht::value_type;
+        using hasher = typename ht::hasher;
+        using key_equal = typename ht::key_equal;
+        using size_type = typename ht::size_type;
+        using difference_type = typename ht::difference_type;
+        using pointer = typename ht::pointer;
+        using const_pointer = typename ht::const_pointer;
+        using reference = typename ht::reference;
+        using const_reference = typename ht::const_reference;
+        using iterator = typename ht::iterator;
+        using const_iterator = typename ht::const_iterator;
+        using allocator_type = typename ht::allocator_type;
+
+        // 构造函数，n 为预计的元素个数
+        flat_hash_map() : rep(0, hasher(), key_equal()) {}
+        explicit flat_hash_map(size_type n) : rep(n, hasher(), key_equal()) {}
+        flat_hash_map(size_type n, const hasher& hf) : rep(n, hf, key_equal()) {}
+        flat_hash_map(size_type n, const hasher& hf, const key_equal& eql)
+            : rep(n, hf, eql) {}
+        flat_hash_map(size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc)
+            : rep(n, hf, eql, alloc) {}
+        explicit flat_hash_map(const allocator_type& alloc)
+            : rep(0, hasher(), key_equal(), alloc) {}
+        template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+        flat_hash_map(InputIt first, InputIt last, size_type n = 0, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(first, last); }
+        flat_hash_map(std::initializer_list<value_type> ilist, size_type n = 0, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(ilist.begin(), ilist.end()); }
+
+        allocator_type get_allocator() const noexcept { return rep.get_allocator(); }
+        hasher hash_function() const { return rep.hash_function(); }
+        key_equal key_eq() const { return rep.key_eq(); }
+
+        // 迭代器相关
+        iterator begin() { return rep.begin(); }
+        const_iterator begin() const { return rep.begin(); }
+        iterator end() { return rep.end(); }
+        const_iterator end() const { return rep.end(); }
+        const_iterator cbegin() const { return rep.begin(); }
+        const_iterator cend() const { return rep.end(); }
+
+        // 容量相关
+        bool empty() const { return rep.empty(); }
+        size_type size() const { return rep.size(); }
+        size_type max_size() const { return rep.max_size(); }
+        size_type bucket_count() const { return rep.bucket_count(); }
+        float load_factor() const { return rep.load_factor(); }
+        float max_load_factor() const { return rep.max_load_factor(); }
+        void reserve(size_type n) { rep.reserve(n); }
+        void rehash(size_type n) { rep.rehash(n); }
+
+        // 修改容器操作
+        mystl::pair<iterator, bool> insert(const value_type& obj)
+        { return rep.insert_unique(obj); }
+
+        mystl::pair<iterator, bool> insert(value_type&& obj)
+        { return rep.insert_unique(mystl::move(obj)); }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        { rep.insert_unique(first, last); }
+
+        template <class... Args>
+        mystl::pair<iterator, bool> emplace(Args&&... args)
+        { return rep.emplace_unique(mystl::forward<Args>(args)...); }
+
+        // 键不存在时才用 args 构造值
+        template <class... Args>
+        mystl::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return rep.emplace_key_with(key, [&] { return value_type(key, T(mystl::forward<Args>(args)...)); });
+        }
+
+        // 键已存在时不构造临时的 T()
+        T& operator[](const key_type& key) 
+        {
+            return rep.emplace_key_with(key, [&] { return value_type(key, T()); }).first->second;
+        }
+
+        T& at(const key_type& key)
+        {
+            iterator it = rep.find(key);
+            if (it == rep.end())
+                throw out_of_range("flat_hash_map::at");
+            return it->second;
+        }
+
+        const T& at(const key_type& key) const
+        {
+            const_iterator it = rep.find(key);
+            if (it == rep.end())
+                throw out_of_range("flat_hash_map::at");
+            return it->second;
+        }
+
+        iterator erase(const_iterator pos) { return rep.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return rep.erase(first, last); }
+        size_type erase(const key_type& key) { return rep.erase_unique(key); }
+
+        void clear() { rep.clear(); }
+        void swap(flat_hash_map& other) noexcept { rep.swap(other.rep); }
+
+        // 查找操作
+        iterator find(const key_type& key) { return rep.find(key); }
+        const_iterator find(const key_type& key) const { return rep.find(key); }
+        bool contains(const key_type& key) const { return rep.contains(key); }
+        size_type count(const key_type& key) const { return rep.count(key); }
+        mystl::pair<iterator, iterator> equal_range(const key_type& key)
+        { return rep.equal_range(key); }
+        mystl::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        { return rep.equal_range(key); }
+    };
+
+    template <class Key, class T, class HashFcn, class EqualKey, class Alloc>
+    void swap(flat_hash_map<Key, T, HashFcn, EqualKey, Alloc>& lhs,
+              flat_hash_map<Key, T, HashFcn, EqualKey, Alloc>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl 
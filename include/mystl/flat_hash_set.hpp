@@ -0,0 +1,120 @@
+#pragma once
+#include <initializer_list>
+#include "flat_hashtable.hpp"
+
+namespace mystl 
+{
+
+    // 开放寻址的哈希集合，接口与 unordered_set 相同，元素直接存放在槽位数组中
+    template <class Value,
+            class HashFcn = mystl::hash<Value>,
+            class EqualKey = mystl::equal_to<Value>,
+            class Alloc = mystl::allocator<Value>>
+    class flat_hash_set 
+    {
+    private:
+        using ht = flat_hashtable<Value, Value, HashFcn, mystl::identity<Value>, EqualKey, Alloc>;
+        ht rep;  // 底层哈希表
+
+    public:
+        using key_type = typename ht::key_type;
+        using value_type = typename ht::value_type;
+        using hasher = typename ht::hasher;
+        using key_equal = typename ht::key_equal;
+        using size_type = typename ht::size_type;
+        using difference_type = typename ht::difference_type;
+        using pointer = typename ht::pointer;
+        using const_pointer = typename ht::const_pointer;
+        using reference = typename ht::reference;
+        using const_reference = typename ht::const_reference;
+        using iterator = typename ht::const_iterator;
+        using const_iterator = typename ht::const_iterator;
+        using allocator_type = typename ht::allocator_type;
+
+        // 构造函数，n 为预计的元素个数
+        flat_hash_set() : rep(0, hasher(), key_equal()) {}
+        explicit flat_hash_set(size_type n) : rep(n, hasher(), key_equal()) {}
+        flat_hash_set(size_type n, const hasher& hf) : rep(n, hf, key_equal()) {}
+        flat_hash_set(size_type n, const hasher& hf, const key_equal& eql)
+            : rep(n, hf, eql) {}
+        flat_hash_set(size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc)
+            : rep(n, hf, eql, alloc) {}
+        explicit flat_hash_set(const allocator_type& alloc)
+            : rep(0, hasher(), key_equal(), alloc) {}
+        template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+        flat_hash_set(InputIt first, InputIt last, size_type n = 0, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(first, last); }
+        flat_hash_set(std::initializer_list<value_type> ilist, size_type n = 0, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(ilist.begin(), ilist.end()); }
+
+        allocator_type get_allocator() const noexcept { return rep.get_allocator(); }
+        hasher hash_function() const { return rep.hash_function(); }
+        key_equal key_eq() const { return rep.key_eq(); }
+
+        // 迭代器相关
+        iterator begin() const { return rep.begin(); }
+        iterator end() const { return rep.end(); }
+        const_iterator cbegin() const { return rep.begin(); }
+        const_iterator cend() const { return rep.end(); }
+
+        // 容量相关
+        bool empty() const { return rep.empty(); }
+        size_type size() const { return rep.size(); }
+        size_type max_size() const { return rep.max_size(); }
+        size_type bucket_count() const { return rep.bucket_count(); }
+        float load_factor() const { return rep.load_factor(); }
+        float max_load_factor() const { return rep.max_load_factor(); }
+        void reserve(size_type n) { rep.reserve(n); }
+        void rehash(size_type n) { rep.rehash(n); }
+
+        // 修改容器操作
+        mystl::pair<iterator, bool> insert(const value_type& obj)
+        {
+            auto r = rep.insert_unique(obj);
+            return mystl::pair<iterator, bool>(r.first, r.second);
+        }
+
+        mystl::pair<iterator, bool> insert(value_type&& obj)
+        {
+            auto r = rep.insert_unique(mystl::move(obj));
+            return mystl::pair<iterator, bool>(r.first, r.second);
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        { rep.insert_unique(first, last); }
+
+        template <class... Args>
+        mystl::pair<iterator, bool> emplace(Args&&... args)
+        {
+            auto r = rep.emplace_unique(mystl::forward<Args>(args)...);
+            return mystl::pair<iterator, bool>(r.first, r.second);
+        }
+
+        iterator erase(const_iterator pos) { return rep.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return rep.erase(first, last); }
+        size_type erase(const key_type& key) { return rep.erase_unique(key); }
+
+        void clear() { rep.clear(); }
+        void swap(flat_hash_set& other) noexcept { rep.swap(other.rep); }
+
+        // 查找操作
+        iterator find(const key_type& key) const { return rep.find(key); }
+        bool contains(const key_type& key) const { return rep.contains(key); }
+        size_type count(const key_type& key) const { return rep.count(key); }
+        mystl::pair<iterator, iterator> equal_range(const key_type& key) const
+        { return rep.equal_range(key); }
+    };
+
+    template <class Value, class HashFcn, class EqualKey, class Alloc>
+    void swap(flat_hash_set<Value, HashFcn, EqualKey, Alloc>& lhs,
+              flat_hash_set<Value, HashFcn, EqualKey, Alloc>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+} // namespace mystl 
@@ -0,0 +1,812 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "expectdef.hpp"
+#include "allocator.hpp"
+#include "iterator.hpp"
+#include "uninitialized.hpp"
+#include "util.hpp"
+#include "functional.hpp"
+
+// 定义 MYSTL_FLAT_HASH_NO_SSE2 可以强制使用可移植的实现
+#if !defined(MYSTL_FLAT_HASH_NO_SSE2) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MYSTL_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // 开放寻址哈希表的控制字节与分组匹配
+    // 每个槽位对应一个控制字节：空、已删除（墓碑）、哨兵，或者存放哈希值低 7 位（H2）表示槽位有元素。
+    // 查找时一次载入 16 个控制字节，与 H2 并行比较得到候选槽位的位掩码，只对候选槽位比较键
+    /*****************************************************************************************/
+    namespace flat_detail
+    {
+        using ctrl_t = signed char;
+
+        constexpr ctrl_t CTRL_EMPTY = -128;    // 0b10000000
+        constexpr ctrl_t CTRL_DELETED = -2;    // 0b11111110
+        constexpr ctrl_t CTRL_SENTINEL = -1;   // 0b11111111，位于最后一个槽位之后，迭代到此结束
+
+        constexpr size_t GROUP_WIDTH = 16;
+
+        // 容量为 0 的表共用的控制字节：哨兵之后全部为空，查找立即结束
+        alignas(16) inline constexpr ctrl_t EMPTY_GROUP[GROUP_WIDTH] = {
+            CTRL_SENTINEL, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY,
+            CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY, CTRL_EMPTY};
+
+        inline bool is_full(ctrl_t c) noexcept { return c >= 0; }
+        inline bool is_empty_or_deleted(ctrl_t c) noexcept { return c < CTRL_SENTINEL; }
+
+        inline unsigned countr_zero32(std::uint32_t x) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctz(x));
+#else
+            unsigned n = 0;
+            while ((x & 1u) == 0) { x >>= 1; ++n; }
+            return n;
+#endif
+        }
+
+        // 组内匹配结果，第 i 位对应组内第 i 个控制字节；可以用范围 for 依次取出为 1 的位置
+        class bitmask
+        {
+        public:
+            explicit bitmask(std::uint32_t bits) noexcept : bits_(bits) {}
+
+            explicit operator bool() const noexcept { return bits_ != 0; }
+
+            // 最低位的 1 的位置，bits 不能为 0
+            unsigned lowest() const noexcept { return countr_zero32(bits_); }
+
+            // 低位连续 0 的个数 / 高位（16 位之内）连续 0 的个数
+            unsigned trailing_zeros() const noexcept { return bits_ ? countr_zero32(bits_) : GROUP_WIDTH; }
+            unsigned leading_zeros() const noexcept
+            {
+                unsigned n = 0;
+                for (std::uint32_t probe = 1u << (GROUP_WIDTH - 1); n < GROUP_WIDTH && !(bits_ & probe); probe >>= 1) ++n;
+                return n;
+            }
+
+            bitmask& operator++() noexcept { bits_ &= bits_ - 1; return *this; }
+            unsigned operator*() const noexcept { return lowest(); }
+            bool operator!=(const bitmask& rhs) const noexcept { return bits_ != rhs.bits_; }
+
+            bitmask begin() const noexcept { return *this; }
+            bitmask end() const noexcept { return bitmask(0); }
+
+            std::uint32_t bits() const noexcept { return bits_; }
+
+        private:
+            std::uint32_t bits_;
+        };
+
+        // 可移植的实现：逐字节比较，不依赖任何指令集
+        struct portable_group
+        {
+            ctrl_t ctrl[GROUP_WIDTH];
+
+            explicit portable_group(const ctrl_t* p) noexcept { std::memcpy(ctrl, p, GROUP_WIDTH); }
+
+            bitmask match(ctrl_t h2) const noexcept
+            {
+                std::uint32_t bits = 0;
+                for (size_t i = 0; i < GROUP_WIDTH; ++i)
+                    bits |= static_cast<std::uint32_t>(ctrl[i] == h2) << i;
+                return bitmask(bits);
+            }
+
+            bitmask match_empty() const noexcept { return match(CTRL_EMPTY); }
+
+            bitmask match_empty_or_deleted() const noexcept
+            {
+                std::uint32_t bits = 0;
+                for (size_t i = 0; i < GROUP_WIDTH; ++i)
+                    bits |= static_cast<std::uint32_t>(ctrl[i] < CTRL_SENTINEL) << i;
+                return bitmask(bits);
+            }
+
+            // 开头连续的空槽位/墓碑个数，迭代时据此跳过
+            unsigned count_leading_empty_or_deleted() const noexcept
+            {
+                unsigned n = 0;
+                while (n < GROUP_WIDTH && ctrl[n] < CTRL_SENTINEL) ++n;
+                return n;
+            }
+        };
+
+#if defined(MYSTL_FLAT_HASH_SSE2)
+        // SSE2 实现：一条比较指令处理 16 个控制字节，movemask 取出每个字节的最高位
+        struct sse2_group
+        {
+            __m128i ctrl;
+
+            explicit sse2_group(const ctrl_t* p) noexcept
+                : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+            bitmask match(ctrl_t h2) const noexcept
+            {
+                return bitmask(static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))));
+            }
+
+            bitmask match_empty() const noexcept { return match(CTRL_EMPTY); }
+
+            // 空与墓碑都小于哨兵（有符号比较）
+            bitmask match_empty_or_deleted() const noexcept
+            {
+                return bitmask(static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CTRL_SENTINEL), ctrl))));
+            }
+
+            unsigned count_leading_empty_or_deleted() const noexcept
+            {
+                const std::uint32_t mask = match_empty_or_deleted().bits();
+                return countr_zero32(mask + 1);
+            }
+        };
+
+        using group = sse2_group;
+#else
+        using group = portable_group;
+#endif
+
+        // H1（高 57 位）决定起始位置，H2（低 7 位）存入控制字节
+        inline size_t h1(size_t hash) noexcept { return hash >> 7; }
+        inline ctrl_t h2(size_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+        // 探测序列：按组跳跃，第 i 次跳 i * GROUP_WIDTH 个槽位（三角数序列），容量为 2^k - 1 时能访问到每一组
+        class probe_seq
+        {
+        public:
+            probe_seq(size_t hash, size_t mask) noexcept : mask_(mask), offset_(hash & mask), index_(0) {}
+
+            size_t offset() const noexcept { return offset_; }
+            size_t offset(size_t i) const noexcept { return (offset_ + i) & mask_; }
+
+            void next() noexcept
+            {
+                index_ += GROUP_WIDTH;
+                offset_ = (offset_ + index_) & mask_;
+            }
+
+        private:
+            size_t mask_;
+            size_t offset_;
+            size_t index_;
+        };
+
+        // 容量总是 2^k - 1 且不小于 GROUP_WIDTH - 1，控制字节可以直接用容量作掩码
+        inline size_t normalize_capacity(size_t n) noexcept
+        {
+            size_t cap = GROUP_WIDTH - 1;
+            while (cap < n) cap = cap * 2 + 1;
+            return cap;
+        }
+
+        // 最大负载因子 7/8
+        inline size_t capacity_to_growth(size_t cap) noexcept { return cap / 8 * 7 + cap % 8 * 7 / 8; }
+
+        // 能容纳 n 个元素的最小容量
+        inline size_t growth_to_capacity(size_t n) noexcept
+        {
+            return n == 0 ? 0 : normalize_capacity(n / 7 * 8 + (n % 7 * 8 + 6) / 7);
+        }
+    } // namespace flat_detail
+
+
+
+    /*****************************************************************************************/
+    // flat_hashtable 的迭代器
+    // 保存控制字节与槽位指针，++ 时按组跳过空槽位与墓碑，遇到哨兵即为 end
+    /*****************************************************************************************/
+    template <class T>
+    class flat_hashtable_iterator
+    {
+        template <class U>
+        friend class flat_hashtable_iterator;
+
+        template <class Value, class Key, class HashFcn, class ExtractKey, class EqualKey, class Alloc>
+        friend class flat_hashtable;
+
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = remove_cv_t<T>;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = ptrdiff_t;
+        using size_type = size_t;
+
+        flat_hashtable_iterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+
+        // 转换为 const 迭代器
+        operator flat_hashtable_iterator<const T>() const noexcept
+        {
+            return flat_hashtable_iterator<const T>(ctrl_, slot_);
+        }
+
+        reference operator*() const noexcept { return *slot_; }
+        pointer operator->() const noexcept { return slot_; }
+
+        flat_hashtable_iterator& operator++() noexcept
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+
+        flat_hashtable_iterator operator++(int) noexcept
+        {
+            flat_hashtable_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        template <class U>
+        bool operator==(const flat_hashtable_iterator<U>& rhs) const noexcept { return ctrl_ == rhs.ctrl_; }
+
+        template <class U>
+        bool operator!=(const flat_hashtable_iterator<U>& rhs) const noexcept { return ctrl_ != rhs.ctrl_; }
+
+    private:
+        flat_hashtable_iterator(const flat_detail::ctrl_t* ctrl, T* slot) noexcept
+            : ctrl_(ctrl), slot_(slot) {}
+
+        void skip_empty_or_deleted() noexcept
+        {
+            while (flat_detail::is_empty_or_deleted(*ctrl_))
+            {
+                const unsigned shift = flat_detail::group(ctrl_).count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+        }
+
+        const flat_detail::ctrl_t* ctrl_;  // 当前槽位的控制字节
+        T* slot_;                          // 当前槽位
+    };
+
+
+
+    /*****************************************************************************************/
+    // flat_hashtable 的实现（Swiss table 式的开放寻址）
+    // 元素直接存放在槽位数组中，没有节点分配；查找时先按 H1 定位到一组控制字节，
+    // 用 H2 一次筛选 16 个槽位，再比较候选键。组内有空槽位即说明键不存在，查找结束。
+    // 删除时若所在位置从未让探测越过（前后两组连续的非空槽位不足一组），直接标记为空，否则留下墓碑；
+    // 墓碑在扩容或重哈希时清除，墓碑过多时以相同容量重建。
+    // 槽位数组与控制字节共用一次分配：capacity 个槽位之后是 capacity + 1 + 15 个控制字节，
+    // 最后 15 个复制开头的控制字节，从任何位置开始载入一组都不会越界
+    /*****************************************************************************************/
+    template <class Value, class Key, class HashFcn,
+              class ExtractKey, class EqualKey,
+              class Alloc = mystl::allocator<Value>>
+    class flat_hashtable
+    {
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using hasher = HashFcn;
+        using key_equal = EqualKey;
+
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        using allocator_type = Alloc;
+
+        using iterator = flat_hashtable_iterator<value_type>;
+        using const_iterator = flat_hashtable_iterator<const value_type>;
+
+    private:
+        using ctrl_t = flat_detail::ctrl_t;
+        using hash_allocator = typename Alloc::template rebind<size_type>::other;
+
+        ctrl_t* ctrl_;            // 控制字节，容量为 0 时指向共享的 EMPTY_GROUP
+        pointer slots_;           // 槽位数组
+        size_type size_;          // 元素个数
+        size_type capacity_;      // 槽位个数，0 或 2^k - 1
+        size_type growth_left_;   // 不超过最大负载因子的前提下还能占用的空槽位个数
+        hasher hash_;
+        key_equal equals_;
+        ExtractKey get_key_;
+        allocator_type alloc_;
+
+    public:
+        // 构造函数，n 为预计的元素个数，0 表示第一次插入时才分配
+        explicit flat_hashtable(size_type n = 0,
+                                const hasher& hf = hasher(),
+                                const key_equal& eql = key_equal(),
+                                const allocator_type& alloc = allocator_type())
+            : ctrl_(empty_ctrl()), slots_(nullptr), size_(0), capacity_(0), growth_left_(0),
+              hash_(hf), equals_(eql), get_key_(ExtractKey()), alloc_(alloc)
+        {
+            reserve(n);
+        }
+
+        flat_hashtable(const flat_hashtable& other)
+            : flat_hashtable(0, other.hash_, other.equals_, other.alloc_)
+        {
+            reserve(other.size_);
+            for (const auto& v : other)
+            {
+                insert_new(v);
+            }
+        }
+
+        // 移动后 other 为空表，仍可继续使用
+        flat_hashtable(flat_hashtable&& other) noexcept
+            : ctrl_(other.ctrl_), slots_(other.slots_), size_(other.size_), capacity_(other.capacity_),
+              growth_left_(other.growth_left_), hash_(other.hash_), equals_(other.equals_),
+              get_key_(other.get_key_), alloc_(other.alloc_)
+        {
+            other.reset_to_empty();
+        }
+
+        ~flat_hashtable()
+        {
+            destroy_slots();
+            deallocate_storage();
+        }
+
+        flat_hashtable& operator=(const flat_hashtable& other)
+        {
+            if (this != &other)
+            {
+                flat_hashtable tmp(other);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        flat_hashtable& operator=(flat_hashtable&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy_slots();
+                deallocate_storage();
+                reset_to_empty();
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(flat_hashtable& other) noexcept
+        {
+            mystl::swap(ctrl_, other.ctrl_);
+            mystl::swap(slots_, other.slots_);
+            mystl::swap(size_, other.size_);
+            mystl::swap(capacity_, other.capacity_);
+            mystl::swap(growth_left_, other.growth_left_);
+            mystl::swap(hash_, other.hash_);
+            mystl::swap(equals_, other.equals_);
+            mystl::swap(get_key_, other.get_key_);
+            mystl::swap(alloc_, other.alloc_);
+        }
+
+        allocator_type get_allocator() const noexcept { return alloc_; }
+        hasher hash_function() const { return hash_; }
+        key_equal key_eq() const { return equals_; }
+
+        // 迭代器相关
+        iterator begin() noexcept
+        {
+            iterator it(ctrl_, slots_);
+            it.skip_empty_or_deleted();
+            return it;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            const_iterator it(ctrl_, slots_);
+            it.skip_empty_or_deleted();
+            return it;
+        }
+
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator(ctrl_ + capacity_, slots_ + capacity_); }
+        const_iterator end() const noexcept { return const_iterator(ctrl_ + capacity_, slots_ + capacity_); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // 容量相关
+        size_type size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_type max_size() const noexcept { return mystl::max_size(alloc_) / 2; }
+        size_type bucket_count() const noexcept { return capacity_; }
+        float load_factor() const noexcept { return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f; }
+        float max_load_factor() const noexcept { return 7.0f / 8.0f; }
+
+        // 保证插入 n 个元素之前不再重哈希
+        void reserve(size_type n)
+        {
+            if (n > size_ + growth_left_)
+            {
+                resize(flat_detail::growth_to_capacity(n));
+            }
+        }
+
+        // 重建为至少能容纳 max(n, size()) 个元素的最小容量，同时清除所有墓碑；n 为 0 且表为空时释放存储空间
+        void rehash(size_type n)
+        {
+            if (n == 0 && size_ == 0)
+            {
+                destroy_slots();
+                deallocate_storage();
+                reset_to_empty();
+                return;
+            }
+            const size_type need = flat_detail::growth_to_capacity(n > size_ ? n : size_);
+            resize(need);
+        }
+
+        // 插入操作：键已存在时不插入，返回已有元素
+        mystl::pair<iterator, bool> insert_unique(const value_type& obj)
+        {
+            return emplace_key(get_key_(obj), obj);
+        }
+
+        mystl::pair<iterator, bool> insert_unique(value_type&& obj)
+        {
+            return emplace_key(get_key_(obj), mystl::move(obj));
+        }
+
+        template <class InputIt>
+        void insert_unique(InputIt first, InputIt last)
+        {
+            if constexpr (is_forward_iterator<InputIt>::value)
+            {
+                reserve(size_ + static_cast<size_type>(mystl::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                insert_unique(*first);
+            }
+        }
+
+        // 先构造元素再查找，键已存在时销毁新构造的元素
+        template <class... Args>
+        mystl::pair<iterator, bool> emplace_unique(Args&&... args)
+        {
+            value_type tmp(mystl::forward<Args>(args)...);
+            return emplace_key(get_key_(tmp), mystl::move(tmp));
+        }
+
+        // 键为 key 的元素不存在时用 args 构造一个（args 构造出的元素的键必须等于 key）
+        template <class... Args>
+        mystl::pair<iterator, bool> emplace_key(const key_type& key, Args&&... args)
+        {
+            return emplace_key_with(key, [&] { return value_type(mystl::forward<Args>(args)...); });
+        }
+
+        // 键为 key 的元素不存在时才调用 make() 构造一个，键已存在时 make 不会被调用（make() 返回的元素的键必须等于 key）
+        template <class Make>
+        mystl::pair<iterator, bool> emplace_key_with(const key_type& key, Make&& make)
+        {
+            const size_type hash = hash_key(key);
+            const size_type found = find_index(key, hash);
+            if (found != capacity_)
+            {
+                return mystl::pair<iterator, bool>(iterator_at(found), false);
+            }
+            size_type index = find_first_non_full(hash);
+            if (need_grow(index))
+            {
+                // 参数可能引用表中的元素，扩容前先构造出新元素
+                value_type tmp(make());
+                rehash_and_grow_if_necessary();
+                index = find_first_non_full(hash);
+                mystl::construct(slots_ + index, mystl::move(tmp));
+            }
+            else
+            {
+                ::new ((void*)(slots_ + index)) value_type(make());
+            }
+            commit_insert(index, hash);
+            return mystl::pair<iterator, bool>(iterator_at(index), true);
+        }
+
+        // 删除操作
+        iterator erase(const_iterator pos)
+        {
+            const size_type index = static_cast<size_type>(pos.ctrl_ - ctrl_);
+            erase_at(index);
+            iterator next = iterator_at(index);
+            ++next;
+            return next;
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator_at(static_cast<size_type>(last.ctrl_ - ctrl_));
+        }
+
+        size_type erase_unique(const key_type& key)
+        {
+            const size_type index = find_index(key, hash_key(key));
+            if (index == capacity_) return 0;
+            erase_at(index);
+            return 1;
+        }
+
+        // 清空元素，保留存储空间
+        void clear() noexcept
+        {
+            if (capacity_ == 0) return;
+            destroy_slots();
+            reset_ctrl();
+        }
+
+        // 查找操作
+        iterator find(const key_type& key)
+        {
+            return iterator_at(find_index(key, hash_key(key)));
+        }
+
+        const_iterator find(const key_type& key) const
+        {
+            return const_iterator_at(find_index(key, hash_key(key)));
+        }
+
+        bool contains(const key_type& key) const
+        {
+            return find_index(key, hash_key(key)) != capacity_;
+        }
+
+        size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+        mystl::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            iterator first = find(key);
+            iterator last = first;
+            if (last != end()) ++last;
+            return mystl::pair<iterator, iterator>(first, last);
+        }
+
+        mystl::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            const_iterator first = find(key);
+            const_iterator last = first;
+            if (last != end()) ++last;
+            return mystl::pair<const_iterator, const_iterator>(first, last);
+        }
+
+    private:
+        //------------------------------------------------------------------------------
+        // 辅助函数
+        //------------------------------------------------------------------------------
+
+        static ctrl_t* empty_ctrl() noexcept { return const_cast<ctrl_t*>(flat_detail::EMPTY_GROUP); }
+
+        // 用户哈希值先经过 hash_mix：用户提供的哈希函数可能是恒等映射，不混合的话小整数的 H2 全部相同，每次探测都要比较整组键。
+        // is_avalanching 的哈希函数（如 mystl::hash）输出已经混合，不再重复
+        size_type hash_key(const key_type& key) const
+        {
+            if constexpr (is_avalanching<hasher>::value)
+            {
+                return hash_(key);
+            }
+            else
+            {
+                return mystl::hash_mix(hash_(key));
+            }
+        }
+
+        iterator iterator_at(size_type i) noexcept { return iterator(ctrl_ + i, slots_ + i); }
+        const_iterator const_iterator_at(size_type i) const noexcept { return const_iterator(ctrl_ + i, slots_ + i); }
+
+        // 槽位与控制字节合在一起需要的 value_type 个数
+        static size_type storage_units(size_type cap) noexcept
+        {
+            const size_type ctrl_bytes = cap + flat_detail::GROUP_WIDTH;
+            return cap + (ctrl_bytes + sizeof(value_type) - 1) / sizeof(value_type);
+        }
+
+        void reset_to_empty() noexcept
+        {
+            ctrl_ = empty_ctrl();
+            slots_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+            growth_left_ = 0;
+        }
+
+        // 所有槽位标记为空，末尾放置哨兵
+        void reset_ctrl() noexcept
+        {
+            std::memset(ctrl_, flat_detail::CTRL_EMPTY, capacity_ + flat_detail::GROUP_WIDTH);
+            ctrl_[capacity_] = flat_detail::CTRL_SENTINEL;
+            size_ = 0;
+            growth_left_ = flat_detail::capacity_to_growth(capacity_);
+        }
+
+        void destroy_slots() noexcept
+        {
+            if constexpr (!is_trivially_destructible<value_type>::value)
+            {
+                for (size_type i = 0; i < capacity_; ++i)
+                {
+                    if (flat_detail::is_full(ctrl_[i])) mystl::destroy_at(slots_ + i);
+                }
+            }
+        }
+
+        void deallocate_storage() noexcept
+        {
+            if (capacity_ != 0)
+            {
+                alloc_.deallocate(slots_, storage_units(capacity_));
+            }
+        }
+
+        // 设置控制字节，同时更新末尾的副本
+        void set_ctrl(size_type i, ctrl_t h) noexcept
+        {
+            constexpr size_type cloned = flat_detail::GROUP_WIDTH - 1;
+            ctrl_[i] = h;
+            ctrl_[((i - cloned) & capacity_) + cloned] = h;
+        }
+
+        // 查找键为 key 的元素的下标，不存在时返回 capacity_
+        size_type find_index(const key_type& key, size_type hash) const
+        {
+            flat_detail::probe_seq seq(flat_detail::h1(hash), capacity_);
+            const ctrl_t h2 = flat_detail::h2(hash);
+            while (true)
+            {
+                flat_detail::group g(ctrl_ + seq.offset());
+                for (unsigned i : g.match(h2))
+                {
+                    const size_type index = seq.offset(i);
+                    if (equals_(get_key_(slots_[index]), key)) return index;
+                }
+                if (g.match_empty()) return capacity_;
+                seq.next();
+            }
+        }
+
+        // 探测序列上第一个空槽位或墓碑
+        size_type find_first_non_full(size_type hash) const noexcept
+        {
+            flat_detail::probe_seq seq(flat_detail::h1(hash), capacity_);
+            while (true)
+            {
+                flat_detail::group g(ctrl_ + seq.offset());
+                auto mask = g.match_empty_or_deleted();
+                if (mask) return seq.offset(mask.lowest());
+                seq.next();
+            }
+        }
+
+        // 槽位已经用完（墓碑可以直接复用）时需要先扩容或重建
+        bool need_grow(size_type index) const noexcept
+        {
+            return growth_left_ == 0 && ctrl_[index] != flat_detail::CTRL_DELETED;
+        }
+
+        // 新元素构造成功后才标记槽位，构造失败时表不变
+        void commit_insert(size_type index, size_type hash) noexcept
+        {
+            growth_left_ -= ctrl_[index] == flat_detail::CTRL_EMPTY;
+            set_ctrl(index, flat_detail::h2(hash));
+            ++size_;
+        }
+
+        // 复制构造时插入已知不重复的元素
+        void insert_new(const value_type& obj)
+        {
+            const size_type hash = hash_key(get_key_(obj));
+            size_type index = find_first_non_full(hash);
+            if (need_grow(index))
+            {
+                rehash_and_grow_if_necessary();
+                index = find_first_non_full(hash);
+            }
+            mystl::construct(slots_ + index, obj);
+            commit_insert(index, hash);
+        }
+
+        // 墓碑占去大量空间（元素不超过容量的 25/32）时以相同容量重建，否则容量翻倍
+        void rehash_and_grow_if_necessary()
+        {
+            if (capacity_ > flat_detail::GROUP_WIDTH && size_ * 32 <= capacity_ * 25)
+            {
+                resize(capacity_);
+            }
+            else
+            {
+                if (capacity_ >= max_size())
+                {
+                    throw length_error("flat_hashtable too long");
+                }
+                resize(capacity_ == 0 ? flat_detail::GROUP_WIDTH - 1 : capacity_ * 2 + 1);
+            }
+        }
+
+        // 搬到容量为 new_cap 的新存储空间，墓碑全部清除；哈希函数或元素的复制抛出异常时原表不变。
+        // 元素的移动不抛出异常时会被移走，所以哈希函数可能抛出异常时先算出所有哈希值，再搬迁元素
+        void resize(size_type new_cap)
+        {
+            flat_hashtable tmp(0, hash_, equals_, alloc_);
+            pointer new_slots = tmp.alloc_.allocate(storage_units(new_cap));
+            tmp.ctrl_ = reinterpret_cast<ctrl_t*>(new_slots + new_cap);
+            tmp.slots_ = new_slots;
+            tmp.capacity_ = new_cap;
+            tmp.reset_ctrl();
+            // 失败时 tmp 的析构函数销毁已搬迁的元素并释放新空间
+            if constexpr (noexcept(std::declval<const hasher&>()(std::declval<const key_type&>())))
+            {
+                for (size_type i = 0; i < capacity_; ++i)
+                {
+                    if (flat_detail::is_full(ctrl_[i])) tmp.relocate_from(slots_[i], hash_key(get_key_(slots_[i])));
+                }
+            }
+            else if (size_ != 0)
+            {
+                hash_allocator hash_alloc(alloc_);
+                size_type* hashes = hash_alloc.allocate(size_);
+                try
+                {
+                    size_type n = 0;
+                    for (size_type i = 0; i < capacity_; ++i)
+                    {
+                        if (flat_detail::is_full(ctrl_[i])) hashes[n++] = hash_key(get_key_(slots_[i]));
+                    }
+                    n = 0;
+                    for (size_type i = 0; i < capacity_; ++i)
+                    {
+                        if (flat_detail::is_full(ctrl_[i])) tmp.relocate_from(slots_[i], hashes[n++]);
+                    }
+                }
+                catch (...)
+                {
+                    hash_alloc.deallocate(hashes, size_);
+                    throw;
+                }
+                hash_alloc.deallocate(hashes, size_);
+            }
+            swap(tmp);
+        }
+
+        // 重哈希时把另一张表的元素搬进来；元素的移动可能抛出异常时复制，原元素保持不变
+        void relocate_from(value_type& obj, size_type hash)
+        {
+            const size_type index = find_first_non_full(hash);
+            mystl::construct(slots_ + index, mystl::move_if_noexcept(obj));
+            commit_insert(index, hash);
+        }
+
+        // 删除下标 index 的元素：前后两组中围绕该位置的连续非空槽位不足一组时，
+        // 没有探测序列会越过这里，可以直接标记为空，否则留下墓碑
+        void erase_at(size_type index) noexcept
+        {
+            mystl::destroy_at(slots_ + index);
+            --size_;
+            const size_type index_before = (index - flat_detail::GROUP_WIDTH) & capacity_;
+            const auto empty_after = flat_detail::group(ctrl_ + index).match_empty();
+            const auto empty_before = flat_detail::group(ctrl_ + index_before).match_empty();
+            const bool was_never_full = empty_before && empty_after &&
+                empty_after.trailing_zeros() + empty_before.leading_zeros() < flat_detail::GROUP_WIDTH;
+            set_ctrl(index, was_never_full ? flat_detail::CTRL_EMPTY : flat_detail::CTRL_DELETED);
+            growth_left_ += was_never_full;
+        }
+    };
+
+    template <class V, class K, class HF, class ExK, class EqK, class A>
+    void swap(flat_hashtable<V, K, HF, ExK, EqK, A>& lhs, flat_hashtable<V, K, HF, ExK, EqK, A>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
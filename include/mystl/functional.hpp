@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "util.hpp"
+
 namespace mystl 
 {
 
@@ -231,26 +237,239 @@ namespace mystl
         Arg2 operator()(const Arg1&, const Arg2& y) const { return y; }
     };
 
-    // 添加基础类型的哈希函数
+    /*****************************************************************************************/
+    // 哈希函数
+    // 整数、指针、浮点数先取出位模式再经过 hash_mix；字节序列（字符串）使用 hash_bytes；
+    // pair / tuple 用 hash_combine 按顺序组合各成员的哈希值
+    /*****************************************************************************************/
+    namespace hash_detail
+    {
+        // 来自 wyhash 的常数：奇数，且每个字节中置位的个数均为 4
+        constexpr std::uint64_t P0 = 0xa0761d6478bd642fULL;
+        constexpr std::uint64_t P1 = 0xe7037ed1a0b428dbULL;
+        constexpr std::uint64_t P2 = 0x8ebc6af09c88c6e3ULL;
+        constexpr std::uint64_t P3 = 0x589965cc75374cc3ULL;
+        constexpr std::uint64_t GOLDEN = 0x9E3779B97F4A7C15ULL;   // 2^64 / φ
+
+        // 64 位乘 64 位得到 128 位乘积，a 为低 64 位，b 为高 64 位
+        inline void mum(std::uint64_t& a, std::uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<std::uint64_t>(p);
+            b = static_cast<std::uint64_t>(p >> 64);
+#else
+            const std::uint64_t ha = a >> 32, la = static_cast<std::uint32_t>(a);
+            const std::uint64_t hb = b >> 32, lb = static_cast<std::uint32_t>(b);
+            const std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+            const std::uint64_t mid = (ll >> 32) + static_cast<std::uint32_t>(hl) + static_cast<std::uint32_t>(lh);
+            a = (mid << 32) | static_cast<std::uint32_t>(ll);
+            b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+        }
+
+        // 128 位乘积的高低两半异或
+        inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept
+        {
+            mum(a, b);
+            return a ^ b;
+        }
+
+        // 按小端序读取，不要求对齐；大端平台上结果不同，但同一平台内一致
+        inline std::uint64_t read64(const unsigned char* p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline std::uint64_t read32(const unsigned char* p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+    } // namespace hash_detail
+
+    // 哈希值混合：乘以 2^64 / φ 后把 128 位乘积的高低两半异或，输入的每一位都会影响输出的高位和低位。
+    // 整数的默认哈希就是它；用户提供的哈希函数可能是恒等映射，按掩码取低位或取高 7 位作标记的哈希表还会再混合一次
+    inline size_t hash_mix(size_t h) noexcept
+    {
+        return static_cast<size_t>(hash_detail::mix(static_cast<std::uint64_t>(h), hash_detail::GOLDEN));
+    }
+
+    // 字节序列的哈希（wyhash 的结构）：
+    // 不超过 16 字节时用几次可能重叠的读取覆盖全部字节，没有循环与分支预测失败；
+    // 超过 48 字节时三条互不依赖的乘法链并行处理，每轮 48 字节，吞吐量受乘法器而不是延迟限制
+    inline size_t hash_bytes(const void* data, size_t len, std::uint64_t seed = 0) noexcept
+    {
+        using namespace hash_detail;
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        seed ^= mix(seed ^ P0, P1);
+        std::uint64_t a, b;
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                const size_t off = (len >> 3) << 2;
+                a = (read32(p) << 32) | read32(p + off);
+                b = (read32(p + len - 4) << 32) | read32(p + len - 4 - off);
+            }
+            else if (len > 0)
+            {
+                a = (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            size_t i = len;
+            if (i > 48)
+            {
+                std::uint64_t s1 = seed, s2 = seed;
+                do
+                {
+                    seed = mix(read64(p) ^ P1, read64(p + 8) ^ seed);
+                    s1 = mix(read64(p + 16) ^ P2, read64(p + 24) ^ s1);
+                    s2 = mix(read64(p + 32) ^ P3, read64(p + 40) ^ s2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= s1 ^ s2;
+            }
+            while (i > 16)
+            {
+                seed = mix(read64(p) ^ P1, read64(p + 8) ^ seed);
+                p += 16;
+                i -= 16;
+            }
+            // 最后 16 字节从末尾往前读，可能与已处理的部分重叠
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+        a ^= P1;
+        b ^= seed;
+        mum(a, b);
+        return static_cast<size_t>(mix(a ^ P0 ^ len, b ^ P1));
+    }
+
+    // 把 h 并入已有的哈希值 seed；两个参数的地位不对称，组合的顺序影响结果
+    inline size_t hash_combine(size_t seed, size_t h) noexcept
+    {
+        return static_cast<size_t>(hash_detail::mix(static_cast<std::uint64_t>(seed) ^ hash_detail::P0,
+                                                    static_cast<std::uint64_t>(h) ^ hash_detail::P1));
+    }
+
     template <class Key>
     struct hash {};
 
+    // 按顺序组合多个值的哈希值
+    template <class... Ts>
+    size_t hash_values(const Ts&... values)
+    {
+        size_t seed = 0;
+        ((seed = hash_combine(seed, hash<Ts>()(values))), ...);
+        return seed;
+    }
+
+    // 整数类型
+    template <class T>
+    struct integral_hash
+    {
+        size_t operator()(T x) const noexcept { return hash_mix(static_cast<size_t>(x)); }
+    };
+
+#define MYSTL_INTEGRAL_HASH(T) \
+    template <> struct hash<T> : integral_hash<T> {};
+
+    MYSTL_INTEGRAL_HASH(bool)
+    MYSTL_INTEGRAL_HASH(char)
+    MYSTL_INTEGRAL_HASH(signed char)
+    MYSTL_INTEGRAL_HASH(unsigned char)
+    MYSTL_INTEGRAL_HASH(wchar_t)
+    MYSTL_INTEGRAL_HASH(char16_t)
+    MYSTL_INTEGRAL_HASH(char32_t)
+    MYSTL_INTEGRAL_HASH(short)
+    MYSTL_INTEGRAL_HASH(unsigned short)
+    MYSTL_INTEGRAL_HASH(int)
+    MYSTL_INTEGRAL_HASH(unsigned int)
+    MYSTL_INTEGRAL_HASH(long)
+    MYSTL_INTEGRAL_HASH(unsigned long)
+    MYSTL_INTEGRAL_HASH(long long)
+    MYSTL_INTEGRAL_HASH(unsigned long long)
+
+#undef MYSTL_INTEGRAL_HASH
+
+    // 指针按地址哈希
+    template <class T>
+    struct hash<T*>
+    {
+        size_t operator()(T* p) const noexcept { return hash_mix(reinterpret_cast<std::uintptr_t>(p)); }
+    };
+
+    // 浮点数按位模式哈希；+0.0 与 -0.0 相等，统一映射为 0
     template <>
-    struct hash<int>
+    struct hash<float>
     {
-        size_t operator()(int x) const { return x; }
+        size_t operator()(float x) const noexcept
+        {
+            if (x == 0.0f) return 0;
+            std::uint32_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            return hash_mix(bits);
+        }
     };
 
     template <>
-    struct hash<long>
+    struct hash<double>
     {
-        size_t operator()(long x) const { return x; }
+        size_t operator()(double x) const noexcept
+        {
+            if (x == 0.0) return 0;
+            std::uint64_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            return hash_mix(static_cast<size_t>(bits));
+        }
     };
 
+    // long double 的位模式含有未定义的填充字节，转换为 double 再哈希：相等的值哈希值一定相等
     template <>
-    struct hash<size_t>
+    struct hash<long double>
     {
-        size_t operator()(size_t x) const { return x; }
+        size_t operator()(long double x) const noexcept { return hash<double>()(static_cast<double>(x)); }
     };
 
+    template <class T1, class T2>
+    struct hash<mystl::pair<T1, T2>>
+    {
+        size_t operator()(const mystl::pair<T1, T2>& p) const { return hash_values(p.first, p.second); }
+    };
+
+    template <class... Ts>
+    struct hash<std::tuple<Ts...>>
+    {
+        size_t operator()(const std::tuple<Ts...>& t) const
+        {
+            return std::apply([](const Ts&... values) { return hash_values(values...); }, t);
+        }
+    };
+
+    // 哈希函数的输出是否已经充分混合（每一位输入都影响输出的每一位），是的话哈希表不再调用 hash_mix。
+    // 算术类型、指针、pair / tuple 和字符串的 mystl::hash 都是；也可以为自己的哈希函数特化
+    template <class HashFcn>
+    struct is_avalanching : mystl::false_type {};
+
+    template <class T>
+    struct is_avalanching<hash<T>> : mystl::bool_constant<mystl::is_arithmetic<T>::value || mystl::is_pointer<T>::value> {};
+
+    template <class T1, class T2>
+    struct is_avalanching<hash<mystl::pair<T1, T2>>> : mystl::true_type {};
+
+    template <class... Ts>
+    struct is_avalanching<hash<std::tuple<Ts...>>> : mystl::true_type {};
+
 } // namespace mystl
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "allocator.hpp"
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // 增长策略
+    // vector、string 需要扩容时调用 GrowthPolicy::next_capacity(capacity, required, elem_size)，
+    // 返回不小于 required 的新容量（元素个数）。capacity 为当前容量，elem_size 为每个元素的字节数
+    /*****************************************************************************************/
+
+    constexpr size_t GROWTH_PAGE_SIZE = 4096;             // 按页取整时的页大小
+    constexpr size_t GROWTH_MMAP_THRESHOLD = 128 * 1024;  // 不小于该值的块由 malloc 直接 mmap，按页交付
+
+    namespace growth_detail
+    {
+        // 按 factor_num / factor_den 倍增长，不足 required 时取 required；乘法溢出时退化为 required
+        template<size_t FactorNum, size_t FactorDen>
+        inline size_t scaled(size_t capacity, size_t required, size_t elem_size) noexcept
+        {
+            const size_t limit = static_cast<size_t>(-1) / elem_size / FactorNum;
+            if (capacity > limit) return required;
+            const size_t grown = capacity * FactorNum / FactorDen;
+            return grown > required ? grown : required;
+        }
+    } // namespace growth_detail
+
+    // 两倍增长：摊还复制次数最少，但最多浪费一半容量，且大数组扩容时新旧两块同时存在，峰值约为 3 倍
+    struct growth_x2
+    {
+        static size_t next_capacity(size_t capacity, size_t required, size_t elem_size) noexcept
+        {
+            if (capacity == 0) return required > 1 ? required : 1;
+            return growth_detail::scaled<2, 1>(capacity, required, elem_size);
+        }
+    };
+
+    // 1.5 倍增长：浪费的容量与扩容峰值更小，且释放的旧块之和最终能容纳新块，利于分配器复用
+    struct growth_x1_5
+    {
+        static size_t next_capacity(size_t capacity, size_t required, size_t elem_size) noexcept
+        {
+            if (capacity < 2) return required > 2 ? required : 2;
+            return growth_detail::scaled<3, 2>(capacity, required, elem_size);
+        }
+    };
+
+    // 1.5 倍增长后把字节数向上取整到分配器实际交付的大小：
+    // 内存池的小块和 malloc 的中等块取整到 ALIGN 的倍数（尺寸等级 / malloc 的块粒度），
+    // mmap 的大块取整到页。取整多出的部分本来就会被浪费，计入容量后可以直接使用
+    struct growth_size_class
+    {
+        static size_t round_bytes(size_t bytes) noexcept
+        {
+            if (bytes < GROWTH_MMAP_THRESHOLD)
+                return MemoryPool<char>::align_up(bytes);
+            if (bytes > static_cast<size_t>(-1) - GROWTH_PAGE_SIZE)
+                return bytes;
+            return (bytes + GROWTH_PAGE_SIZE - 1) & ~(GROWTH_PAGE_SIZE - 1);
+        }
+
+        static size_t next_capacity(size_t capacity, size_t required, size_t elem_size) noexcept
+        {
+            const size_t n = growth_x1_5::next_capacity(capacity, required, elem_size);
+            if (n > static_cast<size_t>(-1) / elem_size) return n;
+            return round_bytes(n * elem_size) / elem_size;
+        }
+    };
+
+    // 未指定增长策略时使用的默认值
+    using default_growth_policy = growth_x2;
+} // namespace mystl
@@ -1,14 +1,17 @@
 #pragma once
+#include <cmath>
+#include "expectdef.hpp"
 #include "allocator.hpp"
 #include "vector.hpp"
 #include "util.hpp"
 #include "functional.hpp"
+#include "bucket_policy.hpp"
 
 namespace mystl 
 {
 
     // 哈希表节点
-    template <class T>
+    template <class T, bool CacheHash = false>
     struct hashtable_node 
     {
         hashtable_node* next;   // 指向下一个节点
@@ -18,22 +21,43 @@ namespace mystl
         hashtable_node(const T& v) : next(nullptr), value(v) {}
     };
 
+    // 保存完整哈希值的节点：重哈希和迭代时不再调用哈希函数，查找时先比较哈希值再调用 equals_
+    template <class T>
+    struct hashtable_node<T, true>
+    {
+        hashtable_node* next;   // 指向下一个节点
+        size_t hash;            // 键的哈希值
+        T value;                // 节点值
+
+        hashtable_node() = default;
+        hashtable_node(const T& v) : next(nullptr), hash(0), value(v) {}
+    };
+
+    // 哈希函数是否便宜到不必在节点中保存哈希值：内置算术类型和指针的 mystl::hash 只是一次乘法，
+    // 其余哈希函数（字符串、组合类型、用户自定义）默认保存。也可以为自己的哈希函数特化
+    template <class HashFcn>
+    struct is_fast_hash : mystl::false_type {};
+
+    template <class T>
+    struct is_fast_hash<mystl::hash<T>>
+        : mystl::bool_constant<mystl::is_arithmetic<T>::value || mystl::is_pointer<T>::value> {};
+
     // 前向声明哈希表
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
     class hashtable;
 
     // 迭代器基类
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
     struct hashtable_iterator_base
     {
-        using hashtable = mystl::hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
+        using hashtable = mystl::hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
         using iterator_category = forward_iterator_tag;
         using value_type = Value;
         using difference_type = ptrdiff_t;
         using size_type = size_t;
-        using node = hashtable_node<Value>;
+        using node = hashtable_node<Value, CacheHash>;
 
         node* cur;
         hashtable* ht;
@@ -44,12 +68,12 @@ namespace mystl
 
     // 哈希表迭代器
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
     struct hashtable_iterator 
     {
-        using node = hashtable_node<Value>;
-        using self = hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
-        using hashtable = mystl::hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
+        using node = hashtable_node<Value, CacheHash>;
+        using self = hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
+        using hashtable = mystl::hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
         using iterator_category = forward_iterator_tag;
         using value_type = Value;
         using pointer = Value*;
@@ -77,10 +101,10 @@ namespace mystl
 
     // const 迭代器
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
-    struct hashtable_const_iterator : public hashtable_iterator_base<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
+    struct hashtable_const_iterator : public hashtable_iterator_base<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>
     {
-        using base = hashtable_iterator_base<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
+        using base = hashtable_iterator_base<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
         using hashtable = typename base::hashtable;
         using node = typename base::node;
         using reference = const Value&;
@@ -93,7 +117,7 @@ namespace mystl
         hashtable_const_iterator() {}
         hashtable_const_iterator(const node* n, const hashtable* tab) 
             : base(const_cast<node*>(n), const_cast<hashtable*>(tab)) {}
-        hashtable_const_iterator(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>& it)
+        hashtable_const_iterator(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>& it)
             : base(it.cur, it.ht) {}
 
         reference operator*() const { return cur->value; }
@@ -105,11 +129,11 @@ namespace mystl
         bool operator==(const self& rhs) const { return cur == rhs.cur; }
         bool operator!=(const self& rhs) const { return cur != rhs.cur; }
 
-        bool operator==(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>& rhs) const 
+        bool operator==(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>& rhs) const 
         { 
             return cur == rhs.cur; 
         }
-        bool operator!=(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>& rhs) const 
+        bool operator!=(const hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>& rhs) const 
         { 
             return cur != rhs.cur; 
         }
@@ -118,11 +142,13 @@ namespace mystl
     // 哈希表
     template <class Value, class Key, class HashFcn,
               class ExtractKey, class EqualKey,
-              class Alloc = mystl::allocator<Value>>
+              class Alloc = mystl::allocator<Value>,
+              class BucketPolicy = default_bucket_policy,
+              bool CacheHash = !is_fast_hash<HashFcn>::value>
     class hashtable 
     {
-        friend struct hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
-        friend struct hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
+        friend struct hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
+        friend struct hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
 
     public:
         using key_type = Key;
@@ -137,24 +163,89 @@ namespace mystl
         using reference = value_type&;
         using const_reference = const value_type&;
 
-        using node_type = hashtable_node<Value>;
+        using allocator_type = Alloc;
+        using bucket_policy = BucketPolicy;
+        using node_type = hashtable_node<Value, CacheHash>;
         using node_allocator = typename Alloc::template rebind<node_type>::other;
+        using bucket_allocator = typename Alloc::template rebind<node_type*>::other;
+        using bucket_type = mystl::vector<node_type*, bucket_allocator>;
+        using hash_allocator = typename Alloc::template rebind<size_type>::other;
 
-        using iterator = hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
-        using const_iterator = hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
+        using iterator = hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
+        using const_iterator = hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>;
 
     public:
         // 构造函数
         explicit hashtable(size_type n = 100,
                           const hasher& hf = hasher(),
-                          const key_equal& eql = key_equal())
-            : hash_(hf), equals_(eql), get_key_(ExtractKey()), num_elements_(0)
+                          const key_equal& eql = key_equal(),
+                          const allocator_type& alloc = allocator_type())
+            : hash_(hf), equals_(eql), get_key_(ExtractKey()),
+              node_alloc_(alloc), buckets_(bucket_allocator(alloc)), num_elements_(0),
+              max_load_factor_(1.0f)
         {
             initialize_buckets(n);
         }
-        
+
+        hashtable(const hashtable& other) : hashtable(other, other.get_allocator()) {}
+
+        // 复制 other 的元素，节点从 alloc 分配
+        hashtable(const hashtable& other, const allocator_type& alloc)
+            : hash_(other.hash_), equals_(other.equals_), get_key_(other.get_key_),
+              node_alloc_(alloc), buckets_(bucket_allocator(alloc)),
+              num_elements_(0), max_load_factor_(other.max_load_factor_), policy_(other.policy_)
+        {
+            copy_from(other);
+        }
+
+        // 移动后 other 没有桶，下一次插入时才重新分配，仍可继续使用
+        hashtable(hashtable&& other) noexcept
+            : hash_(other.hash_), equals_(other.equals_), get_key_(other.get_key_),
+              node_alloc_(other.node_alloc_), buckets_(mystl::move(other.buckets_)),
+              num_elements_(other.num_elements_), max_load_factor_(other.max_load_factor_),
+              policy_(other.policy_)
+        {
+            other.num_elements_ = 0;
+        }
+
         ~hashtable() { clear(); }
 
+        // 拷贝赋值保留自己的分配器；先复制到临时表再交换，复制失败时原表不变
+        hashtable& operator=(const hashtable& other)
+        {
+            if (this != &other)
+            {
+                hashtable tmp(other, get_allocator());
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        hashtable& operator=(hashtable&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(hashtable& other) noexcept
+        {
+            mystl::swap(hash_, other.hash_);
+            mystl::swap(equals_, other.equals_);
+            mystl::swap(get_key_, other.get_key_);
+            mystl::swap(node_alloc_, other.node_alloc_);
+            buckets_.swap(other.buckets_);
+            mystl::swap(num_elements_, other.num_elements_);
+            mystl::swap(max_load_factor_, other.max_load_factor_);
+            mystl::swap(policy_, other.policy_);
+        }
+
+        // 返回分配器的副本
+        allocator_type get_allocator() const noexcept { return allocator_type(node_alloc_); }
+
         // 迭代器相关
         iterator begin() 
         {
@@ -187,6 +278,39 @@ namespace mystl
         bool empty() const { return size() == 0; }
         size_type bucket_count() const { return buckets_.size(); }
 
+        // 负载因子：平均每个桶的元素个数
+        float load_factor() const noexcept
+        {
+            return buckets_.empty() ? 0.0f : static_cast<float>(num_elements_) / buckets_.size();
+        }
+
+        float max_load_factor() const noexcept { return max_load_factor_; }
+
+        // 设置最大负载因子，当前负载超过新的上限时立即扩容
+        void max_load_factor(float ml)
+        {
+            if (!(ml > 0.0f))
+            {
+                throw invalid_argument("hashtable::max_load_factor");
+            }
+            max_load_factor_ = ml;
+            resize(num_elements_);
+        }
+
+        // 重建为至少 n 个桶，同时不低于当前元素个数在最大负载因子下所需的桶数；桶数可以减少
+        void rehash(size_type n)
+        {
+            const size_type need = mystl::max(n, buckets_for(num_elements_));
+            const size_type new_n = next_size(need);
+            if (new_n != buckets_.size())
+            {
+                rehash_to(new_n);
+            }
+        }
+
+        // 预留空间：插入 n 个元素之前不再重哈希
+        void reserve(size_type n) { resize(n); }
+
         // 插入操作
         mystl::pair<iterator, bool> insert_unique(const value_type& obj)
         {
@@ -200,6 +324,81 @@ namespace mystl
             return insert_equal_noresize(obj);
         }
 
+        // 插入 [first, last) 中与已有元素都不相等的元素
+        template <class InputIt>
+        void insert_unique(InputIt first, InputIt last)
+        {
+            insert_range(first, last, true);
+        }
+
+        // 插入 [first, last) 中的所有元素
+        template <class InputIt>
+        void insert_equal(InputIt first, InputIt last)
+        {
+            insert_range(first, last, false);
+        }
+
+        // 删除 pos 指向的元素，返回下一个元素的迭代器
+        iterator erase(const_iterator pos)
+        {
+            node_type* target = pos.cur;
+            iterator next(target, this);
+            ++next;
+            node_type** link = &buckets_[bucket_num_node(target)];
+            while (*link != target)
+            {
+                link = &(*link)->next;
+            }
+            *link = target->next;
+            delete_node(target);
+            --num_elements_;
+            return next;
+        }
+
+        // 删除 [first, last) 中的元素
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(last.cur, this);
+        }
+
+        // 删除所有键为 key 的元素，返回删除的个数。
+        // key 可能引用被删除的元素，先把匹配的节点摘下，比较完成后再统一销毁
+        size_type erase(const key_type& key)
+        {
+            if (buckets_.empty()) return 0;
+            node_type* removed = nullptr;
+            size_type erased = 0;
+            const size_type code = hash_of(key);
+            node_type** link = &buckets_[policy_.index(code)];
+            while (*link)
+            {
+                node_type* cur = *link;
+                if (node_matches(cur, code, key))
+                {
+                    *link = cur->next;
+                    cur->next = removed;
+                    removed = cur;
+                    ++erased;
+                }
+                else
+                {
+                    link = &cur->next;
+                }
+            }
+            while (removed)
+            {
+                node_type* next = removed->next;
+                delete_node(removed);
+                removed = next;
+            }
+            num_elements_ -= erased;
+            return erased;
+        }
+
         // 清空操作
         void clear()
         {
@@ -220,18 +419,20 @@ namespace mystl
         // 查找操作
         iterator find(const key_type& key)
         {
-            size_type n = bucket_num(key);
-            node_type* first = buckets_[n];
-            for (; first && !equals_(get_key_(first->value), key); first = first->next)
+            if (buckets_.empty()) return end();
+            const size_type code = hash_of(key);
+            node_type* first = buckets_[policy_.index(code)];
+            for (; first && !node_matches(first, code, key); first = first->next)
             {}
             return iterator(first, this);
         }
 
         const_iterator find(const key_type& key) const
         {
-            size_type n = bucket_num(key);
-            const node_type* first = buckets_[n];
-            for (; first && !equals_(get_key_(first->value), key); first = first->next)
+            if (buckets_.empty()) return end();
+            const size_type code = hash_of(key);
+            const node_type* first = buckets_[policy_.index(code)];
+            for (; first && !node_matches(first, code, key); first = first->next)
             {}
             return const_iterator(first, this);
         }
@@ -239,11 +440,12 @@ namespace mystl
         // 计数操作
         size_type count(const key_type& key) const
         {
-            size_type n = bucket_num(key);
+            if (buckets_.empty()) return 0;
+            const size_type code = hash_of(key);
             size_type result = 0;
-            for (const node_type* cur = buckets_[n]; cur; cur = cur->next)
+            for (const node_type* cur = buckets_[policy_.index(code)]; cur; cur = cur->next)
             {
-                if (equals_(get_key_(cur->value), key))
+                if (node_matches(cur, code, key))
                     ++result;
             }
             return result;
@@ -252,15 +454,17 @@ namespace mystl
         // 范围查找
         mystl::pair<iterator, iterator> equal_range(const key_type& key)
         {
-            size_type n = bucket_num(key);
+            if (buckets_.empty()) return mystl::pair<iterator, iterator>(end(), end());
+            const size_type code = hash_of(key);
+            const size_type n = policy_.index(code);
             for (node_type* first = buckets_[n]; first; first = first->next)
             {
-                if (equals_(get_key_(first->value), key))
+                if (node_matches(first, code, key))
                 {
                     // 找到第一个匹配的元素
                     for (node_type* cur = first->next; cur; cur = cur->next)
                     {
-                        if (!equals_(get_key_(cur->value), key))
+                        if (!node_matches(cur, code, key))
                             return mystl::pair<iterator, iterator>(iterator(first, this),
                                                                  iterator(cur, this));
                     }
@@ -279,14 +483,16 @@ namespace mystl
 
         mystl::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
         {
-            size_type n = bucket_num(key);
+            if (buckets_.empty()) return mystl::pair<const_iterator, const_iterator>(end(), end());
+            const size_type code = hash_of(key);
+            const size_type n = policy_.index(code);
             for (const node_type* first = buckets_[n]; first; first = first->next)
             {
-                if (equals_(get_key_(first->value), key))
+                if (node_matches(first, code, key))
                 {
                     for (const node_type* cur = first->next; cur; cur = cur->next)
                     {
-                        if (!equals_(get_key_(cur->value), key))
+                        if (!node_matches(cur, code, key))
                             return mystl::pair<const_iterator, const_iterator>(
                                 const_iterator(first, this),
                                 const_iterator(cur, this));
@@ -312,19 +518,39 @@ namespace mystl
             const size_type n_buckets = next_size(n);
             buckets_.reserve(n_buckets);
             buckets_.insert(buckets_.end(), n_buckets, nullptr);
+            policy_.reset(n_buckets);
             num_elements_ = 0;
         }
 
-        size_type next_size(size_type n) const
+        // 按相同的桶布局逐桶复制 other 的节点，桶内顺序保持不变
+        void copy_from(const hashtable& other)
         {
-            for (int i = 0; i < num_primes; ++i)
+            buckets_.reserve(other.buckets_.size());
+            buckets_.insert(buckets_.end(), other.buckets_.size(), nullptr);
+            try
+            {
+                for (size_type i = 0; i < other.buckets_.size(); ++i)
+                {
+                    node_type** tail = &buckets_[i];
+                    for (const node_type* cur = other.buckets_[i]; cur; cur = cur->next)
+                    {
+                        *tail = new_node(cur->value);
+                        if constexpr (CacheHash) (*tail)->hash = cur->hash;
+                        tail = &(*tail)->next;
+                        ++num_elements_;
+                    }
+                }
+            }
+            catch (...)
             {
-                if (prime_list[i] >= n)
-                    return prime_list[i];
+                clear();
+                throw;
             }
-            return prime_list[num_primes - 1];
         }
 
+        // 桶数由桶策略决定
+        static size_type next_size(size_type n) { return BucketPolicy::next_size(n); }
+
         node_type* new_node(const value_type& obj)
         {
             node_type* n = node_alloc_.allocate(1);
@@ -347,70 +573,198 @@ namespace mystl
             node_alloc_.deallocate(n, 1);
         }
 
-        size_type bucket_num(const value_type& obj) const
+        // 键的哈希值：桶策略只用低位（needs_mixed_hash）而哈希函数的输出未混合时，先经过 hash_mix；
+        // 节点中保存的、node_matches 比较的都是这个值
+        size_type hash_of(const key_type& key) const
+        {
+            if constexpr (bucket_policy_needs_mixed_hash<BucketPolicy>::value && !is_avalanching<hasher>::value)
+            {
+                return mystl::hash_mix(hash_(key));
+            }
+            else
+            {
+                return hash_(key);
+            }
+        }
+
+        // 节点的哈希值：保存了就直接读取，否则重新计算
+        size_type node_hash(const node_type* n) const
+        {
+            if constexpr (CacheHash) return n->hash;
+            else return hash_of(get_key_(n->value));
+        }
+
+        size_type bucket_num_node(const node_type* n) const
+        {
+            return policy_.index(node_hash(n));
+        }
+
+        // 节点的键是否等于哈希值为 code 的 key：保存了哈希值时先比较哈希值，不相等就不必调用 equals_
+        bool node_matches(const node_type* n, size_type code, const key_type& key) const
         {
-            return bucket_num_key(get_key_(obj));
+            if constexpr (CacheHash)
+            {
+                if (n->hash != code) return false;
+            }
+            return equals_(get_key_(n->value), key);
         }
 
-        size_type bucket_num_key(const key_type& key) const
+        // 元素个数为 n 时在最大负载因子下需要的桶数
+        size_type buckets_for(size_type n) const
         {
-            return hash_(key) % buckets_.size();
+            return static_cast<size_type>(std::ceil(static_cast<double>(n) / max_load_factor_));
         }
 
+        // 元素个数将达到 num_elements_hint 时，若超过最大负载因子则扩容
         void resize(size_type num_elements_hint)
         {
-            const size_type old_n = buckets_.size();
-            if (num_elements_hint > old_n) 
+            if (static_cast<double>(num_elements_hint) <= static_cast<double>(buckets_.size()) * max_load_factor_)
+            {
+                return;
+            }
+            const size_type n = next_size(buckets_for(num_elements_hint));
+            if (n > buckets_.size())
+            {
+                rehash_to(n);
+            }
+        }
+
+        // 把所有节点重新链接到 n 个桶中，不分配也不复制节点；保存了哈希值时不调用哈希函数。
+        // 哈希函数可能抛出异常时先算出所有节点的哈希值再重新链接，失败时原表不变
+        void rehash_to(size_type n)
+        {
+            bucket_type tmp(n, nullptr, buckets_.get_allocator());
+            BucketPolicy policy;
+            policy.reset(n);
+            if constexpr (CacheHash || noexcept(std::declval<const hasher&>()(std::declval<const key_type&>())))
             {
-                const size_type n = next_size(num_elements_hint);
-                if (n > old_n) 
+                relink_to(tmp, policy, [this](const node_type* node) { return node_hash(node); });
+            }
+            else if (num_elements_ != 0)
+            {
+                hash_allocator hash_alloc(node_alloc_);
+                size_type* codes = hash_alloc.allocate(num_elements_);
+                try
                 {
-                    mystl::vector<node_type*> tmp(n, nullptr);
-                    try 
+                    size_type i = 0;
+                    for (size_type bucket = 0; bucket < buckets_.size(); ++bucket)
                     {
-                        for (size_type bucket = 0; bucket < old_n; ++bucket) 
+                        for (const node_type* cur = buckets_[bucket]; cur; cur = cur->next)
                         {
-                            node_type* first = buckets_[bucket];
-                            while (first) 
-                            {
-                                size_type new_bucket = hash_(get_key_(first->value)) % n;
-                                buckets_[bucket] = first->next;
-                                first->next = tmp[new_bucket];
-                                tmp[new_bucket] = first;
-                                first = buckets_[bucket];
-                            }
+                            codes[i++] = node_hash(cur);
                         }
-                        buckets_.swap(tmp);
                     }
-                    catch (...) 
+                }
+                catch (...)
+                {
+                    hash_alloc.deallocate(codes, num_elements_);
+                    throw;
+                }
+                // 与上面的遍历顺序相同
+                size_type i = 0;
+                relink_to(tmp, policy, [codes, &i](const node_type*) { return codes[i++]; });
+                hash_alloc.deallocate(codes, num_elements_);
+            }
+            buckets_.swap(tmp);
+            policy_ = policy;
+        }
+
+        // 按桶的顺序逐个摘下节点，挂到 tmp 中 policy 给出的新桶；code_of 返回节点的哈希值，不能抛出异常
+        template <class CodeOf>
+        void relink_to(bucket_type& tmp, const BucketPolicy& policy, CodeOf code_of) noexcept
+        {
+            for (size_type bucket = 0; bucket < buckets_.size(); ++bucket)
+            {
+                node_type* first = buckets_[bucket];
+                while (first)
+                {
+                    const size_type new_bucket = policy.index(code_of(first));
+                    buckets_[bucket] = first->next;
+                    first->next = tmp[new_bucket];
+                    tmp[new_bucket] = first;
+                    first = buckets_[bucket];
+                }
+            }
+        }
+
+        // 区间插入：前向迭代器先按元素个数一次扩容，节点每 NODE_BATCH_SIZE 个一批从分配器取得；
+        // 重复而未插入的元素不占用节点，剩余的节点最后归还
+        template <class InputIt>
+        void insert_range(InputIt first, InputIt last, bool unique)
+        {
+            if constexpr (!is_forward_iterator<InputIt>::value)
+            {
+                for (; first != last; ++first)
+                {
+                    if (unique) insert_unique(*first);
+                    else insert_equal(*first);
+                }
+            }
+            else
+            {
+                size_type remaining = static_cast<size_type>(mystl::distance(first, last));
+                resize(num_elements_ + remaining);
+
+                node_type* batch[NODE_BATCH_SIZE];
+                size_type avail = 0, next = 0;
+                try
+                {
+                    for (; first != last; ++first, --remaining)
                     {
-                        for (size_type bucket = 0; bucket < tmp.size(); ++bucket) 
+                        const size_type code = hash_of(get_key_(*first));
+                        const size_type n = policy_.index(code);
+                        if (unique && find_in_bucket(n, code, get_key_(*first))) continue;
+
+                        if (next == avail)
                         {
-                            while (tmp[bucket]) 
-                            {
-                                node_type* next = tmp[bucket]->next;
-                                delete_node(tmp[bucket]);
-                                tmp[bucket] = next;
-                            }
+                            size_type count = mystl::min(remaining, size_type(NODE_BATCH_SIZE));
+                            allocate_nodes(node_alloc_, batch, count);
+                            avail = count;
+                            next = 0;
                         }
-                        throw;
+                        node_type* tmp = batch[next];
+                        mystl::construct(&tmp->value, *first);
+                        if constexpr (CacheHash) tmp->hash = code;
+                        ++next;
+                        tmp->next = buckets_[n];
+                        buckets_[n] = tmp;
+                        ++num_elements_;
                     }
                 }
+                catch (...)
+                {
+                    deallocate_nodes(node_alloc_, batch + next, avail - next);
+                    throw;
+                }
+                deallocate_nodes(node_alloc_, batch + next, avail - next);
             }
         }
 
+        // 在第 n 个桶中查找键为 key（哈希值为 code）的节点
+        node_type* find_in_bucket(size_type n, size_type code, const key_type& key) const
+        {
+            for (node_type* cur = buckets_[n]; cur; cur = cur->next)
+            {
+                if (node_matches(cur, code, key))
+                    return cur;
+            }
+            return nullptr;
+        }
+
         mystl::pair<iterator, bool> insert_unique_noresize(const value_type& obj)
         {
-            const size_type n = bucket_num(obj);
+            const size_type code = hash_of(get_key_(obj));
+            const size_type n = policy_.index(code);
             node_type* first = buckets_[n];
 
             for (node_type* cur = first; cur; cur = cur->next)
             {
-                if (equals_(get_key_(cur->value), get_key_(obj)))
+                if (node_matches(cur, code, get_key_(obj)))
                     return mystl::pair<iterator, bool>(iterator(cur, this), false);
             }
 
             node_type* tmp = new_node(obj);
+            if constexpr (CacheHash) tmp->hash = code;
             tmp->next = first;
             buckets_[n] = tmp;
             ++num_elements_;
@@ -419,10 +773,12 @@ namespace mystl
 
         iterator insert_equal_noresize(const value_type& obj)
         {
-            const size_type n = bucket_num(obj);
+            const size_type code = hash_of(get_key_(obj));
+            const size_type n = policy_.index(code);
             node_type* first = buckets_[n];
 
             node_type* tmp = new_node(obj);
+            if constexpr (CacheHash) tmp->hash = code;
             tmp->next = first;
             buckets_[n] = tmp;
             ++num_elements_;
@@ -435,37 +791,24 @@ namespace mystl
         ExtractKey get_key_;
         
         node_allocator node_alloc_;
-        mystl::vector<node_type*> buckets_;
+        bucket_type buckets_;
         size_type num_elements_;
-
-        static const int num_primes = 28;
-        static const unsigned long prime_list[num_primes];
-    };
-
-    // 在类外定义质数表
-    template <class V, class K, class HF, class ExK, class EqK, class A>
-    const unsigned long hashtable<V, K, HF, ExK, EqK, A>::prime_list[num_primes] = 
-    {
-        53,         97,           193,         389,       769,
-        1543,       3079,         6151,        12289,     24593,
-        49157,      98317,        196613,      393241,    786433,
-        1572869,    3145739,      6291469,     12582917,  25165843,
-        50331653,   100663319,    201326611,   402653189, 805306457,
-        1610612741, 3221225473ul, 4294967291ul
+        float max_load_factor_;    // 最大负载因子，默认为 1
+        BucketPolicy policy_;      // 桶策略，保存与当前桶数对应的预计算值
     };
 
     // 在迭代器类中实现自增操作：
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
-    typename hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::self&
-    hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::operator++()
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
+    typename hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::self&
+    hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::operator++()
     {
         const node* old = cur;
         cur = cur->next;  // 先走链表
         if (!cur) 
         {
             // 如果链表走完了，就找下一个非空的桶
-            size_type bucket = ht->bucket_num(old->value);
+            size_type bucket = ht->bucket_num_node(old);
             while (!cur && ++bucket < ht->buckets_.size())
                 cur = ht->buckets_[bucket];
         }
@@ -473,9 +816,9 @@ namespace mystl
     }
 
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
-    typename hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::self
-    hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::operator++(int)
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
+    typename hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::self
+    hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::operator++(int)
     {
         self tmp = *this;
         ++*this;
@@ -484,16 +827,16 @@ namespace mystl
 
     // 在文件末尾添加 const_iterator 的自增操作实现
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
-    typename hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::self&
-    hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::operator++()
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
+    typename hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::self&
+    hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::operator++()
     {
         using size_type = typename base::size_type;  // 使用基类的 size_type
         const node* old = cur;
         cur = cur->next;
         if (!cur) 
         {
-            size_type bucket = ht->bucket_num(old->value);
+            size_type bucket = ht->bucket_num_node(old);
             while (!cur && ++bucket < ht->buckets_.size())
                 cur = ht->buckets_[bucket];
         }
@@ -501,9 +844,9 @@ namespace mystl
     }
 
     template <class Value, class Key, class HashFcn,
-              class ExtractKey, class EqualKey, class Alloc>
-    typename hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::self
-    hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::operator++(int)
+              class ExtractKey, class EqualKey, class Alloc, class BucketPolicy, bool CacheHash>
+    typename hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::self
+    hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc, BucketPolicy, CacheHash>::operator++(int)
     {
         self tmp = *this;
         ++*this;
@@ -147,6 +147,31 @@ namespace mystl
     template<class Iterator>
     inline constexpr bool is_random_access_iterator_v = is_random_access_iterator<Iterator>::value;
 
+    // 元素在内存中连续存放的迭代器：原生指针，以及在容器头文件中显式声明的迭代器（如 vector_iterator）
+    // 只有连续迭代器才能经 iterator_base 取得原生指针后整段 memmove / memset；
+    // deque、segmented_vector 等分块存储的随机访问迭代器不是连续迭代器
+    template<class Iterator>
+    struct is_contiguous_iterator : is_pointer<Iterator> {};
+
+    template<class Iterator>
+    inline constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<Iterator>::value;
+
+    // 分块迭代器特征：deque 这类分块存储的容器，迭代器可以拆成“所在块”和“块内原生指针”两部分，
+    // 每个块内部连续。copy / move / fill 等算法按块拆分区间，对每块的原生指针区间调用连续版本（memmove / memset）
+    // 特化需要提供：
+    //   segment_iterator        指向块的迭代器（如 deque 的 map 指针），支持 ++ / -- / ==
+    //   local_iterator          块内的原生指针
+    //   segment(it) / local(it) 拆分迭代器
+    //   begin(seg) / end(seg)   块的 [first, last)
+    template<class Iterator>
+    struct segmented_iterator_traits
+    {
+        static constexpr bool is_segmented = false;
+    };
+
+    template<class Iterator>
+    inline constexpr bool is_segmented_iterator_v = segmented_iterator_traits<Iterator>::is_segmented;
+
 
 
     /*****************************************************************************************/ 
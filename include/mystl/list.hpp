@@ -193,16 +193,20 @@ namespace mystl
             empty_initialize();
         }
 
-        explicit list(size_type n)
+        // 使用指定的分配器构造空链表
+        explicit list(const allocator_type& alloc)
+            : alloc_(alloc)
+        {
+            empty_initialize();
+        }
+
+        explicit list(size_type n, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
         {
             empty_initialize();
             try 
             {
-                for (size_type i = 0; i < n; ++i)
-                {
-                    node_type* new_node = create_node();
-                    link_node_at_back(new_node);
-                }
+                append_batch(n, [](T* p) { mystl::construct(p); });
             }
             catch (...)
             {
@@ -212,16 +216,13 @@ namespace mystl
             }
         }
 
-        list(size_type n, const T& value)
+        list(size_type n, const T& value, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
         {
             empty_initialize();
             try 
             {
-                for (size_type i = 0; i < n; ++i)
-                {
-                    node_type* new_node = create_node(value);
-                    link_node_at_back(new_node);
-                }
+                append_batch(n, [&value](T* p) { mystl::construct(p, value); });
             }
             catch (...)
             {
@@ -232,16 +233,13 @@ namespace mystl
         }
 
         // 初始化列表构造函数
-        list(std::initializer_list<T> ilist)
+        list(std::initializer_list<T> ilist, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
         {
             empty_initialize();
             try 
             {
-                for (const auto& value : ilist)
-                {
-                    node_type* new_node = create_node(value);
-                    link_node_at_back(new_node);
-                }
+                append_range(ilist.begin(), ilist.end());
             }
             catch (...)
             {
@@ -253,17 +251,14 @@ namespace mystl
 
         // 构造函数区域
         template <class InputIt>
-        list(InputIt first, InputIt last,
+        list(InputIt first, InputIt last, const allocator_type& alloc = allocator_type(),
              typename enable_if<!is_integral<InputIt>::value>::type* = nullptr)  
+            : alloc_(alloc)
         {
             empty_initialize();
             try 
             {
-                for (; first != last; ++first)
-                {
-                    node_type* new_node = create_node(*first);
-                    link_node_at_back(new_node);
-                }
+                append_range(first, last);
             }
             catch (...)
             {
@@ -274,15 +269,12 @@ namespace mystl
         }
 
         list(const list& other) 
+            : alloc_(other.alloc_)
         {
             empty_initialize();
             try 
             {
-                for (const auto& value : other)
-                {
-                    node_type* new_node = create_node(value);
-                    link_node_at_back(new_node);
-                }
+                append_range(other.begin(), other.end());
             }
             catch (...)
             {
@@ -408,7 +400,7 @@ namespace mystl
             if (count > size_)
             {
                 size_type n = count - size_;
-                list tmp;  // 创建临时链表存储新节点
+                list tmp(get_allocator());  // 创建临时链表存储新节点
                 
                 try 
                 {
@@ -453,11 +445,7 @@ namespace mystl
                 clear();  // 清空当前内容
                 try 
                 {
-                    for (const auto& value : other)
-                    {
-                        node_type* new_node = create_node(value);
-                        link_node_at_back(new_node);
-                    }
+                    append_range(other.begin(), other.end());
                 }
                 catch (...)
                 {
@@ -554,13 +542,10 @@ namespace mystl
                 return iterator(as_node(pos.node));
 
             // 先创建一个临时链表存储所有新节点
-            list tmp;
+            list tmp(get_allocator());
             try 
             {
-                for (size_type i = 0; i < n; ++i)
-                {
-                    tmp.push_back(value);  // 可能抛出异常
-                }
+                tmp.append_batch(n, [&value](T* p) { mystl::construct(p, value); });  // 可能抛出异常
                 // 如果全部创建成功，再一次性插入
                 iterator result = iterator(as_node(pos.node));
                 splice(pos, tmp);
@@ -579,13 +564,10 @@ namespace mystl
                         typename enable_if<!is_integral<InputIt>::value>::type* = nullptr)
         {
             // 先创建一个临时链表存储所有新节点
-            list tmp;
+            list tmp(get_allocator());
             try 
             {
-                for (; first != last; ++first)
-                {
-                    tmp.push_back(*first);  // 可能抛出异常
-                }
+                tmp.append_range(first, last);  // 可能抛出异常
                 // 如果全部创建成功，再一次性插入
                 iterator result = iterator(as_node(pos.node));
                 splice(pos, tmp);
@@ -738,6 +720,9 @@ namespace mystl
             mystl::swap(alloc_, other.alloc_);
         }
 
+        // 返回分配器的副本
+        allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
         
 
         /*****************************************************************************************/
@@ -877,8 +862,8 @@ namespace mystl
                 return;
 
             // 将链表分成两半
-            list left;
-            list right;
+            list left(get_allocator());
+            list right(get_allocator());
             iterator mid = begin();
             for (size_type i = 0; i < size_ / 2; ++i)
                 ++mid;
@@ -1010,6 +995,56 @@ namespace mystl
             alloc_.deallocate(p, 1);
         }
 
+        // 在尾部追加 n 个元素，construct(p) 在 p 处构造下一个元素
+        // 节点每 NODE_BATCH_SIZE 个一批从分配器取得，同一批的节点在内存中相邻
+        // 抛出异常时已追加的元素保留在链表中，由调用者清理
+        template <class Construct>
+        void append_batch(size_type n, Construct construct)
+        {
+            node_type* batch[NODE_BATCH_SIZE];
+            while (n > 0)
+            {
+                size_type count = mystl::min(n, size_type(NODE_BATCH_SIZE));
+                allocate_nodes(alloc_, batch, count);
+                size_type i = 0;
+                try 
+                {
+                    for (; i < count; ++i)
+                    {
+                        construct(&batch[i]->data);
+                        link_node_at_back(batch[i]);
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_nodes(alloc_, batch + i, count - i);
+                    throw;
+                }
+                n -= count;
+            }
+        }
+
+        // 在尾部追加 [first, last)；前向迭代器可以预先得知元素个数，按批分配节点
+        template <class InputIt>
+        void append_range(InputIt first, InputIt last)
+        {
+            if constexpr (is_forward_iterator<InputIt>::value)
+            {
+                append_batch(static_cast<size_type>(mystl::distance(first, last)), [&first](T* p)
+                {
+                    mystl::construct(p, *first);
+                    ++first;
+                });
+            }
+            else
+            {
+                for (; first != last; ++first)
+                {
+                    link_node_at_back(create_node(*first));
+                }
+            }
+        }
+
         // 初始化空链表
         void empty_initialize()
         {
@@ -1067,52 +1102,56 @@ namespace mystl
         }
     };
 
+    // 哨兵节点同样分配在堆上，链表对象本身不被任何节点指向，分配器可平凡重定位时整个 list 也可以
+    template <class T, class Alloc>
+    struct is_trivially_relocatable<list<T, Alloc>> : is_trivially_relocatable<Alloc> {};
+
 
 
     //------------------------------------------------------------------------------
     // 非成员函数
     //------------------------------------------------------------------------------    
-    template <class T>
-    bool operator==(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>
+    bool operator==(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         if (lhs.size() != rhs.size())
             return false;
         return mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
-    template <class T>  
-    bool operator!=(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>  
+    bool operator!=(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         return !(lhs == rhs);
     }
 
-    template <class T>
-    bool operator<(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>
+    bool operator<(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template <class T>
-    bool operator<=(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>
+    bool operator<=(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         return !(rhs < lhs);
     }   
 
-    template <class T>
-    bool operator>(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>
+    bool operator>(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         return rhs < lhs;
     }   
 
-    template <class T>
-    bool operator>=(const list<T>& lhs, const list<T>& rhs)
+    template <class T, class Alloc>
+    bool operator>=(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs)
     {
         return !(lhs < rhs);
     }   
 
     // 交换两个list 
-    template <class T>
-    void swap(list<T>& lhs, list<T>& rhs) noexcept
+    template <class T, class Alloc>
+    void swap(list<T, Alloc>& lhs, list<T, Alloc>& rhs) noexcept
     {
         lhs.swap(rhs);
     }   
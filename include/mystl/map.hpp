@@ -51,6 +51,10 @@ namespace mystl
         // 构造函数
         map() : tree_(value_compare(Compare())) {}
         explicit map(const Compare& comp) : tree_(value_compare(comp)) {}
+        explicit map(const allocator_type& alloc) : tree_(value_compare(Compare()), alloc) {}
+        map(const Compare& comp, const allocator_type& alloc) : tree_(value_compare(comp), alloc) {}
+
+        allocator_type get_allocator() const noexcept { return tree_.get_allocator(); }
         
         template <class InputIterator>
         map(InputIterator first, InputIterator last)
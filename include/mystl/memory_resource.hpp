@@ -0,0 +1,326 @@
+#pragma once
+
+#include <atomic>
+#include <new>      // for operator new(size_t, align_val_t)
+#include "expectdef.hpp"
+#include "allocator.hpp"
+#include "arena.hpp"
+
+namespace mystl
+{
+    //------------------------------------------------------------------------------
+    // 内存资源：运行时可替换的分配策略
+    // 容器类型只依赖 polymorphic_allocator，具体用哪种资源在构造时决定
+    //------------------------------------------------------------------------------
+    class memory_resource
+    {
+    public:
+        virtual ~memory_resource() = default;
+
+        // 分配 bytes 字节，按 align 对齐
+        void* allocate(size_t bytes, size_t align = alignof(max_align_t))
+        {
+            return do_allocate(bytes, align);
+        }
+
+        // 释放内存，bytes 和 align 须与分配时一致
+        void deallocate(void* p, size_t bytes, size_t align = alignof(max_align_t))
+        {
+            do_deallocate(p, bytes, align);
+        }
+
+        // 一个资源分配的内存能否由另一个资源释放
+        bool is_equal(const memory_resource& other) const noexcept
+        {
+            return do_is_equal(other);
+        }
+
+    private:
+        virtual void* do_allocate(size_t bytes, size_t align) = 0;
+        virtual void do_deallocate(void* p, size_t bytes, size_t align) = 0;
+        virtual bool do_is_equal(const memory_resource& other) const noexcept = 0;
+    };
+
+    inline bool operator==(const memory_resource& a, const memory_resource& b) noexcept
+    {
+        return &a == &b || a.is_equal(b);
+    }
+
+    inline bool operator!=(const memory_resource& a, const memory_resource& b) noexcept
+    {
+        return !(a == b);
+    }
+
+
+
+    //------------------------------------------------------------------------------
+    // 直接使用全局 operator new/delete
+    //------------------------------------------------------------------------------
+    class new_delete_resource_type : public memory_resource
+    {
+    private:
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return ::operator new(bytes, std::align_val_t(align));
+            return ::operator new(bytes);
+        }
+
+        void do_deallocate(void* p, size_t, size_t align) override
+        {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(p, std::align_val_t(align));
+            else
+                ::operator delete(p);
+        }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    // 有意不析构，与 size_class_pool() 相同
+    inline memory_resource* new_delete_resource() noexcept
+    {
+        static memory_resource* r = new new_delete_resource_type;
+        return r;
+    }
+
+
+
+    //------------------------------------------------------------------------------
+    // 尺寸分级内存池资源
+    // 对齐要求超过 MemoryPool::MAX_ALIGN（页大小）的请求交给 upstream
+    //------------------------------------------------------------------------------
+    template<class Pool>
+    class basic_pool_resource : public memory_resource
+    {
+    private:
+        Pool* pool_;
+        memory_resource* upstream_;
+
+        static size_t pool_bytes(size_t bytes) noexcept
+        {
+            return MemoryPool<char>::align_up(bytes ? bytes : 1);
+        }
+
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            if (align > MemoryPool<char>::MAX_ALIGN)
+                return upstream_->allocate(bytes, align);
+            return pool_->allocate_bytes(pool_bytes(bytes), align);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t align) override
+        {
+            if (align > MemoryPool<char>::MAX_ALIGN)
+                upstream_->deallocate(p, bytes, align);
+            else
+                pool_->deallocate_bytes(p, pool_bytes(bytes), align);
+        }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            auto o = dynamic_cast<const basic_pool_resource*>(&other);
+            return o && o->pool_ == pool_;
+        }
+
+    public:
+        basic_pool_resource(Pool& pool, memory_resource* upstream = new_delete_resource()) noexcept
+            : pool_(&pool), upstream_(upstream)
+        {
+        }
+
+        Pool& pool() const noexcept { return *pool_; }
+        memory_resource* upstream_resource() const noexcept { return upstream_; }
+    };
+
+    // 进程级共享内存池上的资源，与 mystl::allocator 使用同一个内存池
+    inline memory_resource* size_class_pool_resource() noexcept
+    {
+        static memory_resource* r = new basic_pool_resource<size_class_pool_type>(size_class_pool());
+        return r;
+    }
+
+    // 独占一个 MemoryPool 的资源（非线程安全），析构时整体归还内存
+    // 适合按租户或按模块隔离的内存
+    class pool_resource : public memory_resource
+    {
+    private:
+        MemoryPool<char> pool_;
+        basic_pool_resource<MemoryPool<char>> impl_;
+
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            return impl_.allocate(bytes, align);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t align) override
+        {
+            impl_.deallocate(p, bytes, align);
+        }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        explicit pool_resource(memory_resource* upstream = new_delete_resource()) noexcept
+            : impl_(pool_, upstream)
+        {
+        }
+
+        pool_resource(const pool_resource&) = delete;
+        pool_resource& operator=(const pool_resource&) = delete;
+
+        // 把完全空闲的内存块归还系统
+        size_t release_unused() { return pool_.release_unused(); }
+
+        MemoryPool<char>& pool() noexcept { return pool_; }
+    };
+
+
+
+    //------------------------------------------------------------------------------
+    // 单调内存区域上的资源：释放为空操作，release() 一次性回收
+    //------------------------------------------------------------------------------
+    class monotonic_buffer_resource : public memory_resource
+    {
+    private:
+        monotonic_arena arena_;
+
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            return arena_.allocate(bytes, align);
+        }
+
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        bool do_is_equal(const memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        explicit monotonic_buffer_resource(size_t initial_size = 4096) noexcept
+            : arena_(initial_size)
+        {
+        }
+
+        monotonic_buffer_resource(void* buffer, size_t size) noexcept
+            : arena_(buffer, size)
+        {
+        }
+
+        // 回收全部内存，保留最大的缓冲区供下一轮使用
+        void reset() noexcept { arena_.reset(); }
+
+        // 回收全部内存并交还所有自行申请的缓冲区
+        void release() noexcept { arena_.release(); }
+
+        monotonic_arena& arena() noexcept { return arena_; }
+    };
+
+
+
+    //------------------------------------------------------------------------------
+    // 默认资源：默认构造的 polymorphic_allocator 使用它
+    // 初始为 size_class_pool_resource()，传入 nullptr 时恢复初始值
+    //------------------------------------------------------------------------------
+    inline std::atomic<memory_resource*>& default_resource_slot() noexcept
+    {
+        static std::atomic<memory_resource*> slot{size_class_pool_resource()};
+        return slot;
+    }
+
+    inline memory_resource* get_default_resource() noexcept
+    {
+        return default_resource_slot().load(std::memory_order_acquire);
+    }
+
+    // 返回原来的默认资源
+    inline memory_resource* set_default_resource(memory_resource* r) noexcept
+    {
+        if (!r) r = size_class_pool_resource();
+        return default_resource_slot().exchange(r, std::memory_order_acq_rel);
+    }
+
+
+
+    //------------------------------------------------------------------------------
+    // 多态分配器：接口与 mystl::allocator 相同，实际分配转发给 memory_resource
+    // 不同资源的容器是同一个类型，可以在运行时选择分配策略
+    //------------------------------------------------------------------------------
+    template<class T>
+    class polymorphic_allocator
+    {
+    private:
+        memory_resource* resource_;
+
+    public:
+        // STL要求的类型定义
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+
+        // 允许分配器在不同类型间转换
+        template<typename U>
+        struct rebind { using other = polymorphic_allocator<U>; };
+
+        // 构造函数
+        polymorphic_allocator() noexcept : resource_(get_default_resource()) {}
+
+        polymorphic_allocator(memory_resource* r) noexcept : resource_(r) {}
+
+        // 允许从其他类型的分配器构造，共享同一资源
+        template<typename U>
+        polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept
+            : resource_(other.resource())
+        {
+        }
+
+        // 比较操作：资源相等时可以互相释放对方的内存
+        template <class U>
+        bool operator==(const polymorphic_allocator<U>& other) const noexcept
+        {
+            return *resource_ == *other.resource();
+        }
+
+        template <class U>
+        bool operator!=(const polymorphic_allocator<U>& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        // 内存分配
+        pointer allocate(size_type n)
+        {
+            if (n > max_size())
+                throw length_error("polymorphic_allocator<T>::allocate() - Integer overflow.");
+            if (n == 0) return nullptr;
+            return static_cast<pointer>(resource_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        // 内存释放
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (!p) return;
+            resource_->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        // 返回最大可分配大小
+        size_type max_size() const noexcept
+        {
+            return size_type(-1) / sizeof(T);
+        }
+
+        memory_resource* resource() const noexcept { return resource_; }
+    };
+
+} // namespace mystl
@@ -50,6 +50,10 @@ namespace mystl
         // 构造函数
         multimap() : tree_(value_compare(Compare())) {}
         explicit multimap(const Compare& comp) : tree_(value_compare(comp)) {}
+        explicit multimap(const allocator_type& alloc) : tree_(value_compare(Compare()), alloc) {}
+        multimap(const Compare& comp, const allocator_type& alloc) : tree_(value_compare(comp), alloc) {}
+
+        allocator_type get_allocator() const noexcept { return tree_.get_allocator(); }
         
         template <class InputIterator>
         multimap(InputIterator first, InputIterator last)
@@ -34,6 +34,10 @@ namespace mystl
     public:
         // 构造函数
         multiset() = default;
+        explicit multiset(const allocator_type& alloc) : tree_(alloc) {}
+        multiset(const Compare& comp, const allocator_type& alloc) : tree_(comp, alloc) {}
+
+        allocator_type get_allocator() const noexcept { return tree_.get_allocator(); }
         
         template <class InputIterator>
         multiset(InputIterator first, InputIterator last)
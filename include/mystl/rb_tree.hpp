@@ -193,7 +193,7 @@ namespace mystl
 
     protected:
         // 节点相关
-        using rb_tree_node = rb_tree_node<value_type>;
+        using rb_tree_node = mystl::rb_tree_node<value_type>;
         using node_allocator = typename Alloc::template rebind<rb_tree_node>::other;
 
         node_allocator node_alloc_;  // 节点分配器
@@ -268,6 +268,43 @@ namespace mystl
             init(); 
         }
 
+        // 使用指定的分配器构造
+        explicit rb_tree(const allocator_type& alloc)
+            : node_alloc_(alloc)
+        {
+            init();
+        }
+
+        rb_tree(const Compare& comp, const allocator_type& alloc)
+            : node_alloc_(alloc), key_compare(comp)
+        {
+            init();
+        }
+
+        // 拷贝构造：复制整棵树，沿用 rhs 的分配器
+        rb_tree(const rb_tree& rhs)
+            : node_alloc_(rhs.node_alloc_), key_compare(rhs.key_compare)
+        {
+            init();
+            try
+            {
+                copy_from(rhs);
+            }
+            catch (...)
+            {
+                deallocate_node(header_);
+                throw;
+            }
+        }
+
+        // 移动构造：先建一个空树再与 rhs 交换，rhs 保留可用的 header
+        rb_tree(rb_tree&& rhs)
+            : node_alloc_(rhs.node_alloc_), key_compare(rhs.key_compare)
+        {
+            init();
+            swap(rhs);
+        }
+
         // 析构函数
         ~rb_tree() 
         { 
@@ -334,25 +371,32 @@ namespace mystl
         // 插入操作
         mystl::pair<iterator, bool> insert_unique(const value_type& value)
         {
-            rb_tree_node* y = get_insert_pos(value);
-            if (y == header_ || key_compare(value, y->value))  // 插入在左边
-            {
-                return mystl::pair<iterator, bool>(
-                    insert_aux(y, value, true), true);
-            }
-            else if (key_compare(y->value, value))  // 插入在右边
-            {
-                return mystl::pair<iterator, bool>(
-                    insert_aux(y, value, false), true);
-            }
-            // 值相等，不插入
-            return mystl::pair<iterator, bool>(iterator(y), false);
+            rb_tree_node* y;
+            bool add_left;
+            iterator j;
+            if (!get_unique_pos(value, y, add_left, j))
+                return mystl::pair<iterator, bool>(j, false);  // 值相等，不插入
+            return mystl::pair<iterator, bool>(insert_aux(y, value, add_left), true);
         }
 
         iterator insert_equal(const value_type& value)
         {
             rb_tree_node* y = get_insert_pos(value);
-            return insert_aux(y, value, false);
+            return insert_aux(y, value, y == header_ || key_compare(value, y->value));
+        }
+
+        // 插入 [first, last) 中与已有元素都不相等的元素
+        template <class InputIt>
+        void insert_unique(InputIt first, InputIt last)
+        {
+            insert_range(first, last, true);
+        }
+
+        // 插入 [first, last) 中的所有元素
+        template <class InputIt>
+        void insert_equal(InputIt first, InputIt last)
+        {
+            insert_range(first, last, false);
         }
 
         // 删除操作
@@ -518,36 +562,18 @@ namespace mystl
             {
                 clear();
                 key_compare = rhs.key_compare;
-                if (!rhs.empty())
-                {
-                    try 
-                    {
-                        parent(header_) = copy_tree(parent(rhs.header_), header_);
-                        left(header_) = minimum(parent(header_));
-                        right(header_) = maximum(parent(header_));
-                        node_count_ = rhs.node_count_;
-                    }
-                    catch (...) 
-                    {
-                        clear();
-                        throw;
-                    }
-                }
+                copy_from(rhs);
             }
             return *this;
         }
 
+        // 移动赋值：交换后 rhs 持有本树原有的（已清空的）header
         rb_tree& operator=(rb_tree&& rhs) noexcept
         {
             if (this != &rhs)
             {
                 clear();
-                header_ = rhs.header_;
-                node_count_ = rhs.node_count_;
-                key_compare = rhs.key_compare;
-                
-                rhs.header_ = nullptr;
-                rhs.node_count_ = 0;
+                swap(rhs);
             }
             return *this;
         }
@@ -606,6 +632,7 @@ namespace mystl
         {
             if (this != &rhs)
             {
+                mystl::swap(node_alloc_, rhs.node_alloc_);
                 mystl::swap(header_, rhs.header_);
                 mystl::swap(node_count_, rhs.node_count_);
                 mystl::swap(key_compare, rhs.key_compare);
@@ -619,6 +646,9 @@ namespace mystl
             return mystl::distance(p.first, p.second);
         }
 
+        // 返回分配器的副本
+        allocator_type get_allocator() const noexcept { return allocator_type(node_alloc_); }
+
         // 获取根节点
         rb_tree_node* get_root() const noexcept 
         { 
@@ -668,17 +698,23 @@ namespace mystl
             node_alloc_.deallocate(p, 1);
         }
 
+        // 在已分配的节点上构造元素并初始化链接
+        void init_node(rb_tree_node* p, const value_type& value)
+        {
+            mystl::construct(&p->value, value);
+            p->left = nullptr;
+            p->right = nullptr;
+            p->parent = nullptr;
+            p->color = rb_tree_red;  // 新节点默认为红色
+        }
+
         // 创建一个节点
         rb_tree_node* create_node(const value_type& value)
         {
             rb_tree_node* tmp = allocate_node();
             try 
             {
-                mystl::construct(&tmp->value, value);
-                tmp->left = nullptr;
-                tmp->right = nullptr;
-                tmp->parent = nullptr;
-                tmp->color = rb_tree_red;  // 新节点默认为红色
+                init_node(tmp, value);
             }
             catch (...) 
             {
@@ -811,6 +847,91 @@ namespace mystl
             return y;
         }
 
+        // 查找不重复插入的位置：可以插入时返回 true，y 为父节点，add_left 表示作为左子节点；
+        // 已有相等元素时返回 false，j 指向该元素
+        bool get_unique_pos(const value_type& value, rb_tree_node*& y, bool& add_left, iterator& j)
+        {
+            y = get_insert_pos(value);
+            add_left = y == header_ || key_compare(value, y->value);
+
+            // 与 value 相等的元素只可能是插入位置的前驱
+            j = iterator(y);
+            if (add_left)
+            {
+                if (y == left(header_))  // 比所有元素都小（含空树）
+                    return true;
+                --j;
+            }
+            return key_compare(*j, value);
+        }
+
+        // 区间插入：前向迭代器可以预先得知元素个数，节点每 NODE_BATCH_SIZE 个一批从分配器取得，
+        // 相邻插入的节点在内存中也相邻；重复而未插入的元素不占用节点，剩余的节点最后归还
+        template <class InputIt>
+        void insert_range(InputIt first, InputIt last, bool unique)
+        {
+            if constexpr (!is_forward_iterator<InputIt>::value)
+            {
+                for (; first != last; ++first)
+                {
+                    if (unique) insert_unique(*first);
+                    else insert_equal(*first);
+                }
+            }
+            else
+            {
+                size_type remaining = static_cast<size_type>(mystl::distance(first, last));
+                rb_tree_node* batch[NODE_BATCH_SIZE];
+                size_type avail = 0, next = 0;
+                try
+                {
+                    for (; first != last; ++first, --remaining)
+                    {
+                        rb_tree_node* y;
+                        bool add_left;
+                        if (unique)
+                        {
+                            iterator j;
+                            if (!get_unique_pos(*first, y, add_left, j)) continue;
+                        }
+                        else
+                        {
+                            y = get_insert_pos(*first);
+                            add_left = y == header_ || key_compare(*first, y->value);
+                        }
+
+                        if (next == avail)
+                        {
+                            size_type count = mystl::min(remaining, size_type(NODE_BATCH_SIZE));
+                            allocate_nodes(node_alloc_, batch, count);
+                            avail = count;
+                            next = 0;
+                        }
+                        init_node(batch[next], *first);
+                        link_node(y, batch[next++], add_left);
+                    }
+                }
+                catch (...)
+                {
+                    deallocate_nodes(node_alloc_, batch + next, avail - next);
+                    throw;
+                }
+                deallocate_nodes(node_alloc_, batch + next, avail - next);
+            }
+        }
+
+        // 把 rhs 的所有节点复制到当前的空树中
+        void copy_from(const rb_tree& rhs)
+        {
+            if (rhs.empty())
+                return;
+            rb_tree_node* root = copy_tree(parent(rhs.header_), header_);
+            set_parent(header_, root);
+            set_left(header_, minimum(root));
+            set_right(header_, maximum(root));
+            node_count_ = rhs.node_count_;
+        }
+
         // 递归复制红黑树
         rb_tree_node* copy_tree(rb_tree_node* x, rb_tree_node* p)
         {
@@ -847,8 +968,12 @@ namespace mystl
         // 插入节点的辅助函数
         iterator insert_aux(rb_tree_node* y, const value_type& value, bool add_left)
         {
-            rb_tree_node* z = create_node(value);
-            
+            return link_node(y, create_node(value), add_left);
+        }
+
+        // 把新节点 z 链接为 y 的子节点并重新平衡
+        iterator link_node(rb_tree_node* y, rb_tree_node* z, bool add_left)
+        {
             if (y == header_ || add_left)  // 插入第一个节点或作为左子节点
             {
                 set_left(y, z);
@@ -0,0 +1,683 @@
+#pragma once
+
+#include <initializer_list>
+#include <limits>
+
+#include "allocator.hpp"
+#include "iterator.hpp"
+#include "uninitialized.hpp"
+#include "algorithm.hpp"
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // segmented_vector 的块布局
+    // 第 0 块容纳 B 个元素（B 为 2 的幂），之后每块是前一块的两倍：第 k 块容纳 B * 2^k 个元素，
+    // 起始下标为 B * (2^k - 1)。下标 i 所在的块为 floor(log2(i / B + 1))，一次 clz 即可算出
+    /*****************************************************************************************/
+    namespace segmented_detail
+    {
+        // 第一块元素个数的对数：取不超过 512 / size 的最大 2 的幂（至少 1 个元素），与 deque 的缓冲区大小相当
+        constexpr size_t first_block_shift(size_t size) noexcept
+        {
+            size_t n = size < 512 ? 512 / size : 1;
+            size_t shift = 0;
+            while ((size_t(2) << shift) <= n) ++shift;
+            return shift;
+        }
+
+        // floor(log2(x))，x 不能为 0
+        inline size_t floor_log2(size_t x) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(x)));
+#else
+            size_t r = 0;
+            while (x >>= 1) ++r;
+            return r;
+#endif
+        }
+
+        // 元素大小为 size 时的块布局
+        template<size_t Size>
+        struct block_layout
+        {
+            static constexpr size_t shift = first_block_shift(Size);
+            static constexpr size_t max_blocks = std::numeric_limits<size_t>::digits - shift;
+
+            static size_t block_size(size_t k) noexcept { return size_t(1) << (k + shift); }
+            static size_t block_start(size_t k) noexcept { return (size_t(1) << (k + shift)) - (size_t(1) << shift); }
+            static size_t block_of(size_t i) noexcept { return floor_log2((i >> shift) + 1); }
+        };
+    } // namespace segmented_detail
+
+
+
+    /*****************************************************************************************/
+    // segmented_vector 的迭代器
+    // 缓存当前块的 [first, last)，块内移动与原生指针相同；跨块或远距离跳转时按下标重新定位
+    /*****************************************************************************************/
+    template <class T>
+    class segmented_vector_iterator
+    {
+        template <class U>
+        friend class segmented_vector_iterator;
+
+        template <class Value, class Alloc>
+        friend class segmented_vector;
+
+        using layout = segmented_detail::block_layout<sizeof(T)>;
+
+    public:
+        // 迭代器类型定义
+        using iterator_category = mystl::random_access_iterator_tag;
+        using value_type = remove_cv_t<T>;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = ptrdiff_t;
+        using size_type = size_t;
+        using map_pointer = T* const*;
+
+        // 构造函数
+        segmented_vector_iterator() noexcept
+            : cur(nullptr), first(nullptr), last(nullptr), map(nullptr), index(0) {}
+
+        segmented_vector_iterator(map_pointer m, size_type i) noexcept
+            : map(m)
+        {
+            set_index(i);
+        }
+
+        // 转换为const迭代器
+        operator segmented_vector_iterator<const T>() const noexcept
+        {
+            segmented_vector_iterator<const T> it;
+            it.cur = cur;
+            it.first = first;
+            it.last = last;
+            it.map = map;
+            it.index = index;
+            return it;
+        }
+
+        // 在容器中的下标
+        size_type position() const noexcept { return index; }
+
+        // 重载操作符
+        reference operator*() const noexcept { return *cur; }
+        pointer operator->() const noexcept { return cur; }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        segmented_vector_iterator& operator++() noexcept
+        {
+            ++index;
+            if (++cur == last) set_index(index);
+            return *this;
+        }
+
+        segmented_vector_iterator operator++(int) noexcept
+        {
+            segmented_vector_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        segmented_vector_iterator& operator--() noexcept
+        {
+            // 位于块首或尚未分配的块（end）时按下标重新定位
+            if (cur == first)
+            {
+                set_index(index - 1);
+            }
+            else
+            {
+                --cur;
+                --index;
+            }
+            return *this;
+        }
+
+        segmented_vector_iterator operator--(int) noexcept
+        {
+            segmented_vector_iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        segmented_vector_iterator& operator+=(difference_type n) noexcept
+        {
+            difference_type offset = (cur - first) + n;
+            if (cur && offset >= 0 && offset < last - first)
+            {
+                // 目标位置在同一块内
+                cur += n;
+                index += n;
+            }
+            else
+            {
+                set_index(index + n);
+            }
+            return *this;
+        }
+
+        segmented_vector_iterator operator+(difference_type n) const noexcept
+        {
+            segmented_vector_iterator tmp = *this;
+            return tmp += n;
+        }
+
+        segmented_vector_iterator& operator-=(difference_type n) noexcept
+        {
+            return *this += -n;
+        }
+
+        segmented_vector_iterator operator-(difference_type n) const noexcept
+        {
+            segmented_vector_iterator tmp = *this;
+            return tmp -= n;
+        }
+
+        template <class U>
+        difference_type operator-(const segmented_vector_iterator<U>& x) const noexcept
+        {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(x.index);
+        }
+
+        // 比较操作符，同一容器的迭代器按下标比较
+        template <class U>
+        bool operator==(const segmented_vector_iterator<U>& rhs) const noexcept { return index == rhs.index; }
+
+        template <class U>
+        bool operator!=(const segmented_vector_iterator<U>& rhs) const noexcept { return index != rhs.index; }
+
+        template <class U>
+        bool operator<(const segmented_vector_iterator<U>& rhs) const noexcept { return index < rhs.index; }
+
+        template <class U>
+        bool operator>(const segmented_vector_iterator<U>& rhs) const noexcept { return index > rhs.index; }
+
+        template <class U>
+        bool operator<=(const segmented_vector_iterator<U>& rhs) const noexcept { return index <= rhs.index; }
+
+        template <class U>
+        bool operator>=(const segmented_vector_iterator<U>& rhs) const noexcept { return index >= rhs.index; }
+
+        friend segmented_vector_iterator operator+(difference_type n, const segmented_vector_iterator& it) noexcept
+        {
+            return it + n;
+        }
+
+    private:
+        // 迭代器数据成员
+        pointer cur;       // 指向当前元素，所在块尚未分配时为 nullptr
+        pointer first;     // 当前块的头
+        pointer last;      // 当前块的尾
+        map_pointer map;   // 容器的块表
+        size_type index;   // 在容器中的下标
+
+        void set_index(size_type i) noexcept
+        {
+            index = i;
+            size_type k = layout::block_of(i);
+            first = map ? map[k] : nullptr;
+            if (first)
+            {
+                cur = first + (i - layout::block_start(k));
+                last = first + layout::block_size(k);
+            }
+            else
+            {
+                cur = last = nullptr;
+            }
+        }
+    };
+
+
+
+    /*****************************************************************************************/
+    // segmented_vector 的实现
+    // 只在尾部增删的动态数组，存储由几何增长的块组成：
+    // 扩容只分配新块，已有元素既不复制也不移动，元素的地址和引用在 push_back 后保持有效；
+    // 下标访问为 O(1)：一次 clz 算出块号，再加块内偏移
+    /*****************************************************************************************/
+    template <class T, class Allocator = mystl::allocator<T>>
+    class segmented_vector
+    {
+        using layout = segmented_detail::block_layout<sizeof(T)>;
+
+    public:
+        // 类型定义
+        using value_type = typename Allocator::value_type;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = typename allocator_type::reference;
+        using const_reference = typename allocator_type::const_reference;
+        using pointer = typename allocator_type::pointer;
+        using const_pointer = typename allocator_type::const_pointer;
+
+        using iterator = segmented_vector_iterator<value_type>;
+        using const_iterator = segmented_vector_iterator<const value_type>;
+        using reverse_iterator = mystl::reverse_iterator<iterator>;
+        using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;
+
+        static constexpr size_type first_block_size = size_type(1) << layout::shift;  // 第 0 块的元素个数
+
+    private:
+        using map_allocator = typename Allocator::template rebind<pointer>::other;
+        using map_pointer = pointer*;
+
+        map_pointer map_;          // 块表，首次分配块时一次分配 max_blocks 项，未分配的块为 nullptr
+        size_type blocks_;         // 已分配的块数
+        size_type size_;           // 元素个数
+
+        // 分配器
+        allocator_type alloc_;     // 元素分配器
+        map_allocator map_alloc_;  // 块表分配器
+
+    public:
+        //------------------------------------------------------------------------------
+        // 构造/析构函数
+        //------------------------------------------------------------------------------
+
+        segmented_vector() noexcept : map_(nullptr), blocks_(0), size_(0) {}
+
+        // 使用指定的分配器构造空容器
+        explicit segmented_vector(const allocator_type& alloc) noexcept
+            : map_(nullptr), blocks_(0), size_(0), alloc_(alloc), map_alloc_(alloc) {}
+
+        // 创建包含count个默认值的容器
+        explicit segmented_vector(size_type count, const allocator_type& alloc = allocator_type())
+            : segmented_vector(alloc)
+        {
+            resize(count);
+        }
+
+        // 创建包含count个值为value的容器
+        segmented_vector(size_type count, const T& value, const allocator_type& alloc = allocator_type())
+            : segmented_vector(alloc)
+        {
+            resize(count, value);
+        }
+
+        // 迭代器范围构造
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        segmented_vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : segmented_vector(alloc)
+        {
+            append(first, last);
+        }
+
+        // 使用初始化列表构造
+        segmented_vector(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : segmented_vector(alloc)
+        {
+            append(init.begin(), init.end());
+        }
+
+        // 深拷贝
+        segmented_vector(const segmented_vector& other)
+            : segmented_vector(other.alloc_)
+        {
+            append(other.begin(), other.end());
+        }
+
+        // 使用指定的分配器深拷贝
+        segmented_vector(const segmented_vector& other, const allocator_type& alloc)
+            : segmented_vector(alloc)
+        {
+            append(other.begin(), other.end());
+        }
+
+        // 移动构造：接管块表，迭代器与元素地址保持有效
+        segmented_vector(segmented_vector&& other) noexcept
+            : map_(other.map_), blocks_(other.blocks_), size_(other.size_),
+              alloc_(mystl::move(other.alloc_)), map_alloc_(mystl::move(other.map_alloc_))
+        {
+            other.map_ = nullptr;
+            other.blocks_ = 0;
+            other.size_ = 0;
+        }
+
+        ~segmented_vector()
+        {
+            release();
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 赋值操作
+        //------------------------------------------------------------------------------
+
+        segmented_vector& operator=(const segmented_vector& other)
+        {
+            if (this != &other)
+            {
+                segmented_vector temp(other, alloc_);  // 拷贝赋值保留自己的分配器
+                swap(temp);
+            }
+            return *this;
+        }
+
+        segmented_vector& operator=(segmented_vector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                segmented_vector temp(mystl::move(other));
+                swap(temp);
+            }
+            return *this;
+        }
+
+        segmented_vector& operator=(std::initializer_list<T> init)
+        {
+            assign(init.begin(), init.end());
+            return *this;
+        }
+
+        // 替换为count个value，已分配的块保留
+        void assign(size_type count, const T& value)
+        {
+            clear();
+            resize(count, value);
+        }
+
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            append(first, last);
+        }
+
+        void assign(std::initializer_list<T> init)
+        {
+            assign(init.begin(), init.end());
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 元素访问
+        //------------------------------------------------------------------------------
+
+        reference operator[](size_type pos) noexcept { return *slot(pos); }
+        const_reference operator[](size_type pos) const noexcept { return *slot(pos); }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("segmented_vector::at");
+            }
+            return *slot(pos);
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("segmented_vector::at");
+            }
+            return *slot(pos);
+        }
+
+        reference front() noexcept { return *map_[0]; }
+        const_reference front() const noexcept { return *map_[0]; }
+        reference back() noexcept { return *slot(size_ - 1); }
+        const_reference back() const noexcept { return *slot(size_ - 1); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 迭代器
+        //------------------------------------------------------------------------------
+
+        iterator begin() noexcept { return iterator(map_, 0); }
+        const_iterator begin() const noexcept { return const_iterator(map_, 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator(map_, size_); }
+        const_iterator end() const noexcept { return const_iterator(map_, size_); }
+        const_iterator cend() const noexcept { return end(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return rend(); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 容量操作
+        //------------------------------------------------------------------------------
+
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept { return mystl::max_size(alloc_); }
+
+        // 已分配的块所能容纳的元素个数
+        size_type capacity() const noexcept
+        {
+            return blocks_ == 0 ? 0 : layout::block_start(blocks_ - 1) + layout::block_size(blocks_ - 1);
+        }
+
+        // 已分配的块数
+        size_type block_count() const noexcept { return blocks_; }
+
+        // 分配新块直到能容纳 new_cap 个元素，已有元素不移动
+        void reserve(size_type new_cap)
+        {
+            if (new_cap > max_size())
+            {
+                throw length_error("segmented_vector::reserve");
+            }
+            while (capacity() < new_cap) add_block();
+        }
+
+        // 释放末尾未使用的块，没有元素时连同块表一起释放
+        void shrink_to_fit() noexcept
+        {
+            size_type needed = size_ == 0 ? 0 : layout::block_of(size_ - 1) + 1;
+            while (blocks_ > needed)
+            {
+                --blocks_;
+                alloc_.deallocate(map_[blocks_], layout::block_size(blocks_));
+                map_[blocks_] = nullptr;
+            }
+            if (blocks_ == 0 && map_)
+            {
+                map_alloc_.deallocate(map_, layout::max_blocks);
+                map_ = nullptr;
+            }
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 修改器
+        //------------------------------------------------------------------------------
+
+        // 在末尾构造元素：容量不足时只分配新块，失败时容器不变
+        template<class... Args>
+        void emplace_back(Args&&... args)
+        {
+            if (size_ == capacity()) add_block();
+            mystl::construct(slot(size_), mystl::forward<Args>(args)...);
+            ++size_;
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(mystl::move(value)); }
+
+        void pop_back() noexcept
+        {
+            if (size_ > 0)
+            {
+                mystl::destroy_at(slot(--size_));
+            }
+        }
+
+        // 销毁所有元素，已分配的块保留
+        void clear() noexcept
+        {
+            erase_at_end(0);
+        }
+
+        void resize(size_type count)
+        {
+            resize_with(count, [](pointer p) { mystl::construct(p); });
+        }
+
+        void resize(size_type count, const value_type& value)
+        {
+            resize_with(count, [&](pointer p) { mystl::construct(p, value); });
+        }
+
+        // 在末尾追加区间 [first, last)，前向迭代器预先分配所需的块
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        void append(InputIt first, InputIt last)
+        {
+            using category = typename iterator_traits<InputIt>::iterator_category;
+            if constexpr (!is_same_v<category, input_iterator_tag>)
+            {
+                reserve(size_ + static_cast<size_type>(mystl::distance(first, last)));
+            }
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        void swap(segmented_vector& other) noexcept
+        {
+            mystl::swap(map_, other.map_);
+            mystl::swap(blocks_, other.blocks_);
+            mystl::swap(size_, other.size_);
+            mystl::swap(alloc_, other.alloc_);
+            mystl::swap(map_alloc_, other.map_alloc_);
+        }
+
+        allocator_type get_allocator() const noexcept { return alloc_; }
+
+    private:
+        // 下标 i 处的元素地址，所在块须已分配
+        pointer slot(size_type i) const noexcept
+        {
+            size_type k = layout::block_of(i);
+            return map_[k] + (i - layout::block_start(k));
+        }
+
+        // 分配下一个块，块表在第一次分配块时创建
+        void add_block()
+        {
+            if (blocks_ == layout::max_blocks)
+            {
+                throw length_error("segmented_vector::add_block");
+            }
+            if (!map_)
+            {
+                map_ = map_alloc_.allocate(layout::max_blocks);
+                for (size_type k = 0; k < layout::max_blocks; ++k) map_[k] = nullptr;
+            }
+            map_[blocks_] = alloc_.allocate(layout::block_size(blocks_));
+            ++blocks_;
+        }
+
+        // 按块销毁 [n, size_) 中的元素
+        void erase_at_end(size_type n) noexcept
+        {
+            while (size_ > n)
+            {
+                size_type k = layout::block_of(size_ - 1);
+                size_type begin = mystl::max(n, layout::block_start(k));
+                mystl::destroy(map_[k] + (begin - layout::block_start(k)), map_[k] + (size_ - layout::block_start(k)));
+                size_ = begin;
+            }
+        }
+
+        // 调整大小，新元素由 construct(p) 构造；构造失败时销毁已构造的新元素
+        template<class Construct>
+        void resize_with(size_type count, Construct construct)
+        {
+            if (count <= size_)
+            {
+                erase_at_end(count);
+                return;
+            }
+            reserve(count);
+            size_type old_size = size_;
+            try
+            {
+                for (; size_ < count; ++size_) construct(slot(size_));
+            }
+            catch (...)
+            {
+                erase_at_end(old_size);
+                throw;
+            }
+        }
+
+        // 销毁所有元素并释放所有块
+        void release() noexcept
+        {
+            clear();
+            shrink_to_fit();
+        }
+    };
+
+    // segmented_vector 只持有指向块表的指针，分配器可平凡重定位时整个容器也可以
+    template <class T, class Alloc>
+    struct is_trivially_relocatable<segmented_vector<T, Alloc>> : is_trivially_relocatable<Alloc> {};
+
+
+
+    //------------------------------------------------------------------------------
+    // 非成员函数
+    //------------------------------------------------------------------------------
+
+    template <class T, class Alloc>
+    bool operator==(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T, class Alloc>
+    bool operator!=(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator<(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Alloc>
+    bool operator>(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Alloc>
+    bool operator<=(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator>=(const segmented_vector<T, Alloc>& lhs, const segmented_vector<T, Alloc>& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Alloc>
+    void swap(segmented_vector<T, Alloc>& lhs, segmented_vector<T, Alloc>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
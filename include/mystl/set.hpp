@@ -34,6 +34,10 @@ public:
 public:
     // 构造函数
     set() = default;
+    explicit set(const allocator_type& alloc) : tree_(alloc) {}
+    set(const Compare& comp, const allocator_type& alloc) : tree_(comp, alloc) {}
+
+    allocator_type get_allocator() const noexcept { return tree_.get_allocator(); }
     
     template <class InputIterator>
     set(InputIterator first, InputIterator last)
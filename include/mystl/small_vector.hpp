@@ -0,0 +1,693 @@
+#pragma once
+
+#include <initializer_list>
+#include "vector.hpp"
+
+namespace mystl
+{
+    /*****************************************************************************************/
+    // small_vector 的实现
+    // 前 N 个元素存放在对象内部的缓冲区中，不访问分配器；超过 N 个时整体搬到堆上，之后与 vector 相同
+    // 迭代器沿用 vector_iterator，扩容、插入的异常安全保证与 vector 一致
+    /*****************************************************************************************/
+    template <class T, size_t N, class Allocator = mystl::allocator<T>, class GrowthPolicy = default_growth_policy>
+    class small_vector
+    {
+        static_assert(N > 0, "small_vector requires N > 0, use vector instead");
+
+    public:
+        //------------------------------------------------------------------------------
+        // 类型定义
+        //------------------------------------------------------------------------------
+        using value_type = typename Allocator::value_type;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = typename allocator_type::reference;
+        using const_reference = typename allocator_type::const_reference;
+        using pointer = typename allocator_type::pointer;
+        using const_pointer = typename allocator_type::const_pointer;
+
+        using iterator = vector_iterator<value_type>;
+        using const_iterator = vector_iterator<const value_type>;
+        using reverse_iterator = mystl::reverse_iterator<iterator>;
+        using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;
+
+        static constexpr size_type inline_capacity = N;  // 内部缓冲区能容纳的元素个数
+
+    private:
+        //------------------------------------------------------------------------------
+        // 成员变量
+        //------------------------------------------------------------------------------
+        pointer data_;          // 指向内部缓冲区或堆内存
+        size_type size_;       // 当前存储的元素个数
+        size_type capacity_;   // 当前存储空间大小，使用内部缓冲区时为 N
+        allocator_type alloc_; // 内存分配器实例，只用于堆内存
+        alignas(T) unsigned char buffer_[sizeof(T) * N];  // 内部缓冲区
+
+    public:
+        //------------------------------------------------------------------------------
+        // 构造/析构函数
+        //------------------------------------------------------------------------------
+
+        // 默认构造函数
+        small_vector() noexcept : data_(inline_data()), size_(0), capacity_(N) {}
+
+        // 使用指定的分配器构造空 small_vector
+        explicit small_vector(const allocator_type& alloc) noexcept
+            : data_(inline_data()), size_(0), capacity_(N), alloc_(alloc) {}
+
+        // 创建包含count个默认值的 small_vector
+        explicit small_vector(size_type count, const allocator_type& alloc = allocator_type())
+            : small_vector(alloc)
+        {
+            resize(count);
+        }
+
+        // 创建包含count个值为value的 small_vector
+        small_vector(size_type count, const T& value, const allocator_type& alloc = allocator_type())
+            : small_vector(alloc)
+        {
+            assign(count, value);
+        }
+
+        // 迭代器范围构造
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        small_vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : small_vector(alloc)
+        {
+            assign(first, last);
+        }
+
+        // 使用初始化列表创建 small_vector
+        small_vector(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : small_vector(alloc)
+        {
+            assign(init.begin(), init.end());
+        }
+
+        // 深拷贝
+        small_vector(const small_vector& other)
+            : small_vector(other.alloc_)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        // 移动构造：对方在堆上时直接接管内存，在内部缓冲区时逐个移动元素
+        small_vector(small_vector&& other) noexcept(is_nothrow_move_constructible<T>::value)
+            : small_vector(other.alloc_)
+        {
+            take_from(other);
+        }
+
+        // 析构函数
+        ~small_vector()
+        {
+            clear();
+            release_heap();
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 迭代器
+        //------------------------------------------------------------------------------
+
+        iterator begin() noexcept { return iterator(data_); }
+        const_iterator begin() const noexcept { return const_iterator(data_); }
+        const_iterator cbegin() const noexcept { return const_iterator(data_); }
+
+        iterator end() noexcept { return iterator(data_ + size_); }
+        const_iterator end() const noexcept { return const_iterator(data_ + size_); }
+        const_iterator cend() const noexcept { return const_iterator(data_ + size_); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 元素访问
+        //------------------------------------------------------------------------------
+
+        reference operator[](size_type pos) { return data_[pos]; }
+        const_reference operator[](size_type pos) const { return data_[pos]; }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("small_vector::at");
+            }
+            return data_[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("small_vector::at");
+            }
+            return data_[pos];
+        }
+
+        reference front() { return data_[0]; }
+        const_reference front() const { return data_[0]; }
+
+        reference back() { return data_[size_ - 1]; }
+        const_reference back() const { return data_[size_ - 1]; }
+
+        pointer data() noexcept { return data_; }
+        const_pointer data() const noexcept { return data_; }
+
+
+
+        //------------------------------------------------------------------------------
+        // 容量操作
+        //------------------------------------------------------------------------------
+
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept { return mystl::max_size(alloc_); }
+        size_type capacity() const noexcept { return capacity_; }
+
+        // 元素是否存放在内部缓冲区中
+        bool is_inline() const noexcept { return data_ == inline_data(); }
+
+        // 预留存储空间，不超过 N 时不做任何事
+        void reserve(size_type new_cap)
+        {
+            if (new_cap <= capacity_) return;
+            reallocate_insert(new_cap, size_, 0, [](pointer) {});
+        }
+
+        // 减少容量以适应大小，元素个数不超过 N 时搬回内部缓冲区
+        void shrink_to_fit()
+        {
+            if (is_inline() || size_ == capacity_) return;
+            if (size_ <= N)
+            {
+                relocate_to(inline_data(), size_, 0);
+                release_heap();
+                data_ = inline_data();
+                capacity_ = N;
+            }
+            else
+            {
+                reallocate_insert(size_, size_, 0, [](pointer) {});
+            }
+        }
+
+        // 调整容器大小（用值初始化的元素填充）
+        void resize(size_type count)
+        {
+            if (count > capacity_)
+            {
+                reallocate_insert(next_capacity(count), size_, count - size_,
+                                  [&](pointer p) { mystl::uninitialized_value_construct(p, p + (count - size_)); });
+                size_ = count;
+            }
+            else if (count > size_)
+            {
+                mystl::uninitialized_value_construct(data_ + size_, data_ + count);
+                size_ = count;
+            }
+            else
+            {
+                erase_at_end(count);
+            }
+        }
+
+        // 调整容器大小（用指定值填充），value 可以引用容器中的元素
+        void resize(size_type count, const value_type& value)
+        {
+            if (count > capacity_)
+            {
+                reallocate_insert(next_capacity(count), size_, count - size_,
+                                  [&](pointer p) { mystl::uninitialized_fill_n(p, count - size_, value); });
+                size_ = count;
+            }
+            else if (count > size_)
+            {
+                mystl::uninitialized_fill_n(data_ + size_, count - size_, value);
+                size_ = count;
+            }
+            else
+            {
+                erase_at_end(count);
+            }
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 赋值操作
+        //------------------------------------------------------------------------------
+
+        // 拷贝赋值：保留自己的分配器
+        small_vector& operator=(const small_vector& other)
+        {
+            if (this != &other)
+            {
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        // 移动赋值：内存随分配器一起转移
+        small_vector& operator=(small_vector&& other) noexcept(is_nothrow_move_constructible<T>::value)
+        {
+            if (this != &other)
+            {
+                clear();
+                release_heap();
+                data_ = inline_data();
+                capacity_ = N;
+                alloc_ = other.alloc_;
+                take_from(other);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(std::initializer_list<T> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+        // 用区间替换原内容：需要更大的空间时先在新空间构造，成功后才释放原内容（强异常保证）
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        void assign(InputIt first, InputIt last)
+        {
+            const size_type n = static_cast<size_type>(mystl::distance(first, last));
+            if (n > capacity_)
+            {
+                pointer new_data = alloc_.allocate(n);
+                try
+                {
+                    mystl::uninitialized_copy(first, last, new_data);
+                }
+                catch (...)
+                {
+                    alloc_.deallocate(new_data, n);
+                    throw;
+                }
+                adopt(new_data, n);
+            }
+            else
+            {
+                clear();
+                mystl::uninitialized_copy(first, last, data_);
+            }
+            size_ = n;
+        }
+
+        // 用 n 个 value 替换原内容
+        void assign(size_type n, const value_type& value)
+        {
+            if (n > capacity_)
+            {
+                pointer new_data = alloc_.allocate(n);
+                try
+                {
+                    mystl::uninitialized_fill_n(new_data, n, value);
+                }
+                catch (...)
+                {
+                    alloc_.deallocate(new_data, n);
+                    throw;
+                }
+                adopt(new_data, n);
+            }
+            else
+            {
+                value_type value_copy = value;  // value 可能引用容器中的元素
+                clear();
+                mystl::uninitialized_fill_n(data_, n, value_copy);
+            }
+            size_ = n;
+        }
+
+        void assign(std::initializer_list<T> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 修改器
+        //------------------------------------------------------------------------------
+
+        // 清空所有元素，保留已有的存储空间
+        void clear() noexcept
+        {
+            erase_at_end(0);
+        }
+
+        iterator insert(const_iterator pos, const value_type& value)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, value_type&& value)
+        {
+            return emplace(pos, mystl::move(value));
+        }
+
+        // 在指定位置插入 count 个 value
+        iterator insert(const_iterator pos, size_type count, const value_type& value)
+        {
+            const size_type offset = pos - cbegin();
+            if (count == 0) return iterator(data_ + offset);
+            if (size_ + count > capacity_)
+            {
+                reallocate_insert(next_capacity(size_ + count), offset, count,
+                                  [&](pointer p) { mystl::uninitialized_fill_n(p, count, value); });
+            }
+            else
+            {
+                value_type value_copy = value;  // value 可能引用容器中的元素
+                const size_type k = open_gap(offset, count, [&](pointer p, size_type skip)
+                                             { mystl::uninitialized_fill_n(p, count - skip, value_copy); });
+                mystl::fill_n(data_ + offset, k, value_copy);
+            }
+            size_ += count;
+            return iterator(data_ + offset);
+        }
+
+        // 在指定位置插入区间 [first, last)
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            const size_type offset = pos - cbegin();
+            const size_type count = static_cast<size_type>(mystl::distance(first, last));
+            if (count == 0) return iterator(data_ + offset);
+            if (size_ + count > capacity_)
+            {
+                // 区间在原空间中时依然有效：新元素先于搬迁构造
+                reallocate_insert(next_capacity(size_ + count), offset, count,
+                                  [&](pointer p) { mystl::uninitialized_copy(first, last, p); });
+            }
+            else
+            {
+                // 先复制到临时对象，区间可能引用本容器中的元素
+                small_vector tmp(first, last, alloc_);
+                const size_type k = open_gap(offset, count, [&](pointer p, size_type skip)
+                                             { mystl::uninitialized_move(tmp.data() + skip, tmp.data() + count, p); });
+                mystl::move(tmp.data(), tmp.data() + k, data_ + offset);
+            }
+            size_ += count;
+            return iterator(data_ + offset);
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        template<class... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            const size_type offset = pos - cbegin();
+            if (size_ == capacity_)
+            {
+                reallocate_insert(next_capacity(size_ + 1), offset, 1,
+                                  [&](pointer p) { mystl::construct(p, mystl::forward<Args>(args)...); });
+            }
+            else if (offset == size_)
+            {
+                mystl::construct(data_ + size_, mystl::forward<Args>(args)...);
+            }
+            else
+            {
+                // 先构造新元素，失败时原数据不变
+                value_type tmp(mystl::forward<Args>(args)...);
+                open_gap(offset, 1, [](pointer, size_type) {});  // offset < size_，新元素总在原有空间内
+                data_[offset] = mystl::move(tmp);
+            }
+            ++size_;
+            return iterator(data_ + offset);
+        }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (size_ == capacity_)
+            {
+                // 先在新空间构造，参数引用本容器中的元素时依然有效
+                reallocate_insert(next_capacity(size_ + 1), size_, 1,
+                                  [&](pointer p) { mystl::construct(p, mystl::forward<Args>(args)...); });
+            }
+            else
+            {
+                mystl::construct(data_ + size_, mystl::forward<Args>(args)...);
+            }
+            return data_[size_++];
+        }
+
+        void push_back(const value_type& value) { emplace_back(value); }
+        void push_back(value_type&& value) { emplace_back(mystl::move(value)); }
+
+        void pop_back()
+        {
+            if (!empty())
+            {
+                mystl::destroy_at(data_ + --size_);
+            }
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            return erase(pos, pos + 1);
+        }
+
+        // 删除 [first, last)，之后的元素依次前移
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            const size_type offset = first - cbegin();
+            const size_type count = last - first;
+            if (count != 0)
+            {
+                mystl::move(data_ + offset + count, data_ + size_, data_ + offset);
+                erase_at_end(size_ - count);
+            }
+            return iterator(data_ + offset);
+        }
+
+        // 与另一个 small_vector 交换内容；双方都在堆上时只交换指针，否则需要移动元素
+        void swap(small_vector& other) noexcept(is_nothrow_move_constructible<T>::value)
+        {
+            if (this == &other) return;
+            if (!is_inline() && !other.is_inline())
+            {
+                mystl::swap(data_, other.data_);
+                mystl::swap(size_, other.size_);
+                mystl::swap(capacity_, other.capacity_);
+                mystl::swap(alloc_, other.alloc_);
+                return;
+            }
+            small_vector tmp(mystl::move(other));
+            other = mystl::move(*this);
+            *this = mystl::move(tmp);
+        }
+
+        allocator_type get_allocator() const noexcept { return alloc_; }
+
+    private:
+        // 按增长策略计算至少容纳 required 个元素的新容量
+        size_type next_capacity(size_type required) const noexcept
+        {
+            return GrowthPolicy::next_capacity(capacity_, required, sizeof(T));
+        }
+
+        pointer inline_data() noexcept { return reinterpret_cast<pointer>(buffer_); }
+        const_pointer inline_data() const noexcept { return reinterpret_cast<const_pointer>(buffer_); }
+
+        // 释放堆内存（元素已销毁或已搬走），不修改 data_ 与 capacity_
+        void release_heap() noexcept
+        {
+            if (!is_inline())
+            {
+                alloc_.deallocate(data_, capacity_);
+            }
+        }
+
+        // 销毁 [new_size, size_) 中的元素
+        void erase_at_end(size_type new_size) noexcept
+        {
+            mystl::destroy(data_ + new_size, data_ + size_);
+            size_ = new_size;
+        }
+
+        // 销毁原内容并改用已构造好元素的 new_data
+        void adopt(pointer new_data, size_type new_cap) noexcept
+        {
+            clear();
+            release_heap();
+            data_ = new_data;
+            capacity_ = new_cap;
+        }
+
+        // 接管 other 的内容：堆内存直接转移，内部缓冲区中的元素逐个移动（要求自身为空且使用内部缓冲区）
+        void take_from(small_vector& other) noexcept(is_nothrow_move_constructible<T>::value)
+        {
+            if (other.is_inline())
+            {
+                mystl::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+                size_ = other.size_;
+                other.clear();
+            }
+            else
+            {
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_data();
+                other.size_ = 0;
+                other.capacity_ = N;
+            }
+        }
+
+        // 容量足够时在 offset 处腾出 count 个位置，offset 之后的元素后移 count 个位置。
+        // 落在原末尾之后未初始化空间中的新元素由 construct_tail(p, skip) 构造（新元素中下标 >= skip 的部分），
+        // 返回值 k 表示 [offset, offset + k) 中仍是已移出的旧对象，由调用者赋值为前 k 个新元素
+        template<class ConstructTail>
+        size_type open_gap(size_type offset, size_type count, ConstructTail construct_tail)
+        {
+            pointer old_finish = data_ + size_;
+            const size_type elems_after = size_ - offset;
+            if (elems_after > count)
+            {
+                mystl::uninitialized_move(old_finish - count, old_finish, old_finish);
+                mystl::move_backward(data_ + offset, old_finish - count, old_finish);
+                return count;
+            }
+            // 插入点之后的元素不足 count 个：多出的新元素直接构造在末尾，再把插入点之后的元素移到它们后面
+            const size_type extra = count - elems_after;
+            construct_tail(old_finish, elems_after);
+            try
+            {
+                mystl::uninitialized_move(data_ + offset, old_finish, old_finish + extra);
+            }
+            catch (...)
+            {
+                mystl::destroy(old_finish, old_finish + extra);
+                throw;
+            }
+            return elems_after;
+        }
+
+        // 扩容到堆上的 new_cap：先由 construct_new(p) 在新空间的 [offset, offset + count) 构造新元素，
+        // 再把原有元素搬到新空间，offset 之后的元素后移 count 个位置；任一步失败时原数据不变
+        template<class ConstructNew>
+        void reallocate_insert(size_type new_cap, size_type offset, size_type count, ConstructNew construct_new)
+        {
+            pointer new_data = alloc_.allocate(new_cap);
+            try
+            {
+                construct_new(new_data + offset);
+            }
+            catch (...)
+            {
+                alloc_.deallocate(new_data, new_cap);
+                throw;
+            }
+
+            try
+            {
+                relocate_to(new_data, offset, count);
+            }
+            catch (...)
+            {
+                mystl::destroy(new_data + offset, new_data + offset + count);
+                alloc_.deallocate(new_data, new_cap);
+                throw;
+            }
+
+            release_heap();
+            data_ = new_data;
+            capacity_ = new_cap;
+        }
+
+        // 把原有元素搬到 new_data，offset 之后的元素后移 gap 个位置，成功后原空间中的对象已销毁
+        void relocate_to(pointer new_data, size_type offset, size_type gap)
+        {
+            if constexpr (is_trivially_relocatable<T>::value)
+            {
+                mystl::uninitialized_relocate(data_, data_ + offset, new_data);
+                mystl::uninitialized_relocate(data_ + offset, data_ + size_, new_data + offset + gap);
+            }
+            else
+            {
+                mystl::uninitialized_move_if_noexcept(data_, data_ + offset, new_data);
+                try
+                {
+                    mystl::uninitialized_move_if_noexcept(data_ + offset, data_ + size_, new_data + offset + gap);
+                }
+                catch (...)
+                {
+                    mystl::destroy(new_data, new_data + offset);
+                    throw;
+                }
+                mystl::destroy(data_, data_ + size_);
+            }
+        }
+    };
+
+    // 注意：small_vector 使用内部缓冲区时 data_ 指向自身，不能按字节搬迁，
+    // is_trivially_relocatable 保持默认的 false
+
+
+
+    //------------------------------------------------------------------------------
+    // 非成员函数
+    //------------------------------------------------------------------------------
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator==(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator!=(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator<(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator>(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator<=(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    bool operator>=(const small_vector<T, N, Alloc, Growth>& lhs, const small_vector<T, N, Alloc, Growth>& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template<class T, size_t N, class Alloc, class Growth>
+    void swap(small_vector<T, N, Alloc, Growth>& lhs, small_vector<T, N, Alloc, Growth>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
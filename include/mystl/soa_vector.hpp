@@ -0,0 +1,804 @@
+#pragma once
+
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include "expectdef.hpp"
+#include "allocator.hpp"
+#include "iterator.hpp"
+#include "uninitialized.hpp"
+#include "algorithm.hpp"
+#include "growth_policy.hpp"
+
+namespace mystl
+{
+    namespace soa_detail
+    {
+        // 每一列的起始地址按缓存行对齐，便于向量化
+        constexpr size_t COLUMN_ALIGN = 64;
+
+        // 分配的基本单位，整块内存按缓存行分配
+        struct alignas(COLUMN_ALIGN) cache_line
+        {
+            unsigned char bytes[COLUMN_ALIGN];
+        };
+
+        // 容纳 n 个 T 所需的缓存行数
+        template<class T>
+        constexpr size_t lines_for(size_t n) noexcept
+        {
+            return (n * sizeof(T) + COLUMN_ALIGN - 1) / COLUMN_ALIGN;
+        }
+
+        // 对每个下标 I 调用 f(integral_constant<size_t, I>)
+        template<class F, size_t... Is>
+        void for_each_index(F&& f, std::index_sequence<Is...>)
+        {
+            (f(std::integral_constant<size_t, Is>{}), ...);
+        }
+    } // namespace soa_detail
+
+
+
+    /*****************************************************************************************/
+    // soa_column
+    // 一列的连续视图：data() 按缓存行对齐，迭代器是原生指针，可直接用于 memmove / memset 路径和向量化循环
+    /*****************************************************************************************/
+    template<class T>
+    class soa_column
+    {
+    public:
+        using value_type = remove_cv_t<T>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+
+        soa_column() noexcept : data_(nullptr), size_(0) {}
+        soa_column(T* data, size_type size) noexcept : data_(data), size_(size) {}
+
+        T* data() const noexcept { return data_; }
+        size_type size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        iterator begin() const noexcept { return data_; }
+        iterator end() const noexcept { return data_ + size_; }
+
+        reference operator[](size_type pos) const noexcept { return data_[pos]; }
+        reference front() const noexcept { return data_[0]; }
+        reference back() const noexcept { return data_[size_ - 1]; }
+
+    private:
+        T* data_;
+        size_type size_;
+    };
+
+
+
+    /*****************************************************************************************/
+    // soa_reference
+    // soa_vector 中一行的代理引用，保存指向各列元素的指针。
+    // 赋值按列写回，转换为 value_type（std::tuple）时按列复制；
+    // Ts 带 const 时为只读引用
+    /*****************************************************************************************/
+    template<class... Ts>
+    class soa_reference
+    {
+        template<class... Us>
+        friend class soa_reference;
+
+    public:
+        using value_type = std::tuple<remove_cv_t<Ts>...>;
+
+        explicit soa_reference(Ts*... ptrs) noexcept : ptrs_(ptrs...) {}
+
+        soa_reference(const soa_reference&) noexcept = default;
+
+        // 可写引用转换为只读引用
+        template<class... Us, typename = typename enable_if<
+            sizeof...(Us) == sizeof...(Ts) && !is_same_v<std::tuple<Us...>, std::tuple<Ts...>> &&
+            (is_convertible_v<Us*, Ts*> && ...)>::type>
+        soa_reference(const soa_reference<Us...>& other) noexcept : ptrs_(other.ptrs_) {}
+
+        // 第 I 列的元素
+        template<size_t I>
+        auto& get() const noexcept { return *std::get<I>(ptrs_); }
+
+        // 各列元素的引用组成的 tuple，用于比较
+        std::tuple<Ts&...> tie() const noexcept
+        {
+            return std::apply([](Ts*... p) { return std::tuple<Ts&...>(*p...); }, ptrs_);
+        }
+
+        // 按列复制出整行
+        operator value_type() const
+        {
+            return std::apply([](Ts*... p) { return value_type(*p...); }, ptrs_);
+        }
+
+        // 赋值写回所引用的行，而不是重新绑定
+        soa_reference& operator=(const soa_reference& rhs)
+        {
+            assign(rhs, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        template<class... Us>
+        soa_reference& operator=(const soa_reference<Us...>& rhs)
+        {
+            assign(rhs, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        soa_reference& operator=(const value_type& row)
+        {
+            assign_tuple(row, std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        soa_reference& operator=(value_type&& row)
+        {
+            assign_tuple(mystl::move(row), std::index_sequence_for<Ts...>{});
+            return *this;
+        }
+
+        // 按列交换两行
+        friend void swap(soa_reference a, soa_reference b)
+        {
+            a.swap_rows(b, std::index_sequence_for<Ts...>{});
+        }
+
+    private:
+        std::tuple<Ts*...> ptrs_;
+
+        template<class Ref, size_t... Is>
+        void assign(const Ref& rhs, std::index_sequence<Is...>)
+        {
+            ((get<Is>() = rhs.template get<Is>()), ...);
+        }
+
+        template<class Tuple, size_t... Is>
+        void assign_tuple(Tuple&& row, std::index_sequence<Is...>)
+        {
+            ((get<Is>() = std::get<Is>(mystl::forward<Tuple>(row))), ...);
+        }
+
+        template<size_t... Is>
+        void swap_rows(soa_reference& other, std::index_sequence<Is...>)
+        {
+            (mystl::swap(get<Is>(), other.template get<Is>()), ...);
+        }
+    };
+
+    // 按列访问，对 soa_reference 和 std::tuple 都可用，便于编写同时接受两者的比较函数
+    template<size_t I, class... Ts>
+    auto& get(const soa_reference<Ts...>& ref) noexcept
+    {
+        return ref.template get<I>();
+    }
+
+    template<size_t I, class... Ts>
+    auto& get(std::tuple<Ts...>& row) noexcept
+    {
+        return std::get<I>(row);
+    }
+
+    template<size_t I, class... Ts>
+    const auto& get(const std::tuple<Ts...>& row) noexcept
+    {
+        return std::get<I>(row);
+    }
+
+    // 比较按列字典序进行
+    template<class... Ts, class... Us>
+    bool operator==(const soa_reference<Ts...>& lhs, const soa_reference<Us...>& rhs) { return lhs.tie() == rhs.tie(); }
+    template<class... Ts, class... Us>
+    bool operator==(const soa_reference<Ts...>& lhs, const std::tuple<Us...>& rhs) { return lhs.tie() == rhs; }
+    template<class... Ts, class... Us>
+    bool operator==(const std::tuple<Us...>& lhs, const soa_reference<Ts...>& rhs) { return lhs == rhs.tie(); }
+
+    template<class... Ts, class... Us>
+    bool operator!=(const soa_reference<Ts...>& lhs, const soa_reference<Us...>& rhs) { return !(lhs == rhs); }
+    template<class... Ts, class... Us>
+    bool operator!=(const soa_reference<Ts...>& lhs, const std::tuple<Us...>& rhs) { return !(lhs == rhs); }
+    template<class... Ts, class... Us>
+    bool operator!=(const std::tuple<Us...>& lhs, const soa_reference<Ts...>& rhs) { return !(lhs == rhs); }
+
+    template<class... Ts, class... Us>
+    bool operator<(const soa_reference<Ts...>& lhs, const soa_reference<Us...>& rhs) { return lhs.tie() < rhs.tie(); }
+    template<class... Ts, class... Us>
+    bool operator<(const soa_reference<Ts...>& lhs, const std::tuple<Us...>& rhs) { return lhs.tie() < rhs; }
+    template<class... Ts, class... Us>
+    bool operator<(const std::tuple<Us...>& lhs, const soa_reference<Ts...>& rhs) { return lhs < rhs.tie(); }
+
+
+
+    /*****************************************************************************************/
+    // soa_iterator
+    // 按行遍历的随机访问迭代器（zip 迭代器）：保存各列的起始指针和行号，解引用得到 soa_reference。
+    // 各列分开存放，迭代器不连续
+    /*****************************************************************************************/
+    template<bool IsConst, class... Fields>
+    class soa_iterator
+    {
+        template<bool, class...>
+        friend class soa_iterator;
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = std::tuple<Fields...>;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = typename conditional<IsConst,
+            soa_reference<const Fields...>, soa_reference<Fields...>>::type;
+        using columns = std::tuple<Fields*...>;
+
+        soa_iterator() noexcept : cols_(), index_(0) {}
+        soa_iterator(const columns& cols, difference_type index) noexcept : cols_(cols), index_(index) {}
+
+        // 转换为const迭代器
+        template<bool C = IsConst, typename = typename enable_if<!C>::type>
+        operator soa_iterator<true, Fields...>() const noexcept
+        {
+            return soa_iterator<true, Fields...>(cols_, index_);
+        }
+
+        reference operator*() const noexcept
+        {
+            return std::apply([this](Fields*... p) { return reference((p + index_)...); }, cols_);
+        }
+
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        soa_iterator& operator++() noexcept { ++index_; return *this; }
+        soa_iterator operator++(int) noexcept { soa_iterator tmp = *this; ++index_; return tmp; }
+        soa_iterator& operator--() noexcept { --index_; return *this; }
+        soa_iterator operator--(int) noexcept { soa_iterator tmp = *this; --index_; return tmp; }
+
+        soa_iterator& operator+=(difference_type n) noexcept { index_ += n; return *this; }
+        soa_iterator& operator-=(difference_type n) noexcept { index_ -= n; return *this; }
+        soa_iterator operator+(difference_type n) const noexcept { return soa_iterator(cols_, index_ + n); }
+        soa_iterator operator-(difference_type n) const noexcept { return soa_iterator(cols_, index_ - n); }
+
+        friend soa_iterator operator+(difference_type n, const soa_iterator& it) noexcept { return it + n; }
+
+        // 同一容器的迭代器按行号比较
+        template<bool C>
+        difference_type operator-(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ - rhs.index_; }
+
+        template<bool C>
+        bool operator==(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ == rhs.index_; }
+        template<bool C>
+        bool operator!=(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ != rhs.index_; }
+        template<bool C>
+        bool operator<(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ < rhs.index_; }
+        template<bool C>
+        bool operator>(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ > rhs.index_; }
+        template<bool C>
+        bool operator<=(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ <= rhs.index_; }
+        template<bool C>
+        bool operator>=(const soa_iterator<C, Fields...>& rhs) const noexcept { return index_ >= rhs.index_; }
+
+    private:
+        columns cols_;            // 各列的起始地址
+        difference_type index_;   // 行号
+    };
+
+
+
+    /*****************************************************************************************/
+    // soa_vector 的实现
+    // 结构数组（struct of arrays）：每个字段单独存放在一段连续、按缓存行对齐的数组中，
+    // 只访问一两个字段的扫描循环不再把整行读入缓存。所有列共用一次分配，列 I 紧跟在列 I - 1 之后。
+    // 整行通过 soa_reference 代理访问，迭代器可用于 mystl::sort 等算法
+    /*****************************************************************************************/
+    template<class... Fields>
+    class soa_vector
+    {
+        static_assert(sizeof...(Fields) > 0, "soa_vector 至少需要一列");
+        static_assert(((alignof(Fields) <= soa_detail::COLUMN_ALIGN) && ...),
+                      "soa_vector 的列类型对齐要求不能超过缓存行");
+
+    public:
+        // 类型定义
+        using value_type = std::tuple<Fields...>;
+        using size_type = size_t;
+        using difference_type = ptrdiff_t;
+        using reference = soa_reference<Fields...>;
+        using const_reference = soa_reference<const Fields...>;
+
+        using iterator = soa_iterator<false, Fields...>;
+        using const_iterator = soa_iterator<true, Fields...>;
+        using reverse_iterator = mystl::reverse_iterator<iterator>;
+        using const_reverse_iterator = mystl::reverse_iterator<const_iterator>;
+
+        // 第 I 列的元素类型
+        template<size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        static constexpr size_type column_count = sizeof...(Fields);
+        static constexpr size_type column_alignment = soa_detail::COLUMN_ALIGN;
+
+    private:
+        using line = soa_detail::cache_line;
+        using line_allocator = mystl::allocator<line>;
+        using columns = std::tuple<Fields*...>;
+
+        static constexpr size_type row_bytes = (sizeof(Fields) + ...);
+
+        line* buffer_;            // 所有列共用的内存
+        columns cols_;            // 各列的起始地址
+        size_type size_;          // 行数
+        size_type capacity_;      // 每一列可容纳的元素个数
+        line_allocator alloc_;
+
+    public:
+        //------------------------------------------------------------------------------
+        // 构造/析构函数
+        //------------------------------------------------------------------------------
+
+        soa_vector() noexcept : buffer_(nullptr), cols_(), size_(0), capacity_(0) {}
+
+        // 创建包含count行默认值的容器
+        explicit soa_vector(size_type count) : soa_vector()
+        {
+            resize(count);
+        }
+
+        // 使用初始化列表构造，每个元素是一整行
+        soa_vector(std::initializer_list<value_type> init) : soa_vector()
+        {
+            reserve(init.size());
+            for (const value_type& row : init) push_back(row);
+        }
+
+        // 深拷贝，按列复制
+        soa_vector(const soa_vector& other) : soa_vector()
+        {
+            if (other.size_ == 0) return;
+            reserve(other.size_);
+            size_type done = 0;
+            try
+            {
+                for_each_column([&](auto I)
+                {
+                    mystl::uninitialized_copy(std::get<I>(other.cols_), std::get<I>(other.cols_) + other.size_,
+                                              std::get<I>(cols_));
+                    ++done;
+                });
+            }
+            catch (...)
+            {
+                destroy_columns(cols_, 0, other.size_, done);
+                throw;
+            }
+            size_ = other.size_;
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : buffer_(other.buffer_), cols_(other.cols_), size_(other.size_), capacity_(other.capacity_),
+              alloc_(mystl::move(other.alloc_))
+        {
+            other.buffer_ = nullptr;
+            other.cols_ = columns();
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+
+        ~soa_vector()
+        {
+            clear();
+            deallocate(buffer_, capacity_);
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 赋值操作
+        //------------------------------------------------------------------------------
+
+        soa_vector& operator=(const soa_vector& other)
+        {
+            if (this != &other)
+            {
+                soa_vector temp(other);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                soa_vector temp(mystl::move(other));
+                swap(temp);
+            }
+            return *this;
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 元素访问
+        //------------------------------------------------------------------------------
+
+        reference operator[](size_type pos) noexcept { return begin()[pos]; }
+        const_reference operator[](size_type pos) const noexcept { return begin()[pos]; }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("soa_vector::at");
+            }
+            return begin()[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                throw out_of_range("soa_vector::at");
+            }
+            return begin()[pos];
+        }
+
+        reference front() noexcept { return begin()[0]; }
+        const_reference front() const noexcept { return begin()[0]; }
+        reference back() noexcept { return begin()[size_ - 1]; }
+        const_reference back() const noexcept { return begin()[size_ - 1]; }
+
+        // 第 I 列的视图，扩容后失效
+        template<size_t I>
+        soa_column<field_type<I>> column() noexcept
+        {
+            return soa_column<field_type<I>>(std::get<I>(cols_), size_);
+        }
+
+        template<size_t I>
+        soa_column<const field_type<I>> column() const noexcept
+        {
+            return soa_column<const field_type<I>>(std::get<I>(cols_), size_);
+        }
+
+        // 第 I 列的起始地址，按 column_alignment 对齐
+        template<size_t I>
+        field_type<I>* data() noexcept { return std::get<I>(cols_); }
+
+        template<size_t I>
+        const field_type<I>* data() const noexcept { return std::get<I>(cols_); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 迭代器
+        //------------------------------------------------------------------------------
+
+        iterator begin() noexcept { return iterator(cols_, 0); }
+        const_iterator begin() const noexcept { return const_iterator(cols_, 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        iterator end() noexcept { return iterator(cols_, static_cast<difference_type>(size_)); }
+        const_iterator end() const noexcept { return const_iterator(cols_, static_cast<difference_type>(size_)); }
+        const_iterator cend() const noexcept { return end(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+
+        //------------------------------------------------------------------------------
+        // 容量操作
+        //------------------------------------------------------------------------------
+
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type capacity() const noexcept { return capacity_; }
+
+        size_type max_size() const noexcept
+        {
+            return (static_cast<size_type>(PTRDIFF_MAX) - column_count * column_alignment) / row_bytes;
+        }
+
+        // 预留空间，所有列一起扩容
+        void reserve(size_type new_cap)
+        {
+            if (new_cap > max_size())
+            {
+                throw length_error("soa_vector::reserve");
+            }
+            if (new_cap > capacity_)
+            {
+                reallocate(new_cap);
+            }
+        }
+
+        // 释放多余空间，没有元素时释放全部内存
+        void shrink_to_fit()
+        {
+            if (size_ == capacity_) return;
+            if (size_ == 0)
+            {
+                deallocate(buffer_, capacity_);
+                buffer_ = nullptr;
+                cols_ = columns();
+                capacity_ = 0;
+                return;
+            }
+            reallocate(size_);
+        }
+
+
+
+        //------------------------------------------------------------------------------
+        // 修改器
+        //------------------------------------------------------------------------------
+
+        // 在末尾构造一行，每一列一个参数；任一列构造失败时容器不变
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back 需要为每一列提供一个参数");
+            if (size_ == capacity_)
+            {
+                // 新行先于搬迁构造，参数引用本容器中的元素时依然有效
+                size_type new_cap = default_growth_policy::next_capacity(capacity_, size_ + 1, row_bytes);
+                line* new_buffer = allocate(new_cap);
+                columns new_cols = make_columns(new_buffer, new_cap);
+                try
+                {
+                    construct_row(new_cols, size_, std::index_sequence_for<Fields...>{}, mystl::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    deallocate(new_buffer, new_cap);
+                    throw;
+                }
+                try
+                {
+                    relocate_to(new_cols);
+                }
+                catch (...)
+                {
+                    destroy_columns(new_cols, size_, size_ + 1, column_count);
+                    deallocate(new_buffer, new_cap);
+                    throw;
+                }
+                replace_storage(new_buffer, new_cols, new_cap);
+            }
+            else
+            {
+                construct_row(cols_, size_, std::index_sequence_for<Fields...>{}, mystl::forward<Args>(args)...);
+            }
+            ++size_;
+            return back();
+        }
+
+        void push_back(const value_type& row)
+        {
+            std::apply([this](const Fields&... fields) { emplace_back(fields...); }, row);
+        }
+
+        void push_back(value_type&& row)
+        {
+            std::apply([this](Fields&... fields) { emplace_back(mystl::move(fields)...); }, row);
+        }
+
+        void pop_back() noexcept
+        {
+            if (size_ > 0)
+            {
+                destroy_columns(cols_, size_ - 1, size_, column_count);
+                --size_;
+            }
+        }
+
+        // 改变行数，新行的每一列值初始化；失败时销毁已构造的新行
+        void resize(size_type count)
+        {
+            if (count <= size_)
+            {
+                destroy_columns(cols_, count, size_, column_count);
+                size_ = count;
+                return;
+            }
+            reserve(count);
+            size_type done = 0;
+            try
+            {
+                for_each_column([&](auto I)
+                {
+                    mystl::uninitialized_value_construct(std::get<I>(cols_) + size_, std::get<I>(cols_) + count);
+                    ++done;
+                });
+            }
+            catch (...)
+            {
+                destroy_columns(cols_, size_, count, done);
+                throw;
+            }
+            size_ = count;
+        }
+
+        void clear() noexcept
+        {
+            destroy_columns(cols_, 0, size_, column_count);
+            size_ = 0;
+        }
+
+        void swap(soa_vector& other) noexcept
+        {
+            mystl::swap(buffer_, other.buffer_);
+            mystl::swap(cols_, other.cols_);
+            mystl::swap(size_, other.size_);
+            mystl::swap(capacity_, other.capacity_);
+            mystl::swap(alloc_, other.alloc_);
+        }
+
+        // 按列比较
+        bool operator==(const soa_vector& other) const
+        {
+            if (size_ != other.size_) return false;
+            bool equal = true;
+            for_each_column([&](auto I)
+            {
+                equal = equal && mystl::equal(std::get<I>(cols_), std::get<I>(cols_) + size_, std::get<I>(other.cols_));
+            });
+            return equal;
+        }
+
+        bool operator!=(const soa_vector& other) const { return !(*this == other); }
+
+    private:
+        template<class F>
+        static void for_each_column(F&& f)
+        {
+            soa_detail::for_each_index(f, std::index_sequence_for<Fields...>{});
+        }
+
+        static size_type lines_for(size_type cap) noexcept
+        {
+            return (soa_detail::lines_for<Fields>(cap) + ...);
+        }
+
+        line* allocate(size_type cap)
+        {
+            return alloc_.allocate(lines_for(cap));
+        }
+
+        void deallocate(line* buffer, size_type cap) noexcept
+        {
+            if (buffer)
+            {
+                alloc_.deallocate(buffer, lines_for(cap));
+            }
+        }
+
+        // 在 buffer 中依次划分各列，每列从缓存行边界开始
+        static columns make_columns(line* buffer, size_type cap) noexcept
+        {
+            columns cols;
+            line* p = buffer;
+            for_each_column([&](auto I)
+            {
+                using T = field_type<I>;
+                std::get<I>(cols) = reinterpret_cast<T*>(p);
+                p += soa_detail::lines_for<T>(cap);
+            });
+            return cols;
+        }
+
+        // 销毁前 ncols 列中 [first, last) 行的元素
+        static void destroy_columns(const columns& cols, size_type first, size_type last, size_type ncols) noexcept
+        {
+            for_each_column([&](auto I)
+            {
+                if (I < ncols)
+                {
+                    mystl::destroy(std::get<I>(cols) + first, std::get<I>(cols) + last);
+                }
+            });
+        }
+
+        // 在第 pos 行逐列构造，失败时销毁该行已构造的列
+        template<size_t... Is, class... Args>
+        static void construct_row(const columns& cols, size_type pos, std::index_sequence<Is...>, Args&&... args)
+        {
+            size_type done = 0;
+            try
+            {
+                ((mystl::construct(std::get<Is>(cols) + pos, mystl::forward<Args>(args)), ++done), ...);
+            }
+            catch (...)
+            {
+                destroy_columns(cols, pos, pos + 1, done);
+                throw;
+            }
+        }
+
+        // 把各列的元素搬到 new_cols，成功后原空间中的对象已销毁
+        // 各列都可平凡重定位时逐列 memcpy；否则所有列统一决定移动还是复制，全部成功后才销毁原对象
+        // 只要有一列的移动可能抛异常就整体复制，否则先移动的列在后面的列失败时已无法恢复
+        // （存在只能移动且移动可能抛异常的列时退化为移动，与 move_if_noexcept 一样只保证基本异常安全）
+        static constexpr bool move_on_relocate =
+            (is_nothrow_move_constructible<Fields>::value && ...) || !(is_copy_constructible<Fields>::value && ...);
+
+        void relocate_to(const columns& new_cols)
+        {
+            if constexpr ((is_trivially_relocatable<Fields>::value && ...))
+            {
+                for_each_column([&](auto I)
+                {
+                    mystl::uninitialized_relocate(std::get<I>(cols_), std::get<I>(cols_) + size_, std::get<I>(new_cols));
+                });
+            }
+            else
+            {
+                size_type done = 0;
+                try
+                {
+                    for_each_column([&](auto I)
+                    {
+                        if constexpr (move_on_relocate)
+                        {
+                            mystl::uninitialized_move(std::get<I>(cols_), std::get<I>(cols_) + size_,
+                                                      std::get<I>(new_cols));
+                        }
+                        else
+                        {
+                            mystl::uninitialized_copy(std::get<I>(cols_), std::get<I>(cols_) + size_,
+                                                      std::get<I>(new_cols));
+                        }
+                        ++done;
+                    });
+                }
+                catch (...)
+                {
+                    destroy_columns(new_cols, 0, size_, done);
+                    throw;
+                }
+                destroy_columns(cols_, 0, size_, column_count);
+            }
+        }
+
+        // 扩容或缩容到 new_cap，失败时原数据不变
+        void reallocate(size_type new_cap)
+        {
+            line* new_buffer = allocate(new_cap);
+            columns new_cols = make_columns(new_buffer, new_cap);
+            try
+            {
+                relocate_to(new_cols);
+            }
+            catch (...)
+            {
+                deallocate(new_buffer, new_cap);
+                throw;
+            }
+            replace_storage(new_buffer, new_cols, new_cap);
+        }
+
+        void replace_storage(line* new_buffer, const columns& new_cols, size_type new_cap) noexcept
+        {
+            deallocate(buffer_, capacity_);
+            buffer_ = new_buffer;
+            cols_ = new_cols;
+            capacity_ = new_cap;
+        }
+    };
+
+    // soa_vector 只持有指向堆内存的指针
+    template<class... Fields>
+    struct is_trivially_relocatable<soa_vector<Fields...>> : true_type {};
+
+    template<class... Fields>
+    void swap(soa_vector<Fields...>& lhs, soa_vector<Fields...>& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+} // namespace mystl
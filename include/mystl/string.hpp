@@ -1,12 +1,16 @@
 #pragma once
 #include "allocator.hpp"
+#include "functional.hpp"
+#include "growth_policy.hpp"
 #include "iterator.hpp"
 #include <cstring>
 #include <stdexcept>
 
 namespace mystl 
 {
-    class string 
+    // GrowthPolicy 决定扩容后的容量，见 growth_policy.hpp；通常直接使用 string = basic_string<>
+    template<class GrowthPolicy = default_growth_policy>
+    class basic_string 
     {
     public:
         //------------------------------------------------------------------------------
@@ -33,13 +37,19 @@ namespace mystl
         size_type capacity_;  // 容量
         allocator_type alloc_;
 
+        // 按增长策略计算至少容纳 required 个字符的新容量（capacity() 的口径，不含结尾的 '\0'）
+        size_type next_capacity(size_type required) const noexcept
+        {
+            return GrowthPolicy::next_capacity(capacity_, required + 1, sizeof(value_type)) - 1;
+        }
+
     public:
         //------------------------------------------------------------------------------
         // 构造/析构函数
         //------------------------------------------------------------------------------
         
         // 默认构造函数
-        string() noexcept
+        basic_string() noexcept
             : data_(nullptr), size_(0), capacity_(0) 
         {
             data_ = alloc_.allocate(1);
@@ -48,7 +58,7 @@ namespace mystl
         }
 
         // 使用C风格字符串构造
-        string(const char* str)
+        basic_string(const char* str)
             : data_(nullptr), size_(0), capacity_(0)
         {
             size_ = strlen(str);
@@ -59,7 +69,7 @@ namespace mystl
         }
 
         // 使用C风格字符串的前count个字符构造
-        string(const char* str, size_type count)
+        basic_string(const char* str, size_type count)
             : data_(nullptr), size_(0), capacity_(0)
         {
             size_ = count;
@@ -70,7 +80,7 @@ namespace mystl
         }
 
         // 构造包含count个字符ch的字符串
-        string(size_type count, char ch)
+        basic_string(size_type count, char ch)
             : data_(nullptr), size_(0), capacity_(0)
         {
             size_ = count;
@@ -82,7 +92,7 @@ namespace mystl
 
         // 使用迭代器范围构造
         template <class InputIt>
-        string(InputIt first, InputIt last)
+        basic_string(InputIt first, InputIt last)
             : data_(nullptr), size_(0), capacity_(0)
         {
             size_ = mystl::distance(first, last);
@@ -94,7 +104,7 @@ namespace mystl
         }
 
         // 拷贝构造函数
-        string(const string& other)
+        basic_string(const basic_string& other)
             : data_(nullptr), size_(0), capacity_(0)
         {
             size_ = other.size_;
@@ -105,7 +115,7 @@ namespace mystl
         }
 
         // 移动构造函数
-        string(string&& other) noexcept
+        basic_string(basic_string&& other) noexcept
             : data_(other.data_), size_(other.size_), capacity_(other.capacity_)
         {
             other.data_ = nullptr;
@@ -114,7 +124,7 @@ namespace mystl
         }
 
         // 析构函数
-        ~string() 
+        ~basic_string() 
         {
             if (data_)
                 alloc_.deallocate(data_, capacity_);
@@ -124,7 +134,7 @@ namespace mystl
         // 赋值操作
         //------------------------------------------------------------------------------
         
-        string& operator=(const string& other) 
+        basic_string& operator=(const basic_string& other) 
         {
             if (this != &other) 
             {
@@ -141,7 +151,7 @@ namespace mystl
             return *this;
         }
 
-        string& operator=(string&& other) noexcept 
+        basic_string& operator=(basic_string&& other) noexcept 
         {
             if (this != &other) 
             {
@@ -156,7 +166,7 @@ namespace mystl
             return *this;
         }
 
-        string& operator=(const char* str)
+        basic_string& operator=(const char* str)
         {
             size_type len = strlen(str);
             if (capacity_ < len + 1) 
@@ -171,7 +181,7 @@ namespace mystl
             return *this;
         }
 
-        string& operator=(char ch)
+        basic_string& operator=(char ch)
         {
             if (capacity_ < 2) 
             {
@@ -185,17 +195,17 @@ namespace mystl
             return *this;
         }
 
-        string& assign(const string& str)
+        basic_string& assign(const basic_string& str)
         {
             return *this = str;
         }
 
-        string& assign(const char* str)
+        basic_string& assign(const char* str)
         {
             return *this = str;
         }
 
-        string& assign(const char* str, size_type count)
+        basic_string& assign(const char* str, size_type count)
         {
             if (capacity_ <= count)
             {
@@ -209,7 +219,7 @@ namespace mystl
             return *this;
         }
 
-        string& assign(size_type count, char ch)
+        basic_string& assign(size_type count, char ch)
         {
             if (capacity_ <= count)
             {
@@ -311,23 +321,23 @@ namespace mystl
             data_[0] = '\0';
         }
 
-        string& insert(size_type pos, const string& str)
+        basic_string& insert(size_type pos, const basic_string& str)
         {
             return insert(pos, str.data_, str.size_);
         }
 
-        string& insert(size_type pos, const char* str)
+        basic_string& insert(size_type pos, const char* str)
         {
             return insert(pos, str, strlen(str));
         }
 
-        string& insert(size_type pos, const char* str, size_type count)
+        basic_string& insert(size_type pos, const char* str, size_type count)
         {
             if (pos > size_)
                 throw std::out_of_range("string::insert");
 
             if (size_ + count >= capacity_)
-                reserve((size_ + count) * 2);
+                reserve(next_capacity(size_ + count));
 
             memmove(data_ + pos + count, data_ + pos, size_ - pos);
             memcpy(data_ + pos, str, count);
@@ -336,7 +346,7 @@ namespace mystl
             return *this;
         }
 
-        string& erase(size_type pos = 0, size_type count = npos)
+        basic_string& erase(size_type pos = 0, size_type count = npos)
         {
             if (pos > size_)
                 throw std::out_of_range("string::erase");
@@ -353,7 +363,7 @@ namespace mystl
         void push_back(char ch) 
         {
             if (size_ + 1 >= capacity_)
-                reserve(capacity_ * 2);
+                reserve(next_capacity(size_ + 1));
             data_[size_++] = ch;
             data_[size_] = '\0';
         }
@@ -367,41 +377,41 @@ namespace mystl
             }
         }
 
-        string& append(const string& str)
+        basic_string& append(const basic_string& str)
         {
             return append(str.data_, str.size_);
         }
 
-        string& append(const char* str)
+        basic_string& append(const char* str)
         {
             return append(str, strlen(str));
         }
 
-        string& append(const char* str, size_type count)
+        basic_string& append(const char* str, size_type count)
         {
             if (size_ + count >= capacity_)
-                reserve((size_ + count) * 2);
+                reserve(next_capacity(size_ + count));
             memcpy(data_ + size_, str, count);
             size_ += count;
             data_[size_] = '\0';
             return *this;
         }
 
-        string& operator+=(const string& str) { return append(str); }
-        string& operator+=(const char* str) { return append(str); }
-        string& operator+=(char ch) { push_back(ch); return *this; }
+        basic_string& operator+=(const basic_string& str) { return append(str); }
+        basic_string& operator+=(const char* str) { return append(str); }
+        basic_string& operator+=(char ch) { push_back(ch); return *this; }
 
-        string& replace(size_type pos, size_type count, const string& str)
+        basic_string& replace(size_type pos, size_type count, const basic_string& str)
         {
             return replace(pos, count, str.data_, str.size_);
         }
 
-        string& replace(size_type pos, size_type count, const char* str)
+        basic_string& replace(size_type pos, size_type count, const char* str)
         {
             return replace(pos, count, str, strlen(str));
         }
 
-        string& replace(size_type pos, size_type count, const char* str, size_type count2)
+        basic_string& replace(size_type pos, size_type count, const char* str, size_type count2)
         {
             if (pos > size_)
                 throw std::out_of_range("string::replace");
@@ -410,7 +420,7 @@ namespace mystl
             size_type new_size = size_ - count + count2;
 
             if (new_size > capacity_ - 1)
-                reserve(new_size * 2);
+                reserve(next_capacity(new_size));
 
             if (count != count2)
                 memmove(data_ + pos + count2, data_ + pos + count, size_ - pos - count);
@@ -421,7 +431,7 @@ namespace mystl
             return *this;
         }
 
-        void swap(string& other) noexcept
+        void swap(basic_string& other) noexcept
         {
             mystl::swap(data_, other.data_);
             mystl::swap(size_, other.size_);
@@ -432,7 +442,7 @@ namespace mystl
         // 字符串操作
         //------------------------------------------------------------------------------
         
-        size_type find(const string& str, size_type pos = 0) const noexcept
+        size_type find(const basic_string& str, size_type pos = 0) const noexcept
         {
             return find(str.data_, pos, str.size_);
         }
@@ -468,7 +478,7 @@ namespace mystl
             return npos;
         }
 
-        size_type rfind(const string& str, size_type pos = npos) const noexcept
+        size_type rfind(const basic_string& str, size_type pos = npos) const noexcept
         {
             return rfind(str.data_, pos, str.size_);
         }
@@ -510,7 +520,7 @@ namespace mystl
             return npos;
         }
 
-        size_type find_first_of(const string& str, size_type pos = 0) const noexcept
+        size_type find_first_of(const basic_string& str, size_type pos = 0) const noexcept
         {
             return find_first_of(str.data_, pos, str.size_);
         }
@@ -530,7 +540,7 @@ namespace mystl
             return npos;
         }
 
-        size_type find_last_of(const string& str, size_type pos = npos) const noexcept
+        size_type find_last_of(const basic_string& str, size_type pos = npos) const noexcept
         {
             return find_last_of(str.data_, pos, str.size_);
         }
@@ -555,7 +565,7 @@ namespace mystl
             return npos;
         }
 
-        size_type find_first_not_of(const string& str, size_type pos = 0) const noexcept
+        size_type find_first_not_of(const basic_string& str, size_type pos = 0) const noexcept
         {
             return find_first_not_of(str.data_, pos, str.size_);
         }
@@ -575,7 +585,7 @@ namespace mystl
             return npos;
         }
 
-        size_type find_last_not_of(const string& str, size_type pos = npos) const noexcept
+        size_type find_last_not_of(const basic_string& str, size_type pos = npos) const noexcept
         {
             return find_last_not_of(str.data_, pos, str.size_);
         }
@@ -600,7 +610,7 @@ namespace mystl
             return npos;
         }
 
-        string substr(size_type pos = 0, size_type count = npos) const
+        basic_string substr(size_type pos = 0, size_type count = npos) const
         {
             if (pos > size_)
                 throw std::out_of_range("string::substr");
@@ -608,14 +618,14 @@ namespace mystl
             if (count == npos || pos + count > size_)
                 count = size_ - pos;
 
-            return string(data_ + pos, count);
+            return basic_string(data_ + pos, count);
         }
 
         //------------------------------------------------------------------------------
         // 比较操作
         //------------------------------------------------------------------------------
         
-        int compare(const string& str) const noexcept
+        int compare(const basic_string& str) const noexcept
         {
             return compare(str.data_);
         }
@@ -625,75 +635,85 @@ namespace mystl
             return strcmp(data_, str);
         }
 
-        bool operator==(const string& rhs) const noexcept 
+        bool operator==(const basic_string& rhs) const noexcept 
         {
             return size_ == rhs.size_ && memcmp(data_, rhs.data_, size_) == 0;
         }
 
-        bool operator!=(const string& rhs) const noexcept
+        bool operator!=(const basic_string& rhs) const noexcept
         {
             return !(*this == rhs);
         }
 
-        bool operator<(const string& rhs) const noexcept 
+        bool operator<(const basic_string& rhs) const noexcept 
         {
             return strcmp(data_, rhs.data_) < 0;
         }
 
-        bool operator<=(const string& rhs) const noexcept
+        bool operator<=(const basic_string& rhs) const noexcept
         {
             return !(rhs < *this);
         }
 
-        bool operator>(const string& rhs) const noexcept
+        bool operator>(const basic_string& rhs) const noexcept
         {
             return rhs < *this;
         }
 
-        bool operator>=(const string& rhs) const noexcept
+        bool operator>=(const basic_string& rhs) const noexcept
         {
             return !(*this < rhs);
         }
     };
 
+    // string 没有内部缓冲区，只持有指向堆内存的指针，可以按字节搬迁
+    template<class GrowthPolicy>
+    struct is_trivially_relocatable<basic_string<GrowthPolicy>> : true_type {};
+
+    using string = basic_string<>;
+
     //------------------------------------------------------------------------------
     // 非成员函数
     //------------------------------------------------------------------------------
     
-    inline string operator+(const string& lhs, const string& rhs)
+    template<class G>
+    basic_string<G> operator+(const basic_string<G>& lhs, const basic_string<G>& rhs)
     {
-        string result(lhs);
+        basic_string<G> result(lhs);
         result += rhs;
         return result;
     }
 
-    inline string operator+(const string& lhs, const char* rhs)
+    template<class G>
+    basic_string<G> operator+(const basic_string<G>& lhs, const char* rhs)
     {
-        string result(lhs);
+        basic_string<G> result(lhs);
         result += rhs;
         return result;
     }
 
-    inline string operator+(const char* lhs, const string& rhs)
+    template<class G>
+    basic_string<G> operator+(const char* lhs, const basic_string<G>& rhs)
     {
-        string result(lhs);
+        basic_string<G> result(lhs);
         result += rhs;
         return result;
     }
 
-    template<>
-    struct hash<string> 
+    template<class G>
+    struct hash<basic_string<G>> 
     {
-        size_t operator()(const string& str) const noexcept 
+        size_t operator()(const basic_string<G>& str) const noexcept 
         {
-            size_t hash = 5381;
-            for (auto c : str)
-                hash = ((hash << 5) + hash) + c;
-            return hash;
+            return hash_bytes(str.data(), str.size());
         }
     };
 
-    inline void swap(string& lhs, string& rhs) noexcept
+    template<class G>
+    struct is_avalanching<hash<basic_string<G>>> : mystl::true_type {};
+
+    template<class G>
+    void swap(basic_string<G>& lhs, basic_string<G>& rhs) noexcept
     {
         lhs.swap(rhs);
     }
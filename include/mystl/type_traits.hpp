@@ -54,11 +54,36 @@ namespace mystl
     template<class T>
     inline constexpr bool is_integral_v = std::is_integral_v<T>;
 
+    template<class T>
+    using is_floating_point = std::is_floating_point<T>;   // 判断是否为浮点类型
+    template<class T>
+    inline constexpr bool is_floating_point_v = std::is_floating_point_v<T>;
+
+    template<class T>
+    using is_arithmetic = std::is_arithmetic<T>;           // 判断是否为算术类型（整数或浮点）
+    template<class T>
+    inline constexpr bool is_arithmetic_v = std::is_arithmetic_v<T>;
+
     template<class T>
     using is_pointer = std::is_pointer<T>;                 // 判断是否为指针类型
     template<class T>
     inline constexpr bool is_pointer_v = std::is_pointer_v<T>;
 
+    template<class T>
+    using is_trivially_copyable = std::is_trivially_copyable<T>;             // 判断是否可平凡复制（可以用 memcpy 复制）
+    template<class T>
+    inline constexpr bool is_trivially_copyable_v = std::is_trivially_copyable_v<T>;
+
+    template<class T>
+    using is_copy_constructible = std::is_copy_constructible<T>;             // 判断是否可拷贝构造
+    template<class T>
+    inline constexpr bool is_copy_constructible_v = std::is_copy_constructible_v<T>;
+
+    template<class T>
+    using is_trivially_default_constructible = std::is_trivially_default_constructible<T>;   // 判断是否可平凡默认构造
+    template<class T>
+    inline constexpr bool is_trivially_default_constructible_v = std::is_trivially_default_constructible_v<T>;
+
     template<class T>
     using is_trivially_destructible = std::is_trivially_destructible<T>;     // 判断是否可平凡析构
     template<class T>
@@ -100,6 +125,11 @@ namespace mystl
     template<bool B, class T = void>
     using enable_if_t = typename enable_if<B, T>::type;
 
+    template<bool B, class T, class F>
+    using conditional = std::conditional<B, T, F>;         // 按条件选择类型
+    template<bool B, class T, class F>
+    using conditional_t = typename conditional<B, T, F>::type;
+
     // mystl特有的类型特征
     // 判断是否为字节类型（用于特化字节相关的算法）
     template<typename T>
@@ -121,4 +151,13 @@ namespace mystl
 
     template<typename T>
     inline constexpr bool is_dereferenceable_v = is_dereferenceable<T>::value;
+
+    // 判断是否可平凡重定位：把对象按字节搬到新地址、且不再对原对象调用析构函数，效果与移动构造后析构相同
+    // 默认只包括可平凡复制的类型；不持有指向自身（或自身成员）指针的类型可以特化为 true_type 选择加入，
+    // 如 mystl::string、mystl::vector。容器扩容时对这类元素直接 memcpy
+    template<typename T>
+    struct is_trivially_relocatable : bool_constant<is_trivially_copyable<T>::value> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
 } // namespace mystl 
\ No newline at end of file
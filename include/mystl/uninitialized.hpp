@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>  // for memcpy
 #include "type_traits.hpp"
 #include "algorithm_base.hpp"
 #include "memory.hpp"
@@ -44,7 +45,7 @@ namespace mystl
     ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) 
     {
         using Value = typename iterator_traits<ForwardIt>::value_type;
-        return uninitialized_copy_aux(first, last, d_first, is_trivially_copy_assignable<Value>{});
+        return uninitialized_copy_aux(first, last, d_first, is_trivially_copyable<Value>{});
     }
 
 
@@ -55,11 +56,20 @@ namespace mystl
     template <class BidirIt1, class BidirIt2>
     BidirIt2 uninitialized_copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
     {
-        using Distance = typename iterator_traits<BidirIt1>::difference_type;
-        Distance n = mystl::distance(first, last);
-        BidirIt2 d_first = d_last - n;
-        mystl::uninitialized_copy(first, last, d_first);
-        return d_first;
+        using Value = typename iterator_traits<BidirIt2>::value_type;
+        if constexpr (is_trivially_copyable_v<Value>)
+        {
+            // 可平凡复制类型直接使用 copy_backward（分块迭代器逐块 memmove）
+            return mystl::copy_backward(first, last, d_last);
+        }
+        else
+        {
+            using Distance = typename iterator_traits<BidirIt1>::difference_type;
+            Distance n = mystl::distance(first, last);
+            BidirIt2 d_first = d_last - n;
+            mystl::uninitialized_copy(first, last, d_first);
+            return d_first;
+        }
     }
 
 
@@ -99,7 +109,7 @@ namespace mystl
     ForwardIt uninitialized_copy_n(InputIt first, Size n, ForwardIt d_first) 
     {
         using Value = typename iterator_traits<ForwardIt>::value_type;
-        return uninitialized_copy_n_aux(first, n, d_first, is_trivially_copy_assignable<Value>{});
+        return uninitialized_copy_n_aux(first, n, d_first, is_trivially_copyable<Value>{});
     }
 
 
@@ -154,22 +164,36 @@ namespace mystl
     ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first) 
     {
         using Value = typename iterator_traits<ForwardIt>::value_type;
-        return uninitialized_move_aux(first, last, d_first, is_trivially_move_assignable<Value>{});
+        return uninitialized_move_aux(first, last, d_first, is_trivially_copyable<Value>{});
     }
 
 
     /*****************************************************************************************/
     // uninitialized_move_backward
-    // 在未初始化内存空间上从后往前移动一个序列
+    // 在未初始化内存空间上从后往前移动一个序列，目标区间可以与源区间的后部重叠（整体右移）
     /*****************************************************************************************/
     template <class BidirIt1, class BidirIt2>
     BidirIt2 uninitialized_move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
     {
-        using Distance = typename iterator_traits<BidirIt1>::difference_type;
-        Distance n = mystl::distance(first, last);
-        BidirIt2 d_first = d_last - n;
-        mystl::uninitialized_move(first, last, d_first);
-        return d_first;
+        using Value = typename iterator_traits<BidirIt2>::value_type;
+        if constexpr (is_trivially_copyable_v<Value>)
+        {
+            return mystl::move_backward(first, last, d_last);
+        }
+        BidirIt2 current = d_last;
+        try 
+        {
+            while (first != last)
+            {
+                mystl::construct(mystl::addressof(*--current), mystl::move(*--last));
+            }
+        }
+        catch (...) 
+        {
+            mystl::destroy(current, d_last);
+            throw;
+        }
+        return current;
     }
 
 
@@ -209,7 +233,7 @@ namespace mystl
     ForwardIt uninitialized_move_n(InputIt first, Size n, ForwardIt d_first) 
     {
         using Value = typename iterator_traits<ForwardIt>::value_type;
-        return uninitialized_move_n_aux(first, n, d_first, is_trivially_move_assignable<Value>{});
+        return uninitialized_move_n_aux(first, n, d_first, is_trivially_copyable<Value>{});
     }
 
 
@@ -227,15 +251,67 @@ namespace mystl
 
 
 
+    /*****************************************************************************************/
+    // uninitialized_move_if_noexcept
+    // 移动构造不抛异常时移动，否则复制；源序列保持不变（复制时）或处于移出状态（移动时）
+    // 中途抛出异常时已构造的元素被销毁，复制路径下源序列不受影响
+    /*****************************************************************************************/
+    template<class InputIt, class ForwardIt>
+    ForwardIt uninitialized_move_if_noexcept(InputIt first, InputIt last, ForwardIt d_first) 
+    {
+        ForwardIt current = d_first;
+        try 
+        {
+            for (; first != last; ++first, ++current)
+            {
+                mystl::construct(mystl::addressof(*current), mystl::move_if_noexcept(*first));
+            }
+            return current;
+        }
+        catch (...) 
+        {
+            mystl::destroy(d_first, current);
+            throw;
+        }
+    }
+
+
+
+    /*****************************************************************************************/
+    // uninitialized_relocate
+    // 把 [first, last) 中的对象搬到未初始化的 d_first 处，成功后源序列中的对象已被销毁
+    // 可平凡重定位的类型直接 memcpy；其余类型用 move_if_noexcept 构造后销毁源对象，
+    // 复制路径下抛出异常时源序列保持不变（强异常保证）
+    /*****************************************************************************************/
+    template<class T>
+    T* uninitialized_relocate(T* first, T* last, T* d_first) 
+    {
+        if constexpr (is_trivially_relocatable<T>::value)
+        {
+            if (first != last)
+                std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(first),
+                            static_cast<size_t>(last - first) * sizeof(T));
+            return d_first + (last - first);
+        }
+        else
+        {
+            T* result = mystl::uninitialized_move_if_noexcept(first, last, d_first);
+            mystl::destroy(first, last);
+            return result;
+        }
+    }
+
+
+
     /*****************************************************************************************/
     // uninitialized_fill
     // 在未初始化内存空间上填充元素
     /*****************************************************************************************/
-    // 对单字节类型的特化版本
+    // 对单字节类型且迭代器连续时的特化版本
     template<class ForwardIt, class T>
     typename enable_if<
         is_byte_type<typename iterator_traits<ForwardIt>::value_type>::value &&
-        is_byte_type<T>::value, void>::type
+        is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>, void>::type
     uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) 
     {
         std::memset(addressof(*first), static_cast<unsigned char>(value), last - first);
@@ -245,9 +321,16 @@ namespace mystl
     template<class ForwardIt, class T>
     typename enable_if<!
         (is_byte_type<typename iterator_traits<ForwardIt>::value_type>::value &&
-         is_byte_type<T>::value), void>::type
+         is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>), void>::type
     uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) 
     {
+        if constexpr (is_segmented_iterator_v<ForwardIt> &&
+                      is_trivially_copyable_v<typename iterator_traits<ForwardIt>::value_type>)
+        {
+            // 可平凡复制类型的分块区间交给 fill 逐块填充
+            mystl::fill(first, last, value);
+            return;
+        }
         ForwardIt current = first;
         try 
         {
@@ -283,11 +366,11 @@ namespace mystl
     // uninitialized_fill_n
     // 在未初始化内存空间上填充 n 个元素
     /*****************************************************************************************/
-    // 对单字节类型的特化版本
+    // 对单字节类型且迭代器连续时的特化版本
     template<class ForwardIt, class Size, class T>
     typename enable_if<
         is_byte_type<typename iterator_traits<ForwardIt>::value_type>::value &&
-        is_byte_type<T>::value, ForwardIt>::type
+        is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>, ForwardIt>::type
     uninitialized_fill_n(ForwardIt first, Size n, const T& value) 
     {
         std::memset(addressof(*first), static_cast<unsigned char>(value), n);
@@ -298,9 +381,14 @@ namespace mystl
     template<class ForwardIt, class Size, class T>
     typename enable_if<!
         (is_byte_type<typename iterator_traits<ForwardIt>::value_type>::value &&
-         is_byte_type<T>::value), ForwardIt>::type
+         is_byte_type<T>::value && is_contiguous_iterator_v<ForwardIt>), ForwardIt>::type
     uninitialized_fill_n(ForwardIt first, Size n, const T& value) 
     {
+        if constexpr (is_segmented_iterator_v<ForwardIt> &&
+                      is_trivially_copyable_v<typename iterator_traits<ForwardIt>::value_type>)
+        {
+            return mystl::fill_n(first, n, value);
+        }
         ForwardIt current = first;
         try 
         {
@@ -334,24 +422,27 @@ namespace mystl
 
     /*****************************************************************************************/
     // uninitialized_default_construct
-    // 在未初始化内存空间上默认构造元素
+    // 在未初始化内存空间上默认初始化元素，可平凡默认构造的类型不写内存，内容不确定
     /*****************************************************************************************/
     template<class ForwardIt>
     void uninitialized_default_construct(ForwardIt first, ForwardIt last) 
     {
         using T = typename iterator_traits<ForwardIt>::value_type;
-        ForwardIt current = first;
-        try 
+        if constexpr (!is_trivially_default_constructible<T>::value)
         {
-            for (; current != last; ++current)
+            ForwardIt current = first;
+            try 
             {
-                mystl::construct(addressof(*current));
+                for (; current != last; ++current)
+                {
+                    mystl::construct(mystl::addressof(*current), default_init);
+                }
+            }
+            catch (...) 
+            {
+                mystl::destroy(first, current);
+                throw;
             }
-        }
-        catch (...) 
-        {
-            mystl::destroy(first, current);
-            throw;
         }
     }
 
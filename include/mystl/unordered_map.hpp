@@ -8,14 +8,16 @@ namespace mystl
     template <class Key, class T,
             class HashFcn = mystl::hash<Key>,
             class EqualKey = mystl::equal_to<Key>,
-            class Alloc = mystl::allocator<mystl::pair<const Key, T>>>
+            class Alloc = mystl::allocator<mystl::pair<const Key, T>>,
+            class BucketPolicy = mystl::default_bucket_policy,
+            bool CacheHash = !mystl::is_fast_hash<HashFcn>::value>
     class unordered_map 
     {
     private:
         using ht = hashtable<mystl::pair<const Key, T>,
                             Key, HashFcn,
                             mystl::select1st<mystl::pair<const Key, T>>,
-                            EqualKey, Alloc>;
+                            EqualKey, Alloc, BucketPolicy, CacheHash>;
         ht rep;
 
     public:
@@ -33,6 +35,7 @@ namespace mystl
         using const_reference = typename ht::const_reference;
         using iterator = typename ht::iterator;
         using const_iterator = typename ht::const_iterator;
+        using allocator_type = typename ht::allocator_type;
 
         // 构造函数
         unordered_map() : rep(100, hasher(), key_equal()) {}
@@ -40,6 +43,17 @@ namespace mystl
         unordered_map(size_type n, const hasher& hf) : rep(n, hf, key_equal()) {}
         unordered_map(size_type n, const hasher& hf, const key_equal& eql)
             : rep(n, hf, eql) {}
+        unordered_map(size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc)
+            : rep(n, hf, eql, alloc) {}
+        explicit unordered_map(const allocator_type& alloc)
+            : rep(100, hasher(), key_equal(), alloc) {}
+        template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+        unordered_map(InputIt first, InputIt last, size_type n = 100, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(first, last); }
+
+        allocator_type get_allocator() const noexcept { return rep.get_allocator(); }
 
         // 迭代器相关
         iterator begin() { return rep.begin(); }
@@ -53,16 +67,29 @@ namespace mystl
         bool empty() const { return rep.empty(); }
         size_type size() const { return rep.size(); }
         size_type bucket_count() const { return rep.bucket_count(); }
+        float load_factor() const { return rep.load_factor(); }
+        float max_load_factor() const { return rep.max_load_factor(); }
+        void max_load_factor(float ml) { rep.max_load_factor(ml); }
+        void rehash(size_type n) { rep.rehash(n); }
+        void reserve(size_type n) { rep.reserve(n); }
 
         // 修改容器操作
         mystl::pair<iterator, bool> insert(const value_type& obj)
         { return rep.insert_unique(obj); }
 
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        { rep.insert_unique(first, last); }
+
         T& operator[](const key_type& key) 
         {
             return rep.insert_unique(value_type(key, T())).first->second;
         }
 
+        iterator erase(const_iterator pos) { return rep.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return rep.erase(first, last); }
+        size_type erase(const key_type& key) { return rep.erase(key); }
+
         void clear() { rep.clear(); }
 
         // 查找操作
@@ -7,11 +7,13 @@ namespace mystl
     template <class Value,
             class HashFcn = mystl::hash<Value>,
             class EqualKey = mystl::equal_to<Value>,
-            class Alloc = mystl::allocator<Value>>
+            class Alloc = mystl::allocator<Value>,
+            class BucketPolicy = mystl::default_bucket_policy,
+            bool CacheHash = !mystl::is_fast_hash<HashFcn>::value>
     class unordered_set 
     {
     private:
-        using ht = hashtable<Value, Value, HashFcn, mystl::identity<Value>, EqualKey, Alloc>;
+        using ht = hashtable<Value, Value, HashFcn, mystl::identity<Value>, EqualKey, Alloc, BucketPolicy, CacheHash>;
         ht rep;  // 底层哈希表
 
     public:
@@ -27,6 +29,7 @@ namespace mystl
         using const_reference = typename ht::const_reference;
         using iterator = typename ht::const_iterator;
         using const_iterator = typename ht::const_iterator;
+        using allocator_type = typename ht::allocator_type;
 
         // 构造函数
         unordered_set() : rep(100, hasher(), key_equal()) {}
@@ -34,6 +37,17 @@ namespace mystl
         unordered_set(size_type n, const hasher& hf) : rep(n, hf, key_equal()) {}
         unordered_set(size_type n, const hasher& hf, const key_equal& eql)
             : rep(n, hf, eql) {}
+        unordered_set(size_type n, const hasher& hf, const key_equal& eql, const allocator_type& alloc)
+            : rep(n, hf, eql, alloc) {}
+        explicit unordered_set(const allocator_type& alloc)
+            : rep(100, hasher(), key_equal(), alloc) {}
+        template <class InputIt, class = typename iterator_traits<InputIt>::iterator_category>
+        unordered_set(InputIt first, InputIt last, size_type n = 100, const hasher& hf = hasher(),
+                      const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type())
+            : rep(n, hf, eql, alloc)
+        { rep.insert_unique(first, last); }
+
+        allocator_type get_allocator() const noexcept { return rep.get_allocator(); }
 
         // 迭代器相关
         iterator begin() const { return rep.begin(); }
@@ -45,10 +59,26 @@ namespace mystl
         bool empty() const { return rep.empty(); }
         size_type size() const { return rep.size(); }
         size_type bucket_count() const { return rep.bucket_count(); }
+        float load_factor() const { return rep.load_factor(); }
+        float max_load_factor() const { return rep.max_load_factor(); }
+        void max_load_factor(float ml) { rep.max_load_factor(ml); }
+        void rehash(size_type n) { rep.rehash(n); }
+        void reserve(size_type n) { rep.reserve(n); }
 
         // 修改容器操作
         mystl::pair<iterator, bool> insert(const value_type& obj)
-        { return rep.insert_unique(obj); }
+        {
+            auto r = rep.insert_unique(obj);
+            return mystl::pair<iterator, bool>(r.first, r.second);
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        { rep.insert_unique(first, last); }
+
+        iterator erase(const_iterator pos) { return rep.erase(pos); }
+        iterator erase(const_iterator first, const_iterator last) { return rep.erase(first, last); }
+        size_type erase(const key_type& key) { return rep.erase(key); }
 
         void clear() { rep.clear(); }
 
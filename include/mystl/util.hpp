@@ -25,13 +25,24 @@ namespace mystl
         return static_cast<T&&>(arg);
     }
 
+    // move_if_noexcept
+    // 移动构造不抛异常（或者不可拷贝）时返回右值引用，否则返回常量左值引用，
+    // 用于在保持强异常保证的前提下尽量移动
+    template<class T>
+    constexpr typename conditional<!is_nothrow_move_constructible<T>::value && is_copy_constructible<T>::value,
+                                   const T&, T&&>::type
+    move_if_noexcept(T& arg) noexcept
+    {
+        return mystl::move(arg);
+    }
+
     // swap
     template<class T>
     constexpr void swap(T& a, T& b) noexcept(is_nothrow_move_constructible_v<T> && is_nothrow_move_assignable_v<T>)
     {
-        T temp = move(a);
-        a = move(b);
-        b = move(temp);
+        T temp = mystl::move(a);
+        a = mystl::move(b);
+        b = mystl::move(temp);
     }
 
     template<class ForwardIt1, class ForwardIt2>
@@ -65,6 +76,9 @@ namespace mystl
     template<class T1, class T2>
     struct pair 
     {
+        using first_type = T1;
+        using second_type = T2;
+
         T1 first;
         T2 second;
         
@@ -72,6 +86,25 @@ namespace mystl
         pair(const T1& x, const T2& y) : first(x), second(y) {}
     };
 
+    // 比较运算：相等比较使 pair 可以作为哈希容器的键，< 按字典序比较
+    template<class T1, class T2>
+    bool operator==(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
+    {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }
+
+    template<class T1, class T2>
+    bool operator!=(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class T1, class T2>
+    bool operator<(const pair<T1, T2>& lhs, const pair<T1, T2>& rhs)
+    {
+        return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+    }
+
     template<class T1, class T2>
     pair<T1, T2> make_pair(T1 first, T2 second) 
     {
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <initializer_list>
+#include <cstring>  // for memmove
 #include "expectdef.hpp"
 #include "uninitialized.hpp"
 #include "allocator.hpp"
 #include "algorithm.hpp"
+#include "growth_policy.hpp"
 
 namespace mystl 
 {
@@ -191,13 +193,18 @@ namespace mystl
         }
     };
 
+    // vector_iterator 指向连续存储，copy / move / fill 等可以整段 memmove
+    template <class T>
+    struct is_contiguous_iterator<vector_iterator<T>> : true_type {};
+
 
 
 
     /*****************************************************************************************/
     // vector 的实现
     /*****************************************************************************************/
-    template <class T, class Allocator = mystl::allocator<T>>
+    // GrowthPolicy 决定扩容后的容量，见 growth_policy.hpp
+    template <class T, class Allocator = mystl::allocator<T>, class GrowthPolicy = default_growth_policy>
     class vector 
     {
     public:
@@ -234,10 +241,14 @@ namespace mystl
         
         // 默认构造函数
         vector() noexcept : data_(nullptr), size_(0), capacity_(0) {}
+
+        // 使用指定的分配器构造空vector
+        explicit vector(const allocator_type& alloc) noexcept
+            : data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
         
         // 创建包含count个默认值的vector
-        explicit vector(size_type count)
-            : size_(count), capacity_(count)
+        explicit vector(size_type count, const allocator_type& alloc = allocator_type())
+            : size_(count), capacity_(count), alloc_(alloc)
         {
             data_ = alloc_.allocate(count);
             for (size_type i = 0; i < count; ++i)
@@ -246,9 +257,16 @@ namespace mystl
             }
         }
 
+        // 创建包含count个默认初始化元素的vector：平凡类型不清零，内容不确定，用于随后整体覆盖的缓冲区
+        vector(size_type count, default_init_t, const allocator_type& alloc = allocator_type())
+            : data_(nullptr), size_(0), capacity_(0), alloc_(alloc)
+        {
+            resize_default_init(count);
+        }
+
         // 创建包含count个值为value的vector
-        vector(size_type count, const T& value)
-            : size_(count), capacity_(count)
+        vector(size_type count, const T& value, const allocator_type& alloc = allocator_type())
+            : size_(count), capacity_(count), alloc_(alloc)
         {
             data_ = alloc_.allocate(count);
             for (size_type i = 0; i < count; ++i)
@@ -259,7 +277,8 @@ namespace mystl
 
         // 迭代器范围构造
         template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
-        vector(InputIt first, InputIt last) 
+        vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
         {
             const auto n = mystl::distance(first, last);
             data_ = alloc_.allocate(n);
@@ -269,8 +288,8 @@ namespace mystl
         }
 
         // 使用初始化列表创建vector
-        vector(std::initializer_list<T> init)
-            : size_(init.size()), capacity_(init.size())
+        vector(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+            : size_(init.size()), capacity_(init.size()), alloc_(alloc)
         {
             data_ = alloc_.allocate(capacity_);
             size_type i = 0;
@@ -282,7 +301,7 @@ namespace mystl
 
         // 创建vector的深拷贝
         vector(const vector& other) 
-            : size_(other.size_), capacity_(other.size_)
+            : size_(other.size_), capacity_(other.size_), alloc_(other.alloc_)
         {
             data_ = alloc_.allocate(capacity_);
             for (size_type i = 0; i < size_; ++i)
@@ -293,7 +312,7 @@ namespace mystl
 
         // 移动构造一个vector
         vector(vector&& other) noexcept
-            : data_(other.data_), size_(other.size_), capacity_(other.capacity_)
+            : data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc_(other.alloc_)
         {
             other.data_ = nullptr;
             other.size_ = 0;
@@ -408,54 +427,21 @@ namespace mystl
         void reserve(size_type new_cap)
         {
             if (new_cap <= capacity_) return;
-
-            pointer new_data = nullptr;
-            size_type i = 0;
-            try 
-            {
-                new_data = alloc_.allocate(new_cap);
-                // 先复制，如果复制成功再移动
-                for (; i < size_; ++i)
-                {
-                    mystl::construct(new_data + i, data_[i]);  // 使用复制而不是移动，保证原数据不变
-                }
-                
-                // 复制成功后，清理原内存
-                for (size_type j = 0; j < size_; ++j)
-                {
-                    mystl::destroy_at(data_ + j);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_cap;
-            }
-            catch (...) 
-            {
-                // 析构对象
-                for (size_type j = 0; j < i; ++j)
-                {
-                    mystl::destroy_at(new_data + j);
-                }
-                // 释放内存
-                if (new_data)   
-                {
-                    alloc_.deallocate(new_data, new_cap);
-                }
-                throw;  // 重新抛出异常
-            }
+            reallocate_insert(new_cap, size_, 0, [](pointer) {});
         }
 
         // 减少容器容量以适应其大小
         void shrink_to_fit()
         {
-            if (size_ < capacity_)
+            if (size_ == 0 && data_)
             {
-                vector temp(*this);
-                swap(temp);
+                alloc_.deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = 0;
+            }
+            else if (size_ < capacity_)
+            {
+                reallocate_insert(size_, size_, 0, [](pointer) {});
             }
         }
 
@@ -543,6 +529,28 @@ namespace mystl
 
 
 
+        // 调整容器大小，新元素默认初始化而非值初始化：平凡类型不写内存，内容不确定。
+        // 用于随后由 read、解码器等整体覆盖的字节缓冲区和数值数组，省去一遍清零
+        void resize_default_init(size_type count)
+        {
+            if (count > size_)
+            {
+                if (count > capacity_)
+                {
+                    reserve(count);
+                }
+                mystl::uninitialized_default_construct(data_ + size_, data_ + count);
+                size_ = count;
+            }
+            else
+            {
+                mystl::destroy(data_ + count, data_ + size_);
+                size_ = count;
+            }
+        }
+
+
+
         //------------------------------------------------------------------------------
         // 赋值操作
         //------------------------------------------------------------------------------
@@ -552,7 +560,7 @@ namespace mystl
         {
             if (this != &other)
             {
-                vector temp(other);
+                vector temp(other.begin(), other.end(), alloc_);  // 拷贝赋值保留自己的分配器
                 swap(temp);
             }
             return *this;
@@ -571,6 +579,7 @@ namespace mystl
                 data_ = other.data_;
                 size_ = other.size_;
                 capacity_ = other.capacity_;
+                alloc_ = other.alloc_;  // 内存随分配器一起转移
                 other.data_ = nullptr;
                 other.size_ = 0;
                 other.capacity_ = 0;
@@ -694,39 +703,8 @@ namespace mystl
             size_type offset = pos - cbegin();
             if (size_ == capacity_)
             {
-                size_type new_capacity = (capacity_ == 0) ? 1 : 2 * capacity_;
-                pointer new_data = nullptr;
-                try 
-                {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), begin() + offset, new_data);
-                    mystl::construct(new_data + offset, value);
-                    mystl::uninitialized_copy(begin() + offset, end(), new_data + offset + 1);
-                }
-                catch (...) 
-                {
-                    if (new_data)
-                    {
-                        for (size_type i = 0; i < offset; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
-                    }
-                    throw;
-                }
-                
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                size_type new_capacity = next_capacity(size_ + 1);
+                reallocate_insert(new_capacity, offset, 1, [&](pointer p) { mystl::construct(p, value); });
             }
             else 
             {
@@ -788,39 +766,8 @@ namespace mystl
             size_type offset = pos - cbegin();
             if (size_ == capacity_)
             {
-                size_type new_capacity = (capacity_ == 0) ? 1 : 2 * capacity_;
-                pointer new_data = nullptr;
-                try 
-                {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), begin() + offset, new_data);
-                    mystl::construct(new_data + offset, mystl::move(value));
-                    mystl::uninitialized_copy(begin() + offset, end(), new_data + offset + 1);
-                }
-                catch (...) 
-                {
-                    if (new_data)
-                    {
-                        for (size_type i = 0; i < offset; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
-                    }
-                    throw;
-                }
-                
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                size_type new_capacity = next_capacity(size_ + 1);
+                reallocate_insert(new_capacity, offset, 1, [&](pointer p) { mystl::construct(p, mystl::move(value)); });
             }
             else 
             {
@@ -872,39 +819,30 @@ namespace mystl
             size_type offset = pos - cbegin();
             if (size_ + count > capacity_)
             {
-                size_type new_capacity = mystl::max(2 * capacity_, size_ + count);
-                pointer new_data = nullptr;
+                size_type new_capacity = next_capacity(size_ + count);
+                reallocate_insert(new_capacity, offset, count, [&](pointer p) { mystl::uninitialized_fill_n(p, count, value); });
+            }
+            else if (size_ - offset < count)
+            {
+                // 插入点之后的元素不足 count 个：先在末尾构造多出的新值，
+                // 再把插入点之后的元素移到它们后面，最后覆盖原位置
+                const size_type extra = count - (size_ - offset);
+                value_type value_copy = value;  // value 可能引用容器中的元素
+                pointer old_finish = data_ + size_;
+                mystl::uninitialized_fill_n(old_finish, extra, value_copy);
                 try 
                 {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), begin() + offset, new_data);
-                    mystl::uninitialized_fill_n(new_data + offset, count, value);
-                    mystl::uninitialized_copy(begin() + offset, end(), new_data + offset + count);
+                    mystl::uninitialized_move(data_ + offset, old_finish, old_finish + extra);
                 }
                 catch (...) 
                 {
-                    if (new_data)
+                    for (size_type k = 0; k < extra; ++k)
                     {
-                        for (size_type i = 0; i < offset; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
+                        mystl::destroy_at(old_finish + k);
                     }
                     throw;
                 }
-                
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                mystl::fill(data_ + offset, old_finish, value_copy);
             }
             else 
             {
@@ -990,59 +928,71 @@ namespace mystl
         {
             size_type offset = pos - cbegin();
             size_type count = mystl::distance(first, last);
+            if (count == 0) return iterator(data_ + offset);
             
             // 检查是否是自引用
             bool is_self = false;
             const auto* ptr = data();
-            if constexpr (is_same_v<typename mystl::iterator_traits<InputIt>::iterator_category, random_access_iterator_tag>)
+            using source_value = remove_cv_t<typename mystl::iterator_traits<InputIt>::value_type>;
+            if constexpr (is_same_v<typename mystl::iterator_traits<InputIt>::iterator_category, random_access_iterator_tag> &&
+                          is_same_v<source_value, value_type>)
             {
                 const auto* first_ptr = &(*first);
                 const auto* last_ptr = &(*(last - 1));
                 is_self = (first_ptr >= ptr && first_ptr < ptr + size_) || (last_ptr >= ptr && last_ptr < ptr + size_);
+
+                // 可平凡复制的元素、容量足够时：整体 memmove 插入点之后的元素，再把区间整块复制进来
+                if constexpr (is_trivially_copyable<T>::value)
+                {
+                    if (!is_self && size_ + count <= capacity_)
+                    {
+                        pointer p = data_ + offset;
+                        if (offset != size_)
+                        {
+                            std::memmove(static_cast<void*>(p + count), static_cast<const void*>(p), (size_ - offset) * sizeof(T));
+                        }
+                        mystl::uninitialized_copy(first, last, p);
+                        size_ += count;
+                        return iterator(p);
+                    }
+                }
             }
             
             if (is_self)
             {
                 // 如果是自引用，先复制要插入的数据
-                vector tmp(first, last);
+                vector tmp(first, last, alloc_);
                 return insert(pos, tmp.begin(), tmp.end());
             }
             
             if (size_ + count > capacity_)
             {
-                size_type new_capacity = mystl::max(2 * capacity_, size_ + count);
-                pointer new_data = nullptr;
+                size_type new_capacity = next_capacity(size_ + count);
+                reallocate_insert(new_capacity, offset, count, [&](pointer p) { mystl::uninitialized_copy(first, last, p); });
+            }
+            else if (size_ - offset < count)
+            {
+                // 插入点之后的元素不足 count 个：超出部分的新元素直接构造在末尾，
+                // 再把插入点之后的元素移到它们后面，最后覆盖原位置
+                const size_type elems_after = size_ - offset;
+                const size_type extra = count - elems_after;
+                InputIt mid = first;
+                mystl::advance(mid, elems_after);
+                pointer old_finish = data_ + size_;
+                mystl::uninitialized_copy(mid, last, old_finish);
                 try 
                 {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), begin() + offset, new_data);
-                    mystl::uninitialized_copy(first, last, new_data + offset);
-                    mystl::uninitialized_copy(begin() + offset, end(), new_data + offset + count);
+                    mystl::uninitialized_move(data_ + offset, old_finish, old_finish + extra);
                 }
                 catch (...) 
                 {
-                    if (new_data)
+                    for (size_type k = 0; k < extra; ++k)
                     {
-                        for (size_type i = 0; i < offset; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
+                        mystl::destroy_at(old_finish + k);
                     }
                     throw;
                 }
-                
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                mystl::copy(first, mid, data_ + offset);
             }
             else 
             {
@@ -1135,48 +1085,8 @@ namespace mystl
             size_type offset = pos - cbegin();
             if (size_ == capacity_)
             {
-                size_type new_capacity = (capacity_ == 0) ? 1 : 2 * capacity_;
-                pointer new_data = nullptr;
-                try 
-                {
-                    // 1. 分配新内存
-                    new_data = alloc_.allocate(new_capacity);
-                    
-                    // 2. 复制前半部分
-                    mystl::uninitialized_copy(begin(), begin() + offset, new_data);
-                    
-                    // 3. 构造新元素
-                    mystl::construct(new_data + offset, mystl::forward<Args>(args)...);
-                    
-                    // 4. 复制后半部分
-                    mystl::uninitialized_copy(begin() + offset, end(), new_data + offset + 1);
-                }
-                catch (...) 
-                {
-                    // 清理已构造的元素
-                    if (new_data)
-                    {
-                        for (size_type i = 0; i < offset; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
-                    }
-                    throw;  // 重新抛出异常
-                }
-                
-                // 清理旧内存
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                size_type new_capacity = next_capacity(size_ + 1);
+                reallocate_insert(new_capacity, offset, 1, [&](pointer p) { mystl::construct(p, mystl::forward<Args>(args)...); });
             }
             else 
             {
@@ -1224,9 +1134,14 @@ namespace mystl
         {
             if (size_ == capacity_)
             {
-                reserve(capacity_ == 0 ? 1 : 2 * capacity_);
+                // 先在新空间构造，参数引用本容器中的元素时依然有效
+                reallocate_insert(next_capacity(size_ + 1), size_, 1,
+                                  [&](pointer p) { mystl::construct(p, mystl::forward<Args>(args)...); });
+            }
+            else
+            {
+                mystl::construct(data_ + size_, mystl::forward<Args>(args)...);
             }
-            mystl::construct(data_ + size_, mystl::forward<Args>(args)...);
             ++size_;
         }
 
@@ -1235,40 +1150,11 @@ namespace mystl
         {
             if (size_ == capacity_)
             {
-                size_type new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
-                pointer new_data = nullptr;
-                try 
-                {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), end(), new_data);
-                    mystl::construct(new_data + size_, value);
-                }
-                catch (...) 
-                {
-                    // 清理已构造的元素
-                    if (new_data)
-                    {
-                        for (size_type i = 0; i < size_; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
-                    }
-                    throw;  // 重新抛出异常
-                }
-                
-                // 清理旧内存
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                size_type new_capacity = next_capacity(size_ + 1);
+                if (try_reallocate(new_capacity, mystl::addressof(value)))
+                    mystl::construct(data_ + size_, value);
+                else
+                    reallocate_insert(new_capacity, size_, 1, [&](pointer p) { mystl::construct(p, value); });
             }
             else 
             {
@@ -1282,38 +1168,11 @@ namespace mystl
         {
             if (size_ == capacity_)
             {
-                size_type new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
-                pointer new_data = nullptr;
-                try 
-                {
-                    new_data = alloc_.allocate(new_capacity);
-                    mystl::uninitialized_copy(begin(), end(), new_data);
-                    mystl::construct(new_data + size_, mystl::move(value));
-                }
-                catch (...) 
-                {
-                    if (new_data)
-                    {
-                        for (size_type i = 0; i < size_; ++i)
-                        {
-                            mystl::destroy_at(new_data + i);
-                        }
-                        alloc_.deallocate(new_data, new_capacity);
-                    }
-                    throw;
-                }
-                
-                for (size_type i = 0; i < size_; ++i)
-                {
-                    mystl::destroy_at(data_ + i);
-                }
-                if (data_)
-                {
-                    alloc_.deallocate(data_, capacity_);
-                }
-                
-                data_ = new_data;
-                capacity_ = new_capacity;
+                size_type new_capacity = next_capacity(size_ + 1);
+                if (try_reallocate(new_capacity, mystl::addressof(value)))
+                    mystl::construct(data_ + size_, mystl::move(value));
+                else
+                    reallocate_insert(new_capacity, size_, 1, [&](pointer p) { mystl::construct(p, mystl::move(value)); });
             }
             else 
             {
@@ -1322,6 +1181,38 @@ namespace mystl
             ++size_;
         }
 
+        // 在末尾追加 n 个默认初始化的元素，返回指向第一个新元素的指针，由调用者直接写入。
+        // 与 resize_default_init 不同，容量不足时按倍数扩容，适合循环追加
+        pointer append_uninitialized(size_type n)
+        {
+            if (size_ + n > capacity_)
+            {
+                reserve(next_capacity(size_ + n));
+            }
+            pointer p = data_ + size_;
+            mystl::uninitialized_default_construct(p, p + n);
+            size_ += n;
+            return p;
+        }
+
+        // 在末尾追加区间 [first, last)：前向迭代器只扩容一次，否则逐个追加
+        template<class InputIt, typename = typename enable_if<!is_integral<InputIt>::value>::type>
+        void append_range(InputIt first, InputIt last)
+        {
+            using category = typename iterator_traits<InputIt>::iterator_category;
+            if constexpr (is_same_v<category, input_iterator_tag>)
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+            else
+            {
+                insert(cend(), first, last);
+            }
+        }
+
         // 删除最后一个元素
         void pop_back()
         {
@@ -1379,9 +1270,110 @@ namespace mystl
             mystl::swap(data_, other.data_);
             mystl::swap(size_, other.size_);
             mystl::swap(capacity_, other.capacity_);
-        }        
+            mystl::swap(alloc_, other.alloc_);
+        }
+
+        // 返回分配器的副本
+        allocator_type get_allocator() const noexcept { return alloc_; }
+
+    private:
+        // 按增长策略计算至少容纳 required 个元素的新容量
+        size_type next_capacity(size_type required) const noexcept
+        {
+            return GrowthPolicy::next_capacity(capacity_, required, sizeof(T));
+        }
+
+        // 扩容到 new_cap：先由 construct_new(p) 在新空间的 [offset, offset + count) 构造新元素
+        // （构造失败时由它自行清理），再把原有元素搬到新空间，offset 之后的元素后移 count 个位置。
+        // 新元素先于搬迁构造，参数引用本容器中的元素时依然有效；任一步失败时原数据不变
+        template<class ConstructNew>
+        void reallocate_insert(size_type new_cap, size_type offset, size_type count, ConstructNew construct_new)
+        {
+            if (count == 0 && try_reallocate(new_cap)) return;
+
+            pointer new_data = alloc_.allocate(new_cap);
+            try 
+            {
+                construct_new(new_data + offset);
+            }
+            catch (...) 
+            {
+                alloc_.deallocate(new_data, new_cap);
+                throw;
+            }
+
+            try 
+            {
+                relocate_to(new_data, offset, count);
+            }
+            catch (...) 
+            {
+                mystl::destroy(new_data + offset, new_data + offset + count);
+                alloc_.deallocate(new_data, new_cap);
+                throw;
+            }
+
+            if (data_)
+            {
+                alloc_.deallocate(data_, capacity_);
+            }
+            data_ = new_data;
+            capacity_ = new_cap;
+        }
+
+        // 可平凡重定位的元素由分配器的 reallocate 直接调整原空间的大小，大块经 realloc / mremap 原地扩展，
+        // 省去分配新空间和逐字节复制。分配器不提供该接口或不适用时返回 false，由调用者分配新空间；
+        // keep 指向本容器中的元素时同样返回 false，调整后原地址失效，参数必须先在新空间构造
+        bool try_reallocate(size_type new_cap, const T* keep = nullptr)
+        {
+            if constexpr (is_trivially_relocatable<T>::value && has_reallocate<Allocator>::value)
+            {
+                if (!data_ || (keep >= data_ && keep < data_ + size_)) return false;
+                pointer new_data = alloc_.reallocate(data_, capacity_, new_cap);
+                if (!new_data) return false;
+                data_ = new_data;
+                capacity_ = new_cap;
+                return true;
+            }
+            else
+            {
+                (void)new_cap;
+                (void)keep;
+                return false;
+            }
+        }
+
+        // 把原有元素搬到 new_data，offset 之后的元素后移 gap 个位置，成功后原空间中的对象已销毁
+        // 可平凡重定位的类型直接 memcpy；移动构造不抛异常时逐个移动；
+        // 否则逐个复制，全部成功后才销毁原对象，失败时原数据不变
+        void relocate_to(pointer new_data, size_type offset, size_type gap)
+        {
+            if constexpr (is_trivially_relocatable<T>::value)
+            {
+                mystl::uninitialized_relocate(data_, data_ + offset, new_data);
+                mystl::uninitialized_relocate(data_ + offset, data_ + size_, new_data + offset + gap);
+            }
+            else
+            {
+                mystl::uninitialized_move_if_noexcept(data_, data_ + offset, new_data);
+                try 
+                {
+                    mystl::uninitialized_move_if_noexcept(data_ + offset, data_ + size_, new_data + offset + gap);
+                }
+                catch (...) 
+                {
+                    mystl::destroy(new_data, new_data + offset);
+                    throw;
+                }
+                mystl::destroy(data_, data_ + size_);
+            }
+        }
     };
 
+    // vector 只持有指向堆内存的指针，分配器可平凡重定位时整个 vector 也可以
+    template<class T, class Alloc, class Growth>
+    struct is_trivially_relocatable<vector<T, Alloc, Growth>> : is_trivially_relocatable<Alloc> {};
+
 
 
     //------------------------------------------------------------------------------
@@ -1389,46 +1381,46 @@ namespace mystl
     //------------------------------------------------------------------------------
     
     // 判断两个vector是否相等
-    template<class T, class Alloc>
-    bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
     // 判断两个vector是否不相等
-    template<class T, class Alloc>
-    bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return !(lhs == rhs);
     }
 
-    template<class T, class Alloc>
-    bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template<class T, class Alloc>
-    bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return rhs < lhs;
     }
 
-    template<class T, class Alloc>
-    bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return !(rhs < lhs);
     }
 
-    template<class T, class Alloc>
-    bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs)
+    template<class T, class Alloc, class Growth>
+    bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs)
     {
         return !(lhs < rhs);
     }
 
     // 交换两个vector的内容
-    template<class T, class Alloc>
-    void swap(vector<T, Alloc>& lhs, vector<T, Alloc>& rhs) noexcept
+    template<class T, class Alloc, class Growth>
+    void swap(vector<T, Alloc, Growth>& lhs, vector<T, Alloc, Growth>& rhs) noexcept
     {
         lhs.swap(rhs);
     }
@@ -770,6 +770,34 @@ TEST(AlgorithmTest, SortingAlgorithms)
     EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
 }
 
+// 测试较大规模、含大量重复元素的数据，覆盖快速排序分区和堆调整
+TEST(AlgorithmTest, SortLargeInput) 
+{
+    mystl::vector<int> original;
+    unsigned state = 12345;
+    for (int i = 0; i < 1000; ++i) 
+    {
+        state = state * 1103515245u + 12345u;
+        original.push_back(static_cast<int>((state >> 16) % 100));
+    }
+    mystl::vector<int> v;
+
+    v = original;
+    mystl::sort(v.begin(), v.end());
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+
+    v = original;
+    mystl::quick_sort(v.begin(), v.end());
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+
+    for (int n = 2; n < 40; ++n) 
+    {
+        v.assign(original.begin(), original.begin() + n);
+        mystl::heap_sort(v.begin(), v.end());
+        EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+    }
+}
+
 // 测试排序算法的稳定性
 TEST(AlgorithmTest, SortStability) 
 {
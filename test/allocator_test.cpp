@@ -2,6 +2,10 @@
 #include "mystl/allocator.hpp"
 #include "mystl/construct.hpp"
 #include "mystl/vector.hpp"
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <thread>
 
 // 测试基本类型的分配和释放
 TEST(AllocatorTest, BasicTypes) 
@@ -217,4 +221,522 @@ TEST(AllocatorTest, DifferentTypes)
     int_alloc.deallocate(pi, 1);
     double_alloc.deallocate(pd, 1);
     char_alloc.deallocate(pc, 1);
-} 
\ No newline at end of file
+} 
+
+// 测试不同元素类型的分配器共享同一尺寸等级的空闲列表
+TEST(AllocatorTest, SharedSizeClasses) 
+{
+    mystl::allocator<int> int_alloc;
+    mystl::allocator<double> double_alloc;
+
+    // 4 个 int 与 2 个 double 对齐后属于同一尺寸等级
+    int* pi = int_alloc.allocate(4);
+    int_alloc.deallocate(pi, 4);
+    double* pd = double_alloc.allocate(2);
+    EXPECT_EQ(static_cast<void*>(pd), static_cast<void*>(pi));
+    double_alloc.deallocate(pd, 2);
+
+    // rebind 得到的分配器同样共享
+    using rebound = mystl::allocator<int>::rebind<long long>::other;
+    rebound ll_alloc;
+    long long* pl = ll_alloc.allocate(2);
+    EXPECT_EQ(static_cast<void*>(pl), static_cast<void*>(pi));
+    ll_alloc.deallocate(pl, 2);
+}
+
+// 测试内存池回收完全空闲的大块内存
+TEST(AllocatorTest, PoolReleaseUnused) 
+{
+    constexpr int kCount = 2000;
+    mystl::MemoryPool<int> pool;
+    int* ptrs[kCount];
+
+    for (int i = 0; i < kCount; ++i) ptrs[i] = pool.allocate(1);
+    size_t chunks = pool.chunk_count();
+    EXPECT_GT(chunks, 1u);
+
+    // 仍有存活块时，只有其所在的大块内存被保留
+    for (int i = 1; i < kCount; ++i) pool.deallocate(ptrs[i], 1);
+    EXPECT_EQ(pool.release_unused(), (chunks - 1) * mystl::MemoryPool<int>::BLOCK_SIZE);
+    EXPECT_EQ(pool.chunk_count(), 1u);
+
+    // 全部释放后所有大块内存都被归还
+    pool.deallocate(ptrs[0], 1);
+    EXPECT_EQ(pool.trim(), mystl::MemoryPool<int>::BLOCK_SIZE);
+    EXPECT_EQ(pool.chunk_count(), 0u);
+
+    // 回收后内存池仍然可用
+    int* p = pool.allocate(1);
+    *p = 42;
+    EXPECT_EQ(*p, 42);
+    pool.deallocate(p, 1);
+}
+
+// 测试高水位自动回收策略
+TEST(AllocatorTest, PoolAutoTrim) 
+{
+    constexpr int kCount = 4000;
+    mystl::MemoryPool<int> pool;
+    pool.set_trim_threshold(4 * mystl::MemoryPool<int>::BLOCK_SIZE);
+
+    int* ptrs[kCount];
+    for (int i = 0; i < kCount; ++i) ptrs[i] = pool.allocate(1);
+    size_t chunks = pool.chunk_count();
+    for (int i = 0; i < kCount; ++i) pool.deallocate(ptrs[i], 1);
+
+    // 释放过程中自动回收了大部分大块内存
+    EXPECT_LT(pool.chunk_count(), chunks / 2);
+}
+
+// 测试大块内存的几何增长，以及大小不一的大块内存的回收
+TEST(AllocatorTest, PoolChunkGrowth)
+{
+    constexpr int kCount = 20000;
+    constexpr size_t kBlock = mystl::MemoryPool<int>::BLOCK_SIZE;
+    mystl::MemoryPool<int> pool;
+    pool.set_chunk_growth(2, 16 * kBlock);
+
+    static int* ptrs[kCount];
+    for (int i = 0; i < kCount; ++i) ptrs[i] = pool.allocate(1);
+    for (int i = 0; i < kCount; ++i) *ptrs[i] = i;
+
+    // 块大小依次为 1、2、4、8、16、16... 个 BLOCK_SIZE
+    mystl::MemoryPool<int> fixed;
+    for (int i = 0; i < kCount; ++i) fixed.allocate(1);
+    EXPECT_LT(pool.chunk_count(), fixed.chunk_count() / 4);
+    size_t reserved = pool.bytes_reserved();
+    EXPECT_EQ(reserved % kBlock, 0u);
+    EXPECT_EQ(pool.stats().bytes_reserved, reserved);
+
+    for (int i = 0; i < kCount; ++i) EXPECT_EQ(*ptrs[i], i);
+
+    // 只保留第一个块中的一个节点，其余大块内存全部归还
+    for (int i = 1; i < kCount; ++i) pool.deallocate(ptrs[i], 1);
+    EXPECT_EQ(pool.release_unused(), reserved - kBlock);
+    EXPECT_EQ(pool.chunk_count(), 1u);
+    pool.deallocate(ptrs[0], 1);
+    EXPECT_EQ(pool.release_unused(), kBlock);
+
+    // factor 为 1 时恢复固定大小
+    pool.set_chunk_growth(1, 0);
+    int* p = pool.allocate(1);
+    EXPECT_EQ(pool.bytes_reserved(), kBlock);
+    pool.deallocate(p, 1);
+}
+
+// 测试大页模式：块按 HUGE_PAGE_SIZE 取整，非 Linux 平台退回 malloc 时仍然可用
+TEST(AllocatorTest, PoolHugePages)
+{
+    constexpr int kCount = 10000;
+    mystl::MemoryPool<long> pool;
+    pool.set_huge_pages(true);
+
+    static long* ptrs[kCount];
+    for (int i = 0; i < kCount; ++i)
+    {
+        ptrs[i] = pool.allocate(1);
+        *ptrs[i] = i;
+    }
+    for (int i = 0; i < kCount; ++i) EXPECT_EQ(*ptrs[i], i);
+#if defined(__linux__)
+    EXPECT_EQ(pool.chunk_count(), 1u);
+    EXPECT_EQ(pool.bytes_reserved() + mystl::MemoryPool<long>::CHUNK_HEADER, mystl::HUGE_PAGE_SIZE);
+#endif
+
+    size_t reserved = pool.bytes_reserved();
+    for (int i = 0; i < kCount; ++i) pool.deallocate(ptrs[i], 1);
+    EXPECT_EQ(pool.release_unused(), reserved);
+    EXPECT_EQ(pool.chunk_count(), 0u);
+}
+
+// 测试内存池的超对齐分配：缓存行尺寸等级与页对齐
+TEST(AllocatorTest, PoolOverAligned)
+{
+    using pool_type = mystl::MemoryPool<char>;
+    pool_type pool;
+    auto addr = [](void* p) { return reinterpret_cast<std::uintptr_t>(p); };
+
+    void* small = pool.allocate_bytes(16);  // 让切分位置偏离缓存行边界
+    void* lines[8];
+    for (auto& p : lines)
+    {
+        p = pool.allocate_bytes(pool_type::align_up(40), 64);
+        EXPECT_EQ(addr(p) % 64, 0u);
+    }
+    void* big = pool.allocate_bytes(1024, 128);
+    void* page = pool.allocate_bytes(32, pool_type::MAX_ALIGN);
+    EXPECT_EQ(addr(big) % 128, 0u);
+    EXPECT_EQ(addr(page) % pool_type::MAX_ALIGN, 0u);
+
+    // 释放后缓存行等级的块被复用，且仍然对齐
+    pool.deallocate_bytes(lines[3], pool_type::align_up(40), 64);
+    void* again = pool.allocate_bytes(64, 64);
+    EXPECT_EQ(again, lines[3]);
+
+    for (auto& p : lines)
+    {
+        if (p != lines[3]) pool.deallocate_bytes(p, pool_type::align_up(40), 64);
+    }
+    pool.deallocate_bytes(again, 64, 64);
+    pool.deallocate_bytes(big, 1024, 128);
+    pool.deallocate_bytes(page, 32, pool_type::MAX_ALIGN);
+    pool.deallocate_bytes(small, 16);
+
+    // 对齐填充也回到了空闲列表，大块内存可以完整回收
+    EXPECT_EQ(pool.release_unused(), pool_type::BLOCK_SIZE);
+    EXPECT_EQ(pool.chunk_count(), 0u);
+}
+
+// 测试 allocator 满足 alignof(T)，浮点数与宽整数的数组按缓存行对齐
+TEST(AllocatorTest, AllocatorOverAligned)
+{
+    struct alignas(64) padded { int value; };
+    auto addr = [](const void* p) { return reinterpret_cast<std::uintptr_t>(p); };
+
+    mystl::allocator<padded> alloc;
+    padded* ps[16];
+    for (auto& p : ps)
+    {
+        p = alloc.allocate(1);
+        EXPECT_EQ(addr(p) % 64, 0u);
+    }
+    for (auto& p : ps) alloc.deallocate(p, 1);
+
+    // 超过 MAX_BYTES 的超对齐数组
+    padded* arr = alloc.allocate(10);
+    EXPECT_EQ(addr(arr) % 64, 0u);
+    alloc.deallocate(arr, 10);
+
+    mystl::vector<padded> pv(5);
+    EXPECT_EQ(addr(pv.data()) % 64, 0u);
+
+    // vector<float> 的缓冲区按缓存行对齐，小缓冲区与大缓冲区都一样
+    for (size_t n : {16, 33, 100, 10000})
+    {
+        mystl::vector<float> v(n, 1.0f);
+        EXPECT_EQ(addr(v.data()) % 64, 0u);
+    }
+    mystl::vector<double> vd;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vd.push_back(i);
+        if (vd.size() * sizeof(double) >= 64)
+        {
+            EXPECT_EQ(addr(vd.data()) % 64, 0u);
+        }
+    }
+}
+
+#ifdef MYSTL_POOL_STATS
+// 测试内存池按尺寸等级的统计
+TEST(AllocatorTest, PoolStats) 
+{
+    mystl::MemoryPool<int> pool;
+    constexpr size_t kClass = mystl::MemoryPool<int>::ALIGN;
+
+    int* p1 = pool.allocate(1);   // 从新的大块内存切分
+    pool.deallocate(p1, 1);
+    int* p2 = pool.allocate(1);   // 命中空闲列表
+    int* big = pool.allocate(100);  // 超过 MAX_BYTES，走 malloc
+
+    auto stats = pool.stats();
+    const auto& c = stats.classes[0];
+    EXPECT_EQ(c.size, kClass);
+    EXPECT_EQ(c.allocations, 2u);
+    EXPECT_EQ(c.frees, 1u);
+    EXPECT_EQ(c.free_list_hits, 1u);
+    EXPECT_EQ(c.chunk_carves, 1u);
+    EXPECT_EQ(c.bytes_live, kClass);
+    EXPECT_EQ(c.bytes_reserved, kClass);
+    EXPECT_EQ(stats.large.malloc_fallbacks, 1u);
+    EXPECT_EQ(stats.large.bytes_live, mystl::MemoryPool<int>::align_up(100 * sizeof(int)));
+    EXPECT_EQ(stats.chunk_count, 1u);
+    EXPECT_EQ(stats.bytes_reserved, mystl::MemoryPool<int>::BLOCK_SIZE);
+
+    std::ostringstream json;
+    stats.dump_json(json);
+    EXPECT_NE(json.str().find("\"chunk_count\":1"), std::string::npos);
+
+    pool.deallocate(p2, 1);
+    pool.deallocate(big, 100);
+    EXPECT_EQ(pool.stats().classes[0].bytes_live, 0u);
+    EXPECT_EQ(pool.stats().large.bytes_live, 0u);
+}
+
+// 字节数组不按缓存行对齐：65 字节的 allocator<char> 请求落在 16 字节粒度的 80 字节等级，而不是 128 字节
+TEST(AllocatorTest, ByteArraysUseFineSizeClasses)
+{
+    auto class_bytes = [](size_t size)
+    {
+        auto stats = mystl::size_class_pool().stats();
+        for (const auto& c : stats.classes)
+        {
+            if (c.size == size) return c.bytes_live;
+        }
+        return size_t(0);
+    };
+    const size_t before80 = class_bytes(80);
+    const size_t before128 = class_bytes(128);
+
+    mystl::allocator<char> alloc;
+    char* p = alloc.allocate(65);
+    EXPECT_EQ(class_bytes(80), before80 + 80);
+    EXPECT_EQ(class_bytes(128), before128);
+    alloc.deallocate(p, 65);
+    EXPECT_EQ(class_bytes(80), before80);
+}
+
+// 测试按元素类型记录走 malloc 路径的分配
+TEST(AllocatorTest, AllocatorTypeStats) 
+{
+    struct LargeRecord { char data[512]; };
+    mystl::allocator<LargeRecord> alloc;
+    LargeRecord* p = alloc.allocate(1);
+
+    auto& s = mystl::allocator_stats_for<LargeRecord>();
+    EXPECT_EQ(s.type_size, sizeof(LargeRecord));
+    EXPECT_GE(s.large_allocations.load(), 1u);
+    EXPECT_GE(s.bytes_live.load(), sizeof(LargeRecord));
+
+    std::ostringstream text;
+    mystl::dump_allocator_stats_text(text);
+    EXPECT_NE(text.str().find("LargeRecord"), std::string::npos);
+
+    alloc.deallocate(p, 1);
+    EXPECT_EQ(s.bytes_live.load(), 0u);
+}
+#endif
+
+// 测试并发内存池：多个线程同时分配、写入、校验和释放
+TEST(AllocatorTest, ConcurrentPoolMultiThread) 
+{
+    using pool_type = mystl::ConcurrentMemoryPool<char>;
+    constexpr int kThreads = 4;
+    constexpr int kRounds = 50;
+    constexpr int kBlocks = 200;
+
+    bool ok[kThreads] = {};
+    std::thread workers[kThreads];
+    for (int t = 0; t < kThreads; ++t) 
+    {
+        workers[t] = std::thread([t, &ok]
+        {
+            pool_type& pool = pool_type::instance();
+            char* blocks[kBlocks];
+            bool good = true;
+            for (int round = 0; round < kRounds; ++round) 
+            {
+                for (int i = 0; i < kBlocks; ++i) 
+                {
+                    size_t n = 1 + (i * 7) % 300;  // 覆盖小对象和大对象两条路径
+                    blocks[i] = pool.allocate(n);
+                    std::memset(blocks[i], t + 1, n);
+                }
+                for (int i = 0; i < kBlocks; ++i) 
+                {
+                    size_t n = 1 + (i * 7) % 300;
+                    for (size_t k = 0; k < n; ++k) 
+                    {
+                        if (blocks[i][k] != static_cast<char>(t + 1)) good = false;
+                    }
+                    pool.deallocate(blocks[i], n);
+                }
+            }
+            ok[t] = good;
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    for (int t = 0; t < kThreads; ++t) 
+    {
+        EXPECT_TRUE(ok[t]);
+    }
+}
+
+// 测试并发内存池：在一个线程分配，在另一个线程释放
+TEST(AllocatorTest, ConcurrentPoolCrossThreadFree) 
+{
+    using pool_type = mystl::ConcurrentMemoryPool<int>;
+    constexpr int kCount = 1000;
+
+    int* ptrs[kCount];
+    std::thread producer([&ptrs]
+    {
+        for (int i = 0; i < kCount; ++i) 
+        {
+            ptrs[i] = pool_type::instance().allocate(1);
+            *ptrs[i] = i;
+        }
+    });
+    producer.join();
+
+    // 生产者线程已退出，其线程缓存已归还中心池，内存块仍然有效
+    for (int i = 0; i < kCount; ++i) 
+    {
+        EXPECT_EQ(*ptrs[i], i);
+        pool_type::instance().deallocate(ptrs[i], 1);
+    }
+
+    // 释放后的内存块可以被重新分配
+    int* p = pool_type::instance().allocate(1);
+    EXPECT_NE(p, nullptr);
+    pool_type::instance().deallocate(p, 1);
+}
+
+#ifdef MYSTL_CONCURRENT_POOL
+// 测试 allocator<T> 经由并发内存池分配：多个线程同时使用容器，元素在另一个线程中释放
+TEST(AllocatorTest, ConcurrentAllocatorContainers)
+{
+    static_assert(std::is_same<mystl::size_class_pool_type, mystl::ConcurrentMemoryPool<char>>::value, "");
+
+    constexpr int kThreads = 4;
+    mystl::vector<int> results[kThreads];
+    std::thread workers[kThreads];
+    for (int t = 0; t < kThreads; ++t)
+    {
+        workers[t] = std::thread([t, &results]
+        {
+            for (int round = 0; round < 50; ++round)
+            {
+                mystl::vector<mystl::vector<int>> rows;
+                for (int i = 0; i < 20; ++i) rows.push_back(mystl::vector<int>(static_cast<size_t>(i + 1), t));
+                mystl::vector<int> merged;
+                for (const auto& row : rows) merged.insert(merged.end(), row.begin(), row.end());
+                results[t] = mystl::move(merged);
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    // 缓冲区由工作线程分配，在主线程释放
+    for (int t = 0; t < kThreads; ++t)
+    {
+        EXPECT_EQ(results[t].size(), 210u);
+        EXPECT_EQ(results[t].front(), t);
+        EXPECT_EQ(results[t].back(), t);
+        results[t] = mystl::vector<int>();
+    }
+}
+#endif
+
+// 测试并发内存池的超对齐分配
+TEST(AllocatorTest, ConcurrentPoolOverAligned)
+{
+    struct alignas(64) line { char data[48]; };
+    using pool_type = mystl::ConcurrentMemoryPool<line>;
+
+    std::thread workers[2];
+    bool ok[2] = {};
+    for (int t = 0; t < 2; ++t)
+    {
+        workers[t] = std::thread([t, &ok]
+        {
+            bool good = true;
+            line* ptrs[100];
+            for (int i = 0; i < 100; ++i)
+            {
+                ptrs[i] = pool_type::instance().allocate(1 + i % 6);
+                if (reinterpret_cast<std::uintptr_t>(ptrs[i]) % 64 != 0) good = false;
+            }
+            for (int i = 0; i < 100; ++i) pool_type::instance().deallocate(ptrs[i], 1 + i % 6);
+            ok[t] = good;
+        });
+    }
+    for (auto& w : workers) w.join();
+    EXPECT_TRUE(ok[0]);
+    EXPECT_TRUE(ok[1]);
+}
+
+// 测试批量分配：从大块内存连续切分，释放后按原顺序复用
+TEST(AllocatorTest, PoolAllocateBatch)
+{
+    using pool_type = mystl::MemoryPool<char>;
+    pool_type pool;
+    char* ptrs[100];
+
+    pool.allocate_batch(32, ptrs, 100);
+    for (int i = 1; i < 100; ++i) EXPECT_EQ(ptrs[i], ptrs[i - 1] + 32);
+    for (int i = 0; i < 100; ++i) std::memset(ptrs[i], i, 32);
+    EXPECT_EQ(pool.chunk_count(), 1u);
+
+    // 跨越大块内存边界时分成多段切分
+    char* more[100];
+    pool.allocate_batch(32, more, 100);
+    EXPECT_EQ(pool.chunk_count(), 2u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(ptrs[i][31], static_cast<char>(i));
+
+    char* first = ptrs[0];
+    pool.deallocate_batch(32, ptrs, 100);
+    pool.allocate_batch(32, ptrs, 100);
+    EXPECT_EQ(ptrs[0], first);
+    EXPECT_EQ(ptrs[99], first + 99 * 32);
+
+    // 大对象逐个分配
+    void* large[4];
+    pool.allocate_batch(512, large, 4);
+    pool.deallocate_batch(512, large, 4);
+
+    pool.deallocate_batch(32, more, 100);
+    pool.deallocate_batch(32, ptrs, 100);
+    EXPECT_EQ(pool.release_unused(), 2 * pool_type::BLOCK_SIZE);
+}
+
+// 测试 allocator 的批量接口，以及节点容器使用的 allocate_nodes 分派
+TEST(AllocatorTest, AllocatorBatch)
+{
+    struct alignas(64) padded { int value; };
+    static_assert(mystl::has_allocate_batch<mystl::allocator<int>>::value, "");
+
+    mystl::allocator<long> alloc;
+    long* ptrs[70];
+    mystl::allocate_nodes(alloc, ptrs, 70);
+    for (int i = 0; i < 70; ++i) *ptrs[i] = i;
+    for (int i = 0; i < 70; ++i) EXPECT_EQ(*ptrs[i], i);
+    mystl::deallocate_nodes(alloc, ptrs, 70);
+
+    // 超对齐类型逐个分配，仍然满足对齐
+    mystl::allocator<padded> padded_alloc;
+    padded* lines[8];
+    padded_alloc.allocate_batch(lines, 8);
+    for (auto p : lines) EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+    padded_alloc.deallocate_batch(lines, 8);
+
+    // 并发内存池：先取本线程弹匣，其余一次加锁切分
+    using concurrent = mystl::ConcurrentMemoryPool<char>;
+    void* blocks[100];
+    concurrent::instance().allocate_batch(48, blocks, 100);
+    for (auto p : blocks) std::memset(p, 0x5a, 48);
+    concurrent::instance().deallocate_batch(48, blocks, 100);
+}
+
+// 测试大块原地调整大小：小块与超对齐类型不适用，大块保留原内容
+TEST(AllocatorTest, AllocatorReallocate)
+{
+    struct alignas(64) padded { int value; };
+    static_assert(mystl::has_reallocate<mystl::allocator<int>>::value, "");
+
+    mystl::allocator<int> alloc;
+    int* small = alloc.allocate(8);
+    EXPECT_EQ(alloc.reallocate(small, 8, 1000), nullptr);
+    alloc.deallocate(small, 8);
+
+    mystl::allocator<padded> padded_alloc;
+    padded* lines = padded_alloc.allocate(100);
+    EXPECT_EQ(padded_alloc.reallocate(lines, 100, 200), nullptr);
+    padded_alloc.deallocate(lines, 100);
+
+    // 从 mmap 的大块继续扩展，内容不变，缓存行对齐不变
+    size_t n = 100000;
+    int* p = alloc.allocate(n);
+    for (size_t i = 0; i < n; ++i) p[i] = static_cast<int>(i);
+    for (size_t m : {300000, 1000000, 500000})
+    {
+        p = alloc.reallocate(p, n, m);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+        for (size_t i = 0; i < mystl::min(n, m); i += 997) EXPECT_EQ(p[i], static_cast<int>(i));
+        for (size_t i = n; i < m; ++i) p[i] = static_cast<int>(i);
+        n = m;
+    }
+    alloc.deallocate(p, n);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "mystl/arena.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/list.hpp"
+#include "mystl/deque.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/hashtable.hpp"
+#include "mystl/functional.hpp"
+
+// 基本分配：对齐与连续前移
+TEST(ArenaTest, BumpAllocation)
+{
+    mystl::monotonic_arena arena(256);
+
+    char* a = static_cast<char*>(arena.allocate(1, 1));
+    char* b = static_cast<char*>(arena.allocate(1, 1));
+    EXPECT_EQ(b, a + 1);
+
+    void* c = arena.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 64, 0u);
+
+    // 超过当前缓冲区时申请新的缓冲区
+    void* big = arena.allocate(10000, 16);
+    EXPECT_NE(big, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 16, 0u);
+    EXPECT_GE(arena.bytes_reserved(), 10000u);
+}
+
+// 调用者提供的缓冲区优先使用
+TEST(ArenaTest, CallerBuffer)
+{
+    alignas(16) char buffer[128];
+    mystl::monotonic_arena arena(buffer, sizeof(buffer));
+
+    char* p = static_cast<char*>(arena.allocate(64, 16));
+    EXPECT_GE(p, buffer);
+    EXPECT_LT(p, buffer + sizeof(buffer));
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+
+    // 放不下时转向堆
+    char* q = static_cast<char*>(arena.allocate(128, 16));
+    EXPECT_TRUE(q < buffer || q >= buffer + sizeof(buffer));
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+
+    // release 之后重新从调用者的缓冲区开始
+    arena.release();
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+    EXPECT_EQ(arena.allocate(1, 1), buffer);
+}
+
+// reset 保留最大的缓冲区，下一轮不再向系统申请
+TEST(ArenaTest, ResetReusesLargestBuffer)
+{
+    mystl::monotonic_arena arena(64);
+    for (int i = 0; i < 100; ++i)
+        arena.allocate(100);
+    size_t reserved = arena.bytes_reserved();
+
+    arena.reset();
+    size_t kept = arena.bytes_reserved();
+    EXPECT_LE(kept, reserved);
+    EXPECT_GT(kept, 0u);
+
+    void* first = arena.allocate(16);
+    arena.reset();
+    EXPECT_EQ(arena.allocate(16), first);
+    EXPECT_EQ(arena.bytes_reserved(), kept);
+}
+
+// 各个容器都可以使用 arena_allocator
+TEST(ArenaTest, Containers)
+{
+    mystl::monotonic_arena arena;
+
+    {
+        mystl::arena_allocator<int> alloc(arena);
+        mystl::vector<int, mystl::arena_allocator<int>> v(alloc);
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i);
+        EXPECT_EQ(v.size(), 1000u);
+        EXPECT_EQ(v[999], 999);
+        EXPECT_EQ(v.get_allocator(), alloc);
+
+        // 拷贝沿用同一区域
+        auto copy = v;
+        EXPECT_EQ(copy.get_allocator().arena(), &arena);
+        EXPECT_EQ(copy[500], 500);
+    }
+
+    {
+        mystl::arena_allocator<int> alloc(arena);
+        mystl::list<int, mystl::arena_allocator<int>> l(alloc);
+        for (int i = 0; i < 100; ++i)
+            l.push_back(i);
+        l.sort(mystl::greater<int>());
+        EXPECT_EQ(l.front(), 99);
+        EXPECT_EQ(l.back(), 0);
+        EXPECT_EQ(l.get_allocator().arena(), &arena);
+    }
+
+    {
+        mystl::arena_allocator<int> alloc(arena);
+        mystl::deque<int, mystl::arena_allocator<int>> d(alloc);
+        for (int i = 0; i < 1000; ++i)
+        {
+            d.push_back(i);
+            d.push_front(-i);
+        }
+        EXPECT_EQ(d.size(), 2000u);
+        EXPECT_EQ(d.front(), -999);
+        EXPECT_EQ(d.back(), 999);
+    }
+
+    {
+        mystl::arena_allocator<int> alloc(arena);
+        mystl::rb_tree<int, mystl::less<int>, mystl::arena_allocator<int>> tree(alloc);
+        for (int i = 0; i < 100; ++i)
+            tree.insert_unique(i % 50);
+        EXPECT_EQ(tree.size(), 50u);
+
+        auto copy = tree;
+        EXPECT_EQ(copy.size(), 50u);
+        EXPECT_TRUE(copy == tree);
+
+        auto moved = mystl::move(copy);
+        EXPECT_EQ(moved.size(), 50u);
+        EXPECT_TRUE(copy.empty());
+    }
+
+    {
+        mystl::arena_allocator<int> alloc(arena);
+        mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>,
+                         mystl::equal_to<int>, mystl::arena_allocator<int>>
+            ht(10, mystl::hash<int>(), mystl::equal_to<int>(), alloc);
+        for (int i = 0; i < 500; ++i)
+            ht.insert_unique(i);
+        EXPECT_EQ(ht.size(), 500u);
+
+        auto copy = ht;
+        EXPECT_EQ(copy.size(), 500u);
+        EXPECT_EQ(copy.count(123), 1u);
+        EXPECT_EQ(copy.get_allocator().arena(), &arena);
+    }
+
+    EXPECT_GT(arena.bytes_reserved(), 0u);
+    arena.release();
+    EXPECT_EQ(arena.bytes_reserved(), 0u);
+}
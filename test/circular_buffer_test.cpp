@@ -0,0 +1,322 @@
+#include <gtest/gtest.h>
+#include "mystl/circular_buffer.hpp"
+#include "mystl/queue.hpp"
+#include "mystl/string.hpp"
+#include "test_types.hpp"
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template<class CB>
+    std::deque<int> to_std(const CB& cb)
+    {
+        std::deque<int> out;
+        for (auto it = cb.begin(); it != cb.end(); ++it) out.push_back(*it);
+        return out;
+    }
+
+    // 反向遍历
+    template<class CB>
+    std::deque<int> to_std_reversed(const CB& cb)
+    {
+        std::deque<int> out;
+        for (auto it = cb.rbegin(); it != cb.rend(); ++it) out.push_back(*it);
+        return out;
+    }
+
+    template<class CB>
+    std::string to_string(const CB& cb)
+    {
+        std::string out;
+        for (auto it = cb.begin(); it != cb.end(); ++it) out.push_back(*it);
+        return out;
+    }
+} // namespace
+
+TEST(CircularBufferTest, Basic)
+{
+    mystl::circular_buffer<int> cb;
+    EXPECT_TRUE(cb.empty());
+    EXPECT_EQ(cb.capacity(), 0u);
+
+    cb.push_back(1);
+    cb.push_back(2);
+    cb.push_front(0);
+    EXPECT_EQ(cb.size(), 3u);
+    EXPECT_EQ(cb.front(), 0);
+    EXPECT_EQ(cb.back(), 2);
+    EXPECT_EQ(cb[1], 1);
+    EXPECT_EQ(cb.at(2), 2);
+    EXPECT_THROW(cb.at(3), std::out_of_range);
+    EXPECT_EQ(cb.capacity() & (cb.capacity() - 1), 0u);
+
+    cb.pop_front();
+    cb.pop_back();
+    EXPECT_EQ(cb.size(), 1u);
+    EXPECT_EQ(cb.front(), 1);
+    cb.clear();
+    EXPECT_TRUE(cb.empty());
+    cb.pop_front();  // 空容器上弹出不做任何事
+    EXPECT_TRUE(cb.empty());
+
+    mystl::circular_buffer<int> reserved(100);
+    EXPECT_EQ(reserved.capacity(), 128u);
+    EXPECT_TRUE(reserved.empty());
+
+    mystl::circular_buffer<int> il{1, 2, 3};
+    EXPECT_EQ(to_std(il), (std::deque<int>{1, 2, 3}));
+}
+
+TEST(CircularBufferTest, WrapAround)
+{
+    mystl::ring_buffer<int, 8> rb;
+    EXPECT_EQ(rb.capacity(), 8u);
+    std::deque<int> ref;
+    int next = 0;
+    // 反复在两端插入删除，让头部绕过存储空间末尾
+    for (int round = 0; round < 50; ++round)
+    {
+        while (!rb.full())
+        {
+            if (next % 3 == 0)
+            {
+                rb.push_front(next);
+                ref.push_front(next);
+            }
+            else
+            {
+                rb.push_back(next);
+                ref.push_back(next);
+            }
+            ++next;
+        }
+        for (int i = 0; i < 5; ++i)
+        {
+            if ((round + i) % 2 == 0)
+            {
+                rb.pop_front();
+                ref.pop_front();
+            }
+            else
+            {
+                rb.pop_back();
+                ref.pop_back();
+            }
+        }
+        ASSERT_EQ(to_std(rb), ref);
+        ASSERT_EQ(to_std_reversed(rb), std::deque<int>(ref.rbegin(), ref.rend()));
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            ASSERT_EQ(rb[i], ref[i]);
+            ASSERT_EQ(rb.begin()[i], ref[i]);
+        }
+        ASSERT_EQ(rb.end() - rb.begin(), static_cast<ptrdiff_t>(ref.size()));
+    }
+
+    // 固定容量满了之后再插入抛出异常，内容不变
+    while (!rb.full()) rb.push_back(0);
+    auto before = to_std(rb);
+    EXPECT_THROW(rb.push_back(1), std::length_error);
+    EXPECT_THROW(rb.push_front(1), std::length_error);
+    EXPECT_THROW(rb.reserve(16), std::length_error);
+    EXPECT_EQ(to_std(rb), before);
+}
+
+TEST(CircularBufferTest, Overwrite)
+{
+    mystl::ring_buffer<int, 4> rb;
+    rb.set_overwrite(true);
+    EXPECT_TRUE(rb.overwrite());
+    for (int i = 0; i < 10; ++i) rb.push_back(i);
+    EXPECT_EQ(to_std(rb), (std::deque<int>{6, 7, 8, 9}));
+
+    rb.push_front(100);  // 覆盖最新的元素
+    EXPECT_EQ(to_std(rb), (std::deque<int>{100, 6, 7, 8}));
+
+    // 动态容量的缓冲区在覆盖模式下不再扩容
+    mystl::circular_buffer<mystl::string> cb(4);
+    cb.set_overwrite(true);
+    for (int i = 0; i < 7; ++i) cb.emplace_back(4 + i % 2, static_cast<char>('a' + i));
+    EXPECT_EQ(cb.capacity(), 4u);
+    EXPECT_EQ(cb.front(), mystl::string(5, 'd'));
+    EXPECT_EQ(cb.back(), mystl::string(4, 'g'));
+
+    // 覆盖模式下批量追加超过容量时只保留最后的元素
+    std::vector<int> src{1, 2, 3, 4, 5, 6};
+    rb.append(src.begin(), src.end());
+    EXPECT_EQ(to_std(rb), (std::deque<int>{3, 4, 5, 6}));
+}
+
+TEST(CircularBufferTest, SpansAndAppend)
+{
+    mystl::ring_buffer<char, 16> rb;
+    const char msg[] = "abcdefghij";
+    rb.append(msg, msg + 10);
+    rb.pop_front(8);  // 头部移到下标 8
+    EXPECT_EQ(rb.size(), 2u);
+    EXPECT_EQ(rb.array_two().size(), 0u);
+
+    rb.append(msg, msg + 10);  // 8 个在末尾，2 个绕回起点
+    EXPECT_EQ(rb.size(), 12u);
+    auto one = rb.array_one();
+    auto two = rb.array_two();
+    EXPECT_EQ(one.size(), 8u);
+    EXPECT_EQ(two.size(), 4u);
+    EXPECT_EQ(std::string(one.begin(), one.end()), "ijabcdef");
+    EXPECT_EQ(std::string(two.begin(), two.end()), "ghij");
+
+    // 按块算法：从环形缓冲区复制出去、填充环形缓冲区
+    char out[12];
+    mystl::copy(rb.begin(), rb.end(), out);
+    EXPECT_EQ(std::string(out, 12), "ijabcdefghij");
+    mystl::fill(rb.begin() + 6, rb.end(), 'x');
+    EXPECT_EQ(to_string(rb), "ijabcdxxxxxx");
+    mystl::copy(msg, msg + 10, rb.begin() + 1);
+    EXPECT_EQ(to_string(rb), "iabcdefghijx");
+    rb.pop_front(rb.size());
+    EXPECT_TRUE(rb.empty());
+
+    // 动态容量时追加会一次扩容到 2 的幂
+    mystl::circular_buffer<int> cb;
+    std::vector<int> src(100);
+    for (int i = 0; i < 100; ++i) src[i] = i;
+    cb.append(src.begin(), src.end());
+    EXPECT_EQ(cb.capacity(), 128u);
+    EXPECT_TRUE(mystl::equal(cb.begin(), cb.end(), src.begin()));
+}
+
+TEST(CircularBufferTest, Growth)
+{
+    mystl::circular_buffer<mystl::string> cb;
+    std::deque<mystl::string> ref;
+    for (int i = 0; i < 200; ++i)
+    {
+        mystl::string s(static_cast<size_t>(i % 40), static_cast<char>('a' + i % 26));
+        if (i % 5 == 0)
+        {
+            cb.push_front(s);
+            ref.push_front(s);
+        }
+        else
+        {
+            cb.push_back(s);
+            ref.push_back(s);
+        }
+        if (i % 7 == 0)
+        {
+            cb.pop_front();
+            ref.pop_front();
+        }
+    }
+    ASSERT_EQ(cb.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); ++i) EXPECT_EQ(cb[i], ref[i]);
+
+    // 参数引用容器自身的元素时扩容也正确
+    mystl::circular_buffer<mystl::string> self;
+    self.push_back(mystl::string(30, 'q'));
+    while (!self.full()) self.push_back(self.front());
+    self.push_back(self.front());
+    self.push_front(self.back());
+    for (const auto& s : self) EXPECT_EQ(s, mystl::string(30, 'q'));
+}
+
+TEST(CircularBufferTest, CopyMoveSwap)
+{
+    {
+        mystl::circular_buffer<LiveCounter> a;
+        for (int i = 0; i < 20; ++i) a.emplace_back(i);
+        a.set_overwrite(true);
+
+        mystl::circular_buffer<LiveCounter> b(a);
+        EXPECT_EQ(b.capacity(), a.capacity());
+        EXPECT_TRUE(b.overwrite());
+        mystl::circular_buffer<LiveCounter> c(mystl::move(a));
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(c.size(), 20u);
+        c.swap(a);
+        EXPECT_EQ(a.size(), 20u);
+        EXPECT_EQ(a[19].value, 19);
+
+        mystl::ring_buffer<LiveCounter, 8> r1;
+        mystl::ring_buffer<LiveCounter, 8> r2;
+        for (int i = 0; i < 6; ++i) r1.emplace_back(i);
+        r1.pop_front(4);
+        for (int i = 0; i < 5; ++i) r1.emplace_back(10 + i);
+        r2.emplace_back(-1);
+        r2.swap(r1);
+        EXPECT_EQ(r1.size(), 1u);
+        EXPECT_EQ(r2.size(), 7u);
+        EXPECT_EQ(r2.front().value, 4);
+        EXPECT_EQ(r2.back().value, 14);
+        r1 = r2;
+        EXPECT_EQ(r1.size(), 7u);
+        mystl::ring_buffer<LiveCounter, 8> r3(mystl::move(r1));
+        EXPECT_EQ(r3[2].value, 10);
+        EXPECT_TRUE(r1.empty());
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+
+    mystl::circular_buffer<int> x{1, 2, 3};
+    mystl::circular_buffer<int> y{1, 2, 4};
+    EXPECT_TRUE(x < y);
+    EXPECT_TRUE(x != y);
+    y.back() = 3;
+    EXPECT_TRUE(x == y);
+}
+
+TEST(CircularBufferTest, QueueAdapter)
+{
+    mystl::queue<int, mystl::circular_buffer<int>> q;
+    mystl::queue<int, mystl::ring_buffer<int, 64>> fixed;
+    std::deque<int> ref;
+    for (int i = 0; i < 1000; ++i)
+    {
+        q.push(i);
+        fixed.push(i);
+        ref.push_back(i);
+        if (i % 3 != 0)
+        {
+            EXPECT_EQ(q.front(), ref.front());
+            EXPECT_EQ(fixed.front(), ref.front());
+            q.pop();
+            fixed.pop();
+            ref.pop_front();
+        }
+        if (fixed.size() == 64) break;
+    }
+    EXPECT_EQ(q.size(), ref.size());
+    EXPECT_EQ(q.back(), ref.back());
+}
+
+TEST(CircularBufferTest, ExceptionSafety)
+{
+    mystl::circular_buffer<ThrowOnCopyMayThrowMove> cb;
+    for (int i = 0; i < 16; ++i) cb.emplace_back(i);
+    ASSERT_TRUE(cb.full());
+    cb.pop_front(3);
+    for (int i = 0; i < 3; ++i) cb.emplace_back(100 + i);
+
+    // 新元素的复制抛出异常：内容与容量不变
+    ThrowOnCopyMayThrowMove::should_throw = true;
+    ThrowOnCopyMayThrowMove extra(7);
+    EXPECT_THROW(cb.push_back(extra), std::runtime_error);
+    EXPECT_EQ(cb.capacity(), 16u);
+    EXPECT_EQ(cb.size(), 16u);
+
+    // 移动构造可能抛出异常，扩容时原有元素只能复制；复制失败同样保持原样
+    EXPECT_THROW(cb.push_back(ThrowOnCopyMayThrowMove(8)), std::runtime_error);
+    ThrowOnCopyMayThrowMove::should_throw = false;
+    EXPECT_EQ(cb.capacity(), 16u);
+    EXPECT_EQ(cb.size(), 16u);
+    EXPECT_EQ(cb.front().value, 3);
+    EXPECT_EQ(cb.back().value, 102);
+
+    cb.push_back(ThrowOnCopyMayThrowMove(8));
+    EXPECT_EQ(cb.capacity(), 32u);
+    EXPECT_EQ(cb.size(), 17u);
+    EXPECT_EQ(cb.front().value, 3);
+    EXPECT_EQ(cb.back().value, 8);
+}
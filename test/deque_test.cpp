@@ -2,8 +2,54 @@
 #include "mystl/deque.hpp"
 #include "throw_on_copy.hpp"
 #include "mystl/vector.hpp"
+#include "mystl/queue.hpp"
+#include "mystl/string.hpp"
+#include <algorithm>
+#include <deque>
 #include <stdexcept>
 
+namespace
+{
+    // 统计分配器调用次数
+    struct alloc_counter
+    {
+        static inline int allocations = 0;
+        static inline int deallocations = 0;
+    };
+
+    template<class T>
+    struct counting_allocator : mystl::allocator<T>
+    {
+        template<class U>
+        struct rebind
+        {
+            using other = counting_allocator<U>;
+        };
+
+        counting_allocator() noexcept = default;
+        template<class U>
+        counting_allocator(const counting_allocator<U>&) noexcept {}
+
+        T* allocate(size_t n)
+        {
+            ++alloc_counter::allocations;
+            return mystl::allocator<T>::allocate(n);
+        }
+
+        void deallocate(T* p, size_t n) noexcept
+        {
+            ++alloc_counter::deallocations;
+            mystl::allocator<T>::deallocate(p, n);
+        }
+    };
+
+    struct message
+    {
+        char payload[600];
+        int id;
+    };
+} // namespace
+
 // 构造函数测试
 TEST(DequeTest, Constructor) 
 {
@@ -519,3 +565,225 @@ TEST(DequeTest, EdgeCases)
     EXPECT_EQ(dq.front(), 1);
 }
 
+
+// 可配置的缓冲区大小
+TEST(DequeTest, BlockSize)
+{
+    // 默认：元素超过 512 字节时每个缓冲区只有一个元素
+    using default_iterator = mystl::deque<message>::iterator;
+    using big_iterator = mystl::deque<message, mystl::allocator<message>, 16>::iterator;
+    EXPECT_EQ(mystl::deque_buf_size(0, sizeof(message)), 1u);
+    EXPECT_EQ(mystl::deque_buf_size(16, sizeof(message)), 16u);
+    EXPECT_EQ(mystl::deque_buf_size(0, sizeof(int)), 128u);
+    EXPECT_FALSE((mystl::is_same_v<default_iterator, big_iterator>));
+
+    // 跨缓冲区的随机访问、插入与删除
+    mystl::deque<int, mystl::allocator<int>, 3> dq;
+    for (int i = 0; i < 20; ++i) dq.push_back(i);
+    for (int i = 1; i <= 10; ++i) dq.push_front(-i);
+    EXPECT_EQ(dq.size(), 30u);
+    EXPECT_EQ(dq.front(), -10);
+    EXPECT_EQ(dq[10], 0);
+    EXPECT_EQ(dq.end() - dq.begin(), 30);
+    EXPECT_EQ(*(dq.begin() + 29), 19);
+    dq.insert(dq.begin() + 15, 100);
+    EXPECT_EQ(dq[15], 100);
+    dq.erase(dq.begin() + 15);
+    for (int i = 0; i < 30; ++i) EXPECT_EQ(dq[i], i - 10);
+
+    mystl::deque<int, mystl::allocator<int>, 3> copy(dq);
+    EXPECT_EQ(copy, dq);
+    mystl::deque<int, mystl::allocator<int>, 3>::const_iterator it = copy.begin();
+    EXPECT_EQ(*it, -10);
+}
+
+// 头尾弹出的空缓冲区进入备用缓存，稳定的队列流量不再调用分配器
+TEST(DequeTest, SpareBlocks)
+{
+    using counted_deque = mystl::deque<int, counting_allocator<int>, 4>;
+    {
+        mystl::queue<int, counted_deque> q;
+        for (int i = 0; i < 10; ++i) q.push(i);
+        // 预热：map 增长到稳定大小，备用缓存填满
+        for (int i = 0; i < 100; ++i)
+        {
+            q.push(0);
+            q.pop();
+        }
+
+        int before = alloc_counter::allocations;
+        int freed = alloc_counter::deallocations;
+        for (int i = 0; i < 10000; ++i)
+        {
+            q.push(i);
+            q.pop();
+        }
+        EXPECT_EQ(alloc_counter::allocations, before);
+        EXPECT_EQ(alloc_counter::deallocations, freed);
+        EXPECT_EQ(q.size(), 10u);
+    }
+    // 析构时备用缓冲区全部释放
+    EXPECT_EQ(alloc_counter::allocations, alloc_counter::deallocations);
+
+    // 反方向（push_front / pop_back）同样复用
+    {
+        counted_deque dq;
+        for (int i = 0; i < 110; ++i)
+        {
+            dq.push_front(i);
+            if (i >= 10) dq.pop_back();
+        }
+        int before = alloc_counter::allocations;
+        for (int i = 0; i < 1000; ++i)
+        {
+            dq.push_front(i);
+            dq.pop_back();
+        }
+        EXPECT_EQ(alloc_counter::allocations, before);
+
+        // 清空后缓存最多保留两个缓冲区，其余归还分配器
+        for (int i = 0; i < 100; ++i) dq.push_back(i);
+        dq.clear();
+        int after_clear = alloc_counter::deallocations;
+        for (int i = 0; i < 8; ++i) dq.push_back(i);
+        EXPECT_EQ(alloc_counter::deallocations, after_clear);
+
+        counted_deque other;
+        other.swap(dq);
+        EXPECT_EQ(other.size(), 8u);
+        counted_deque moved(mystl::move(other));
+        EXPECT_EQ(moved.back(), 7);
+    }
+    EXPECT_EQ(alloc_counter::allocations, alloc_counter::deallocations);
+}
+
+// copy / move / fill 按缓冲区拆分 deque 区间，块内走原生指针
+TEST(DequeTest, SegmentedAlgorithms)
+{
+    using small_deque = mystl::deque<int, mystl::allocator<int>, 5>;
+    EXPECT_TRUE(mystl::is_segmented_iterator_v<small_deque::iterator>);
+    EXPECT_TRUE(mystl::is_segmented_iterator_v<small_deque::const_iterator>);
+    EXPECT_FALSE(mystl::is_segmented_iterator_v<int*>);
+
+    small_deque dq;
+    for (int i = 0; i < 47; ++i) dq.push_back(i);
+    for (int i = 1; i <= 3; ++i) dq.push_front(-i);
+
+    // deque -> 数组，数组 -> deque
+    int arr[50] = {};
+    const small_deque& cdq = dq;
+    EXPECT_EQ(mystl::copy(cdq.begin() + 1, cdq.end(), arr), arr + 49);
+    for (int i = 0; i < 49; ++i) ASSERT_EQ(arr[i], i - 2);
+    for (int& x : arr) x = -x;
+    EXPECT_EQ(mystl::copy(arr, arr + 50, dq.begin()), dq.end());
+    EXPECT_EQ(dq[2], 0);
+    EXPECT_EQ(dq[7], -5);
+    EXPECT_EQ(mystl::copy_backward(arr + 10, arr + 20, dq.end()), dq.end() - 10);
+    EXPECT_EQ(dq.back(), -17);
+    EXPECT_EQ(mystl::copy_n(dq.begin() + 40, 10, arr), arr + 10);
+    EXPECT_EQ(arr[9], -17);
+
+    // deque 之间，以及同一 deque 内重叠的平移
+    small_deque other(50);
+    for (int i = 0; i < 50; ++i) dq[i] = i;
+    EXPECT_EQ(mystl::copy(dq.begin(), dq.end(), other.begin() + 0), other.end());
+    EXPECT_EQ(other, dq);
+    EXPECT_EQ(mystl::move(dq.begin() + 7, dq.end(), dq.begin() + 3), dq.end() - 4);
+    for (int i = 3; i < 46; ++i) ASSERT_EQ(dq[i], i + 4);
+    EXPECT_EQ(mystl::move_backward(other.begin(), other.begin() + 38, other.begin() + 49), other.begin() + 11);
+    for (int i = 11; i < 49; ++i) ASSERT_EQ(other[i], i - 11);
+    EXPECT_EQ(other[49], 49);
+
+    // fill / fill_n，单字节类型在块内用 memset
+    mystl::fill(dq.begin() + 2, dq.end() - 2, 9);
+    EXPECT_EQ(mystl::count(dq.begin(), dq.end(), 9), 46);
+    EXPECT_EQ(mystl::fill_n(dq.begin() + 1, 13, 4), dq.begin() + 14);
+    EXPECT_EQ(dq[13], 4);
+    EXPECT_EQ(dq[14], 9);
+    mystl::deque<char> chars(2000, 'a');
+    mystl::fill(chars.begin() + 100, chars.end() - 100, 'b');
+    EXPECT_EQ(mystl::count(chars.begin(), chars.end(), 'b'), 1800);
+    EXPECT_EQ(chars[99], 'a');
+
+    // 非平凡类型同样逐块处理
+    mystl::deque<mystl::string, mystl::allocator<mystl::string>, 3> words(10, "x");
+    mystl::vector<mystl::string> source{"a", "b", "c", "d", "e", "f", "g"};
+    mystl::copy(source.begin(), source.end(), words.begin() + 2);
+    EXPECT_EQ(words[2], "a");
+    EXPECT_EQ(words[8], "g");
+    mystl::move_backward(words.begin(), words.begin() + 6, words.end());
+    EXPECT_EQ(words[4], "x");
+    EXPECT_EQ(words[9], "d");
+}
+
+// 中间插入与删除和 std::deque 逐步对照，覆盖前后两侧、跨越多个缓冲区的平移
+TEST(DequeTest, InsertEraseMatchesReference)
+{
+    using int_deque = mystl::deque<int, counting_allocator<int>, 4>;
+    using string_deque = mystl::deque<mystl::string, mystl::allocator<mystl::string>, 3>;
+    {
+        int_deque dq;
+        string_deque sdq;
+        std::deque<int> ref;
+        unsigned seed = 12345;
+        auto next = [&seed](unsigned bound) {
+            seed = seed * 1103515245u + 12345u;
+            return static_cast<int>((seed >> 16) % bound);
+        };
+        for (int step = 0; step < 3000; ++step)
+        {
+            const int pos = next(static_cast<unsigned>(ref.size()) + 1);
+            const int op = next(6);
+            const int count = next(12);
+            if (op == 0)
+            {
+                dq.insert(dq.begin() + pos, step);
+                sdq.emplace(sdq.begin() + pos, 1, static_cast<char>('a' + step % 26));
+                ref.insert(ref.begin() + pos, step);
+            }
+            else if (op == 1)
+            {
+                dq.insert(dq.begin() + pos, static_cast<size_t>(count), step);
+                sdq.insert(sdq.begin() + pos, static_cast<size_t>(count), mystl::string(1, static_cast<char>('a' + step % 26)));
+                ref.insert(ref.begin() + pos, static_cast<size_t>(count), step);
+            }
+            else if (op == 2)
+            {
+                mystl::vector<int> values;
+                mystl::vector<mystl::string> strings;
+                for (int i = 0; i < count; ++i)
+                {
+                    values.push_back(step + i);
+                    strings.push_back(mystl::string(1, static_cast<char>('a' + (step + i) % 26)));
+                }
+                dq.insert(dq.begin() + pos, values.begin(), values.end());
+                sdq.insert(sdq.begin() + pos, strings.begin(), strings.end());
+                ref.insert(ref.begin() + pos, values.data(), values.data() + values.size());
+            }
+            else if (!ref.empty())
+            {
+                const int first = next(static_cast<unsigned>(ref.size()));
+                const int last = first + next(static_cast<unsigned>(std::min<size_t>(ref.size() - first, 16)) + 1);
+                auto it = dq.erase(dq.begin() + first, dq.begin() + last);
+                EXPECT_EQ(it - dq.begin(), first);
+                sdq.erase(sdq.begin() + first, sdq.begin() + last);
+                ref.erase(ref.begin() + first, ref.begin() + last);
+            }
+
+            ASSERT_EQ(dq.size(), ref.size());
+            ASSERT_EQ(sdq.size(), ref.size());
+            for (size_t i = 0; i < ref.size(); ++i)
+            {
+                ASSERT_EQ(dq[i], ref[i]) << "step " << step << " index " << i;
+                ASSERT_EQ(sdq[i][0], static_cast<char>('a' + ref[i] % 26)) << "step " << step;
+            }
+        }
+
+        // 删除后空出的缓冲区已归还，容器只持有当前元素所需的缓冲区与备用缓存
+        for (int i = 0; i < 100; ++i) dq.push_back(i);
+        dq.erase(dq.begin() + 1, dq.end() - 1);
+        EXPECT_EQ(dq.size(), 2u);
+        EXPECT_LE(alloc_counter::allocations - alloc_counter::deallocations, 5);
+    }
+    EXPECT_EQ(alloc_counter::allocations, alloc_counter::deallocations);
+}
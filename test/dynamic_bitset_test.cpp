@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+#include "mystl/dynamic_bitset.hpp"
+#include "mystl/algorithm.hpp"
+#include <vector>
+
+namespace
+{
+    // 按位与逐位的参考实现比较
+    template<class Bitset>
+    void expect_bits(const Bitset& b, const std::vector<bool>& expected)
+    {
+        ASSERT_EQ(b.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(b[i], expected[i]) << "bit " << i;
+        }
+    }
+
+    // 可复现的伪随机位
+    std::vector<bool> random_bits(size_t n, unsigned seed, unsigned one_in)
+    {
+        std::vector<bool> bits(n);
+        unsigned x = seed;
+        for (size_t i = 0; i < n; ++i)
+        {
+            x = x * 1103515245u + 12345u;
+            bits[i] = (x >> 16) % one_in == 0;
+        }
+        return bits;
+    }
+} // namespace
+
+// 构造与基本访问
+TEST(DynamicBitsetTest, Constructor)
+{
+    mystl::dynamic_bitset<> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.num_words(), 0u);
+    EXPECT_EQ(empty.begin(), empty.end());
+
+    mystl::dynamic_bitset<> zeros(100);
+    EXPECT_EQ(zeros.size(), 100u);
+    EXPECT_EQ(zeros.num_words(), 2u);
+    EXPECT_TRUE(zeros.none());
+
+    // 最后一个字中超出 size() 的位保持为 0
+    mystl::dynamic_bitset<> ones(70, true);
+    EXPECT_EQ(ones.count(), 70u);
+    EXPECT_TRUE(ones.all());
+    EXPECT_EQ(ones.data()[1], (uint64_t(1) << 6) - 1);
+
+    mystl::dynamic_bitset<> list{true, false, true, true};
+    expect_bits(list, {true, false, true, true});
+
+    std::vector<bool> src = random_bits(300, 7, 3);
+    mystl::dynamic_bitset<> from_range(src.begin(), src.end());
+    expect_bits(from_range, src);
+
+    mystl::dynamic_bitset<> copy(from_range);
+    EXPECT_EQ(copy, from_range);
+    mystl::dynamic_bitset<> moved(mystl::move(copy));
+    EXPECT_EQ(moved, from_range);
+    EXPECT_TRUE(copy.empty());
+
+    EXPECT_TRUE(list.test(0));
+    EXPECT_FALSE(list.test(1));
+    EXPECT_THROW(list.test(4), std::out_of_range);
+}
+
+// 修改单个位与整体修改
+TEST(DynamicBitsetTest, Modifiers)
+{
+    mystl::dynamic_bitset<> b(130);
+    b.set(0).set(64).set(129);
+    b[65] = true;
+    b.flip(1);
+    EXPECT_EQ(b.count(), 5u);
+    b.reset(64);
+    EXPECT_FALSE(b[64]);
+    b[2] = b[1];
+    EXPECT_TRUE(b[2]);
+    b[2].flip();
+    EXPECT_FALSE(b[2]);
+
+    b.flip();
+    EXPECT_EQ(b.count(), 130u - 4);
+    b.set();
+    EXPECT_TRUE(b.all());
+    b.reset();
+    EXPECT_TRUE(b.none());
+    b.fill(true);
+    EXPECT_EQ(b.count(), 130u);
+
+    // 跨字的区间赋值
+    b.reset();
+    b.set(10, 200 - 90, true);
+    EXPECT_EQ(b.count(), 110u);
+    EXPECT_FALSE(b[9]);
+    EXPECT_TRUE(b[10]);
+    EXPECT_TRUE(b[119]);
+    EXPECT_FALSE(b[120]);
+    b.set(60, 4, false);
+    EXPECT_EQ(b.count(), 106u);
+}
+
+// push_back、pop_back 与 resize 维持末尾空闲位为 0
+TEST(DynamicBitsetTest, Resize)
+{
+    std::vector<bool> expected = random_bits(200, 3, 2);
+    mystl::dynamic_bitset<> b;
+    for (bool bit : expected) b.push_back(bit);
+    expect_bits(b, expected);
+
+    for (int i = 0; i < 70; ++i)
+    {
+        b.pop_back();
+        expected.pop_back();
+    }
+    expect_bits(b, expected);
+    EXPECT_EQ(b.num_words(), 3u);
+
+    b.resize(300, true);
+    expected.resize(300, true);
+    expect_bits(b, expected);
+
+    b.resize(65);
+    expected.resize(65);
+    expect_bits(b, expected);
+    EXPECT_EQ(b.data()[1] >> 1, 0u);
+    size_t ones = 0;
+    for (bool bit : expected) ones += bit;
+    EXPECT_EQ(b.count(), ones);
+
+    b.clear();
+    EXPECT_TRUE(b.empty());
+    b.reserve(1000);
+    EXPECT_GE(b.capacity(), 1000u);
+}
+
+// 按字查找
+TEST(DynamicBitsetTest, FindFirstNext)
+{
+    mystl::dynamic_bitset<> b(500);
+    EXPECT_EQ(b.find_first(), mystl::dynamic_bitset<>::npos);
+
+    size_t positions[] = {3, 63, 64, 200, 499};
+    for (size_t p : positions) b.set(p);
+    std::vector<size_t> found;
+    for (size_t i = b.find_first(); i != b.npos; i = b.find_next(i)) found.push_back(i);
+    EXPECT_EQ(found, std::vector<size_t>(std::begin(positions), std::end(positions)));
+    EXPECT_EQ(b.find_next(499), b.npos);
+    EXPECT_EQ(b.find_next(10000), b.npos);
+}
+
+// 整体位运算
+TEST(DynamicBitsetTest, BitwiseOperators)
+{
+    std::vector<bool> x = random_bits(333, 1, 2);
+    std::vector<bool> y = random_bits(333, 2, 3);
+    mystl::dynamic_bitset<> a(x.begin(), x.end());
+    mystl::dynamic_bitset<> b(y.begin(), y.end());
+
+    std::vector<bool> and_bits(333), or_bits(333), xor_bits(333), diff_bits(333), not_bits(333);
+    for (size_t i = 0; i < 333; ++i)
+    {
+        and_bits[i] = x[i] && y[i];
+        or_bits[i] = x[i] || y[i];
+        xor_bits[i] = x[i] != y[i];
+        diff_bits[i] = x[i] && !y[i];
+        not_bits[i] = !x[i];
+    }
+    expect_bits(a & b, and_bits);
+    expect_bits(a | b, or_bits);
+    expect_bits(a ^ b, xor_bits);
+    expect_bits(a - b, diff_bits);
+    expect_bits(~a, not_bits);
+    EXPECT_EQ((~a).count() + a.count(), 333u);
+
+    mystl::dynamic_bitset<> shorter(10);
+    EXPECT_THROW(a &= shorter, std::invalid_argument);
+}
+
+// mystl::count / find / fill 作用于位迭代器时按字处理，结果与逐位一致
+TEST(DynamicBitsetTest, Algorithms)
+{
+    std::vector<bool> bits = random_bits(1000, 5, 7);
+    mystl::dynamic_bitset<> b(bits.begin(), bits.end());
+    const auto& cb = b;
+
+    for (size_t first : {0, 1, 63, 64, 65, 500})
+    {
+        for (size_t last : {first, first + 1, size_t(127), size_t(128), size_t(999), size_t(1000)})
+        {
+            if (last < first) continue;
+            auto f = cb.begin() + first;
+            auto l = cb.begin() + last;
+            ptrdiff_t ones = 0;
+            for (size_t i = first; i < last; ++i) ones += bits[i];
+            EXPECT_EQ(mystl::count(f, l, true), ones);
+            EXPECT_EQ(mystl::count(f, l, false), static_cast<ptrdiff_t>(last - first) - ones);
+
+            size_t expect_one = first;
+            while (expect_one < last && !bits[expect_one]) ++expect_one;
+            size_t expect_zero = first;
+            while (expect_zero < last && bits[expect_zero]) ++expect_zero;
+            EXPECT_EQ(mystl::find(f, l, true) - cb.begin(), static_cast<ptrdiff_t>(expect_one));
+            EXPECT_EQ(mystl::find(f, l, false) - cb.begin(), static_cast<ptrdiff_t>(expect_zero));
+        }
+    }
+
+    mystl::fill(b.begin() + 30, b.begin() + 700, true);
+    for (size_t i = 30; i < 700; ++i) bits[i] = true;
+    expect_bits(b, bits);
+    mystl::fill(b.begin() + 64, b.begin() + 128, 0);
+    for (size_t i = 64; i < 128; ++i) bits[i] = false;
+    expect_bits(b, bits);
+
+    // 逐位复制，与 bool 数组互相转换
+    bool raw[100];
+    mystl::copy(cb.begin() + 10, cb.begin() + 110, raw);
+    for (size_t i = 0; i < 100; ++i) EXPECT_EQ(raw[i], bits[i + 10]);
+    mystl::dynamic_bitset<> c(100);
+    mystl::copy(raw, raw + 100, c.begin());
+    mystl::dynamic_bitset<> d(100);
+    mystl::copy(c.begin(), c.end(), d.begin());
+    EXPECT_EQ(c, d);
+}
+
+// 迭代器的随机访问与反向遍历
+TEST(DynamicBitsetTest, Iterators)
+{
+    mystl::dynamic_bitset<> b(200);
+    b.set(0).set(70).set(199);
+    auto it = b.begin() + 70;
+    EXPECT_TRUE(*it);
+    EXPECT_EQ(it - b.begin(), 70);
+    it -= 71;
+    ++it;
+    EXPECT_EQ(it, b.begin());
+    EXPECT_TRUE(b.begin()[199]);
+    EXPECT_EQ((b.end() - 1) - b.begin(), 199);
+    --it;
+    ++it;
+    EXPECT_EQ(it, b.begin());
+    EXPECT_TRUE(b.begin() < b.end());
+
+    mystl::dynamic_bitset<>::const_iterator cit = b.begin();
+    EXPECT_TRUE(*cit);
+
+    size_t ones = 0;
+    for (auto r = b.rbegin(); r != b.rend(); ++r) ones += *r;
+    EXPECT_EQ(ones, 3u);
+
+    mystl::swap(b[0], b[1]);
+    EXPECT_FALSE(b[0]);
+    EXPECT_TRUE(b[1]);
+}
@@ -0,0 +1,359 @@
+#include <gtest/gtest.h>
+#include "mystl/flat_hash_map.hpp"
+#include "mystl/flat_hash_set.hpp"
+#include "mystl/string.hpp"
+#include "mystl/vector.hpp"
+#include "test_types.hpp"
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+    // 字符串的简单哈希（FNV-1a）
+    struct StringHash
+    {
+        size_t operator()(const mystl::string& s) const
+        {
+            size_t h = 1469598103934665603ULL;
+            for (size_t i = 0; i < s.size(); ++i)
+            {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= 1099511628211ULL;
+            }
+            return h;
+        }
+    };
+
+    // 只有 4 个不同哈希值，制造大量冲突与长探测序列
+    struct CollidingHash
+    {
+        size_t operator()(int x) const { return static_cast<size_t>(x & 3); }
+    };
+
+    // 调用 calls_left 次之后抛出异常，为负时不抛出
+    struct CountdownHash
+    {
+        static inline int calls_left = -1;
+
+        size_t operator()(int x) const
+        {
+            if (calls_left == 0) throw std::runtime_error("Hash error");
+            if (calls_left > 0) --calls_left;
+            return static_cast<size_t>(x);
+        }
+    };
+
+    // 统计构造次数，检查键已存在时没有构造值
+    struct Counted
+    {
+        static inline int constructed = 0;
+        int value;
+
+        Counted(int v = 0) : value(v) { ++constructed; }
+        Counted(const Counted& other) : value(other.value) { ++constructed; }
+    };
+} // namespace
+
+TEST(FlatHashMapTest, Basic)
+{
+    mystl::flat_hash_map<int, int> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.bucket_count(), 0u);
+    EXPECT_EQ(m.find(1), m.end());
+    EXPECT_EQ(m.begin(), m.end());
+
+    auto r = m.insert(mystl::pair<const int, int>(1, 10));
+    EXPECT_TRUE(r.second);
+    EXPECT_EQ(r.first->second, 10);
+    r = m.insert(mystl::pair<const int, int>(1, 20));
+    EXPECT_FALSE(r.second);
+    EXPECT_EQ(r.first->second, 10);
+
+    m[2] = 20;
+    m[3];
+    EXPECT_EQ(m.size(), 3u);
+    EXPECT_EQ(m.at(2), 20);
+    EXPECT_EQ(m[3], 0);
+    EXPECT_THROW(m.at(4), std::out_of_range);
+    EXPECT_TRUE(m.contains(1));
+    EXPECT_EQ(m.count(4), 0u);
+    EXPECT_FALSE(m.try_emplace(2, 99).second);
+    EXPECT_EQ(m[2], 20);
+    EXPECT_TRUE(m.emplace(5, 50).second);
+
+    auto range = m.equal_range(5);
+    ASSERT_NE(range.first, m.end());
+    EXPECT_EQ(range.first->second, 50);
+    EXPECT_NE(range.first, range.second);
+
+    EXPECT_EQ(m.erase(2), 1u);
+    EXPECT_EQ(m.erase(2), 0u);
+    EXPECT_EQ(m.size(), 3u);
+    EXPECT_FALSE(m.contains(2));
+
+    int sum = 0;
+    for (const auto& kv : m) sum += kv.first;
+    EXPECT_EQ(sum, 1 + 3 + 5);
+
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+    EXPECT_GT(m.bucket_count(), 0u);
+}
+
+TEST(FlatHashMapTest, GroupImplementationsAgree)
+{
+    // SSE2 与可移植实现对同一组控制字节给出相同结果
+    std::mt19937 gen(7);
+    const mystl::flat_detail::ctrl_t values[] = {
+        mystl::flat_detail::CTRL_EMPTY, mystl::flat_detail::CTRL_DELETED,
+        mystl::flat_detail::CTRL_SENTINEL, 0, 1, 42, 127};
+    for (int round = 0; round < 2000; ++round)
+    {
+        mystl::flat_detail::ctrl_t ctrl[mystl::flat_detail::GROUP_WIDTH];
+        for (auto& c : ctrl) c = values[gen() % 7];
+        mystl::flat_detail::group g(ctrl);
+        mystl::flat_detail::portable_group p(ctrl);
+        for (auto h : {0, 1, 42, 127})
+        {
+            ASSERT_EQ(g.match(static_cast<mystl::flat_detail::ctrl_t>(h)).bits(),
+                      p.match(static_cast<mystl::flat_detail::ctrl_t>(h)).bits());
+        }
+        ASSERT_EQ(g.match_empty().bits(), p.match_empty().bits());
+        ASSERT_EQ(g.match_empty_or_deleted().bits(), p.match_empty_or_deleted().bits());
+        ASSERT_EQ(g.count_leading_empty_or_deleted(), p.count_leading_empty_or_deleted());
+    }
+}
+
+TEST(FlatHashMapTest, MatchesReference)
+{
+    // 随机插入、删除、查找，与 std::unordered_map 对照；键范围较小，反复删除产生大量墓碑
+    mystl::flat_hash_map<int, int> m;
+    mystl::flat_hash_map<int, int, CollidingHash> colliding;
+    std::unordered_map<int, int> ref;
+    std::mt19937 gen(12345);
+    for (int step = 0; step < 60000; ++step)
+    {
+        const int key = static_cast<int>(gen() % 3000);
+        switch (gen() % 4)
+        {
+        case 0:
+        case 1:
+            m[key] = step;
+            if (step % 8 == 0) colliding[key % 300] = step;
+            ref[key] = step;
+            break;
+        case 2:
+        {
+            const size_t erased = m.erase(key);
+            ASSERT_EQ(erased, ref.erase(key));
+            if (step % 8 == 0) colliding.erase(key % 300);
+            break;
+        }
+        default:
+        {
+            auto it = m.find(key);
+            auto rit = ref.find(key);
+            ASSERT_EQ(it == m.end(), rit == ref.end());
+            if (rit != ref.end())
+            {
+                ASSERT_EQ(it->second, rit->second);
+            }
+            break;
+        }
+        }
+        ASSERT_EQ(m.size(), ref.size());
+        ASSERT_LE(m.load_factor(), m.max_load_factor());
+    }
+
+    size_t visited = 0;
+    for (const auto& kv : m)
+    {
+        auto rit = ref.find(kv.first);
+        ASSERT_NE(rit, ref.end());
+        EXPECT_EQ(kv.second, rit->second);
+        ++visited;
+    }
+    EXPECT_EQ(visited, ref.size());
+
+    // 大量冲突时查找仍然正确
+    for (int k = 0; k < 300; ++k)
+    {
+        auto it = colliding.find(k);
+        if (it != colliding.end())
+        {
+            EXPECT_EQ(it->first, k);
+        }
+    }
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating)
+{
+    mystl::flat_hash_map<int, mystl::string> m;
+    for (int i = 0; i < 1000; ++i) m[i] = mystl::string(static_cast<size_t>(i % 50), 'x');
+    for (auto it = m.begin(); it != m.end();)
+    {
+        if (it->first % 3 == 0) it = m.erase(it);
+        else ++it;
+    }
+    EXPECT_EQ(m.size(), 666u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(m.contains(i), i % 3 != 0);
+
+    m.erase(m.begin(), m.end());
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(FlatHashMapTest, ReserveAndRehash)
+{
+    mystl::flat_hash_map<int, int> m;
+    m.reserve(1000);
+    const size_t cap = m.bucket_count();
+    EXPECT_GE(cap * 7 / 8, 1000u);
+    for (int i = 0; i < 1000; ++i) m[i] = i;
+    EXPECT_EQ(m.bucket_count(), cap);
+
+    // 删除后以相同或更小的容量重建，清除墓碑
+    for (int i = 0; i < 900; ++i) m.erase(i);
+    m.rehash(0);
+    EXPECT_LT(m.bucket_count(), cap);
+    for (int i = 900; i < 1000; ++i) EXPECT_EQ(m.at(i), i);
+
+    // 墓碑过多时插入触发同容量重建，容量不会无限增长
+    mystl::flat_hash_map<int, int> churn;
+    for (int i = 0; i < 100; ++i) churn[i] = i;
+    const size_t churn_cap = churn.bucket_count();
+    for (int i = 100; i < 100000; ++i)
+    {
+        churn.erase(i - 100);
+        churn[i] = i;
+    }
+    EXPECT_EQ(churn.size(), 100u);
+    EXPECT_EQ(churn.bucket_count(), churn_cap);
+
+    mystl::flat_hash_map<int, int> empty;
+    empty.rehash(0);
+    EXPECT_EQ(empty.bucket_count(), 0u);
+}
+
+TEST(FlatHashMapTest, CopyMoveSwap)
+{
+    {
+        mystl::flat_hash_map<mystl::string, LiveCounter, StringHash> a;
+        for (int i = 0; i < 200; ++i)
+        {
+            a.emplace(mystl::string(static_cast<size_t>(i % 20 + 1), static_cast<char>('a' + i % 26)), LiveCounter(i));
+        }
+        mystl::flat_hash_map<mystl::string, LiveCounter, StringHash> b(a);
+        EXPECT_EQ(b.size(), a.size());
+        for (const auto& kv : a) EXPECT_EQ(b.at(kv.first).value, kv.second.value);
+
+        mystl::flat_hash_map<mystl::string, LiveCounter, StringHash> c(mystl::move(a));
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(c.size(), b.size());
+        a[mystl::string("again")] = LiveCounter(1);
+        EXPECT_EQ(a.size(), 1u);
+
+        c.swap(a);
+        EXPECT_EQ(c.size(), 1u);
+        b = a;
+        EXPECT_EQ(b.size(), a.size());
+        c = mystl::move(b);
+        EXPECT_TRUE(b.empty());
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+}
+
+// 键已存在时 try_emplace 与 operator[] 不构造值，右值参数不被移走
+TEST(FlatHashMapTest, TryEmplaceIsLazy)
+{
+    mystl::flat_hash_map<int, mystl::string> m;
+    m[1] = mystl::string("one");
+    mystl::string s("replacement");
+    EXPECT_FALSE(m.try_emplace(1, mystl::move(s)).second);
+    EXPECT_EQ(s, mystl::string("replacement"));
+    EXPECT_EQ(m[1], mystl::string("one"));
+    EXPECT_TRUE(m.try_emplace(2, mystl::move(s)).second);
+    EXPECT_EQ(m[2], mystl::string("replacement"));
+
+    mystl::flat_hash_map<int, Counted> counted;
+    counted[1].value = 1;
+    const int before = Counted::constructed;
+    EXPECT_EQ(counted[1].value, 1);
+    EXPECT_FALSE(counted.try_emplace(1, 5).second);
+    EXPECT_EQ(Counted::constructed, before);
+}
+
+TEST(FlatHashMapTest, ArgumentAliasesElement)
+{
+    // 参数引用表中的元素，插入触发扩容时也正确
+    mystl::flat_hash_map<int, mystl::string> m;
+    m[0] = mystl::string(40, 'z');
+    for (int i = 1; i < 500; ++i)
+    {
+        m.try_emplace(i, m.at(0));
+    }
+    for (int i = 0; i < 500; ++i) EXPECT_EQ(m.at(i), mystl::string(40, 'z'));
+}
+
+TEST(FlatHashMapTest, ExceptionSafety)
+{
+    mystl::flat_hash_map<int, ThrowOnCopyMayThrowMove> m;
+    m.reserve(14);
+    const size_t cap = m.bucket_count();
+    const int full = static_cast<int>(cap * 7 / 8);  // 最大负载因子 7/8
+    for (int i = 0; i < full; ++i) m.emplace(i, ThrowOnCopyMayThrowMove(i));
+    EXPECT_EQ(m.bucket_count(), cap);
+
+    // 下一次插入需要重哈希，元素只能复制；复制失败时表不变
+    ThrowOnCopyMayThrowMove::should_throw = true;
+    EXPECT_THROW(m.emplace(full, ThrowOnCopyMayThrowMove(full)), std::runtime_error);
+    ThrowOnCopyMayThrowMove::should_throw = false;
+    EXPECT_EQ(m.size(), static_cast<size_t>(full));
+    EXPECT_EQ(m.bucket_count(), cap);
+    EXPECT_FALSE(m.contains(full));
+    for (int i = 0; i < full; ++i) EXPECT_EQ(m.at(i).value, i);
+
+    m.emplace(full, ThrowOnCopyMayThrowMove(full));
+    EXPECT_GT(m.bucket_count(), cap);
+    EXPECT_EQ(m.size(), static_cast<size_t>(full) + 1);
+
+    // 重哈希途中哈希函数抛出异常：已经算过哈希值的元素也没有被移走
+    mystl::flat_hash_map<int, mystl::string, CountdownHash> s;
+    for (int i = 0; i < 10; ++i) s.emplace(i, mystl::string(40, static_cast<char>('a' + i)));
+    CountdownHash::calls_left = 5;
+    EXPECT_THROW(s.rehash(200), std::runtime_error);
+    CountdownHash::calls_left = -1;
+    EXPECT_EQ(s.size(), 10u);
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(s.at(i), mystl::string(40, static_cast<char>('a' + i)));
+}
+
+TEST(FlatHashSetTest, Basic)
+{
+    // 两个整数参数不会匹配到迭代器范围构造函数
+    static_assert(!std::is_constructible<mystl::flat_hash_map<int, int>, int, int>::value, "");
+    static_assert(!std::is_constructible<mystl::flat_hash_set<int>, int, int>::value, "");
+    static_assert(std::is_constructible<mystl::flat_hash_set<int>, int*, int*>::value, "");
+
+    mystl::flat_hash_set<int> s{5, 1, 3, 5, 1};
+    EXPECT_EQ(s.size(), 3u);
+    EXPECT_TRUE(s.contains(3));
+    EXPECT_FALSE(s.insert(3).second);
+    EXPECT_TRUE(s.insert(4).second);
+    EXPECT_EQ(*s.find(4), 4);
+    EXPECT_EQ(s.erase(1), 1u);
+    EXPECT_EQ(s.count(1), 0u);
+
+    mystl::vector<int> v;
+    for (int i = 0; i < 10000; ++i) v.push_back(i % 2500);
+    mystl::flat_hash_set<int> t(v.begin(), v.end());
+    EXPECT_EQ(t.size(), 2500u);
+    int sum = 0;
+    for (int x : t) sum += x;
+    EXPECT_EQ(sum, 2499 * 2500 / 2);
+
+    mystl::flat_hash_set<mystl::string, StringHash> strs;
+    strs.emplace(3, 'a');
+    strs.insert(mystl::string("aaa"));
+    EXPECT_EQ(strs.size(), 1u);
+}
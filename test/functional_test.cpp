@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include "mystl/functional.hpp"
+#include "mystl/string.hpp"
+#include "mystl/unordered_map.hpp"
+#include "mystl/flat_hash_set.hpp"
+#include <cstring>
+#include <set>
+#include <tuple>
+
+namespace
+{
+    int popcount64(size_t x)
+    {
+        int n = 0;
+        for (; x; x &= x - 1) ++n;
+        return n;
+    }
+}
+
+// 整数哈希：连续或步长为 2 的幂的键取低位后也能分散
+TEST(HashTest, Integers)
+{
+    mystl::hash<size_t> hf;
+    std::set<size_t> seen;
+    for (size_t i = 0; i < 100000; ++i) seen.insert(hf(i));
+    EXPECT_EQ(seen.size(), 100000u);
+
+    std::set<size_t> low_bits;
+    for (size_t i = 0; i < 4096; ++i) low_bits.insert(hf(i << 16) & 1023);
+    EXPECT_GT(low_bits.size(), 950u);   // 随机映射的期望值约为 1005
+
+    // 同一个值在不同整数类型下哈希值相同
+    EXPECT_EQ(mystl::hash<int>()(42), mystl::hash<long>()(42));
+    EXPECT_EQ(mystl::hash<unsigned char>()('a'), mystl::hash<char>()('a'));
+    EXPECT_NE(mystl::hash<bool>()(true), mystl::hash<bool>()(false));
+}
+
+// 翻转输入的任意一位，输出平均约有一半的位发生变化
+TEST(HashTest, Avalanche)
+{
+    double total = 0;
+    int samples = 0;
+    for (size_t x = 1; x < 1000; x += 7)
+    {
+        const size_t h = mystl::hash_mix(x * 0x1234567ULL);
+        for (int bit = 0; bit < 64; ++bit)
+        {
+            total += popcount64(h ^ mystl::hash_mix((x * 0x1234567ULL) ^ (size_t(1) << bit)));
+            ++samples;
+        }
+    }
+    EXPECT_NEAR(total / samples, 32.0, 2.0);
+
+    for (size_t len : { 3, 8, 16, 33, 100 })
+    {
+        unsigned char buf[100] = {};
+        for (size_t i = 0; i < len; ++i) buf[i] = static_cast<unsigned char>(i * 31);
+        const size_t h = mystl::hash_bytes(buf, len);
+        total = 0;
+        for (size_t bit = 0; bit < len * 8; ++bit)
+        {
+            buf[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+            total += popcount64(h ^ mystl::hash_bytes(buf, len));
+            buf[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+        }
+        EXPECT_NEAR(total / (len * 8), 32.0, 3.0) << "len " << len;
+    }
+}
+
+// 字节哈希：覆盖短串、重叠读取和多路循环的每一个分支
+TEST(HashTest, Bytes)
+{
+    char buf[300];
+    for (int i = 0; i < 300; ++i) buf[i] = static_cast<char>(i * 7 + 1);
+
+    // 同一缓冲区的不同长度前缀哈希值互不相同
+    std::set<size_t> seen;
+    for (size_t len = 0; len <= 256; ++len) seen.insert(mystl::hash_bytes(buf, len));
+    EXPECT_EQ(seen.size(), 257u);
+
+    // 修改任意一个字节哈希值都会改变
+    for (size_t len : { 1, 2, 3, 4, 7, 8, 15, 16, 17, 47, 48, 49, 97, 200 })
+    {
+        const size_t h = mystl::hash_bytes(buf, len);
+        for (size_t i = 0; i < len; ++i)
+        {
+            buf[i] ^= 0x40;
+            EXPECT_NE(mystl::hash_bytes(buf, len), h) << "len " << len << " byte " << i;
+            buf[i] ^= 0x40;
+        }
+        EXPECT_EQ(mystl::hash_bytes(buf, len), h);
+    }
+
+    // 结果只取决于内容，与地址是否对齐无关；种子参与运算
+    char copy[300];
+    for (size_t offset = 1; offset < 8; ++offset)
+    {
+        std::memcpy(copy + offset, buf, 200);
+        EXPECT_EQ(mystl::hash_bytes(copy + offset, 200), mystl::hash_bytes(buf, 200));
+    }
+    EXPECT_NE(mystl::hash_bytes(buf, 64, 1), mystl::hash_bytes(buf, 64, 2));
+
+    mystl::string s("the quick brown fox jumps over the lazy dog");
+    EXPECT_EQ(mystl::hash<mystl::string>()(s), mystl::hash_bytes(s.data(), s.size()));
+    EXPECT_NE(mystl::hash<mystl::string>()(s), mystl::hash<mystl::string>()(mystl::string("the quick brown fox")));
+}
+
+TEST(HashTest, PointersAndFloats)
+{
+    int a[4] = {};
+    mystl::hash<int*> hp;
+    EXPECT_NE(hp(&a[0]), hp(&a[1]));
+    EXPECT_EQ(hp(&a[2]), hp(&a[2]));
+    EXPECT_EQ(mystl::hash<const char*>()("abc"), mystl::hash<const char*>()("abc"));
+
+    EXPECT_EQ(mystl::hash<double>()(0.0), mystl::hash<double>()(-0.0));
+    EXPECT_EQ(mystl::hash<float>()(0.0f), mystl::hash<float>()(-0.0f));
+    EXPECT_NE(mystl::hash<double>()(1.0), mystl::hash<double>()(2.0));
+    EXPECT_NE(mystl::hash<float>()(1.5f), mystl::hash<float>()(-1.5f));
+    EXPECT_EQ(mystl::hash<long double>()(0.5L), mystl::hash<double>()(0.5));
+}
+
+// pair / tuple 的哈希与成员顺序有关，可以直接作为哈希容器的键
+TEST(HashTest, Combinators)
+{
+    using P = mystl::pair<int, int>;
+    mystl::hash<P> hp;
+    EXPECT_NE(hp(P(1, 2)), hp(P(2, 1)));
+    EXPECT_NE(hp(P(0, 0)), hp(P(0, 1)));
+    EXPECT_EQ(hp(P(3, 4)), mystl::hash_values(3, 4));
+    EXPECT_EQ((mystl::hash<mystl::pair<const int, int>>()(mystl::pair<const int, int>(3, 4))), hp(P(3, 4)));
+    EXPECT_NE(mystl::hash_combine(1, 2), mystl::hash_combine(2, 1));
+
+    using T = std::tuple<int, double, mystl::string>;
+    mystl::hash<T> ht;
+    EXPECT_EQ(ht(T(1, 2.5, "x")), mystl::hash_values(1, 2.5, mystl::string("x")));
+    EXPECT_NE(ht(T(1, 2.5, "x")), ht(T(1, 2.5, "y")));
+
+    std::set<size_t> seen;
+    for (int i = 0; i < 100; ++i)
+    {
+        for (int j = 0; j < 100; ++j) seen.insert(hp(P(i, j)));
+    }
+    EXPECT_EQ(seen.size(), 10000u);
+
+    mystl::unordered_map<P, int> grid;
+    for (int i = 0; i < 30; ++i)
+    {
+        for (int j = 0; j < 30; ++j) grid[P(i, j)] = i * 30 + j;
+    }
+    EXPECT_EQ(grid.size(), 900u);
+    EXPECT_EQ(grid[P(7, 11)], 7 * 30 + 11);
+
+    mystl::flat_hash_set<mystl::string> words;
+    words.insert(mystl::string("alpha"));
+    words.insert(mystl::string("beta"));
+    words.insert(mystl::string("alpha"));
+    EXPECT_EQ(words.size(), 2u);
+    EXPECT_TRUE(words.contains(mystl::string("beta")));
+}
+
+// mystl::hash 的输出已经混合，哈希表不再重复调用 hash_mix；未声明的哈希函数仍会混合
+TEST(HashTest, Avalanching)
+{
+    struct IdentityHash
+    {
+        size_t operator()(int x) const { return static_cast<size_t>(x); }
+    };
+    EXPECT_TRUE(mystl::is_avalanching<mystl::hash<int>>::value);
+    EXPECT_TRUE(mystl::is_avalanching<mystl::hash<int*>>::value);
+    EXPECT_TRUE(mystl::is_avalanching<mystl::hash<double>>::value);
+    EXPECT_TRUE(mystl::is_avalanching<mystl::hash<mystl::string>>::value);
+    EXPECT_TRUE((mystl::is_avalanching<mystl::hash<mystl::pair<int, int>>>::value));
+    EXPECT_FALSE(mystl::is_avalanching<IdentityHash>::value);
+
+    mystl::flat_hash_set<int, IdentityHash> ids;
+    for (int i = 0; i < 1000; ++i) ids.insert(i << 16);
+    EXPECT_EQ(ids.size(), 1000u);
+    EXPECT_TRUE(ids.contains(999 << 16));
+}
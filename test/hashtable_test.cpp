@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
 #include "mystl/hashtable.hpp"
 #include "mystl/functional.hpp"
+#include "mystl/unordered_map.hpp"
+#include "mystl/unordered_set.hpp"
+#include "mystl/bucket_policy.hpp"
+#include "mystl/string.hpp"
+#include "mystl/vector.hpp"
+#include <random>
+#include <vector>
 #include "throw_on_copy.hpp"
 
 // 基本类型测试
@@ -128,6 +135,31 @@ TEST(HashtableTest, ExceptionSafety)
 }
 
 // 哈希冲突测试
+// 拷贝赋值中复制节点失败：目标表不变，仍可正常查找
+TEST(HashtableTest, CopyAssignExceptionSafety)
+{
+    using HT = mystl::hashtable<ThrowOnCopy, ThrowOnCopy, mystl::hash<ThrowOnCopy>,
+                               mystl::identity<ThrowOnCopy>, mystl::equal_to<ThrowOnCopy>>;
+    ThrowOnCopy::reset();
+    HT src(1000);
+    for (int i = 0; i < 50; ++i) src.insert_unique(ThrowOnCopy(i));
+    HT dst(10);
+    for (int i = 100; i < 105; ++i) dst.insert_unique(ThrowOnCopy(i));
+    const size_t buckets = dst.bucket_count();
+
+    ThrowOnCopy::should_throw = true;
+    EXPECT_THROW(dst = src, std::runtime_error);
+    ThrowOnCopy::should_throw = false;
+    EXPECT_EQ(dst.size(), 5u);
+    EXPECT_EQ(dst.bucket_count(), buckets);
+    for (int i = 100; i < 105; ++i) EXPECT_NE(dst.find(ThrowOnCopy(i)), dst.end());
+    EXPECT_EQ(dst.find(ThrowOnCopy(1)), dst.end());
+
+    dst = src;
+    EXPECT_EQ(dst.size(), 50u);
+    EXPECT_NE(dst.find(ThrowOnCopy(49)), dst.end());
+}
+
 TEST(HashtableTest, HashCollision) 
 {
     // 使用一个总是返回相同哈希值的哈希函数
@@ -154,4 +186,390 @@ TEST(HashtableTest, HashCollision)
         EXPECT_NE(it, ht.end());
         EXPECT_EQ(*it, i);
     }
-} 
\ No newline at end of file
+} 
+// 区间插入：一次扩容，节点按批分配
+TEST(HashtableTest, RangeInsert) 
+{
+    mystl::hashtable<int, int, mystl::hash<int>, 
+                    mystl::identity<int>, mystl::equal_to<int>> ht;
+    int values[1000];
+    for (int i = 0; i < 1000; ++i) values[i] = i % 500;
+
+    ht.insert_unique(values, values + 1000);
+    EXPECT_EQ(ht.size(), 500);
+    EXPECT_GE(ht.bucket_count(), 1000u);
+    for (int i = 0; i < 500; ++i) EXPECT_EQ(ht.count(i), 1);
+
+    ht.insert_equal(values, values + 10);
+    EXPECT_EQ(ht.size(), 510);
+    EXPECT_EQ(ht.count(3), 2);
+}
+
+// 区间插入中途抛出异常：已插入的元素保留
+TEST(HashtableTest, RangeInsertExceptionSafety) 
+{
+    using HT = mystl::hashtable<ThrowOnCopy, ThrowOnCopy, mystl::hash<ThrowOnCopy>,
+                               mystl::identity<ThrowOnCopy>, mystl::equal_to<ThrowOnCopy>>;
+    ThrowOnCopy values[100];
+    for (int i = 0; i < 100; ++i) values[i].value = i;
+
+    HT ht;
+    ThrowOnCopy::reset();
+    ht.insert_unique(values, values + 50);
+    ThrowOnCopy::should_throw = true;
+    EXPECT_THROW(ht.insert_unique(values + 50, values + 100), std::runtime_error);
+    ThrowOnCopy::reset();
+    EXPECT_EQ(ht.size(), 50);
+    EXPECT_NE(ht.find(ThrowOnCopy(49)), ht.end());
+}
+
+// 按迭代器、区间、键删除
+TEST(HashtableTest, Erase)
+{
+    using HT = mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>, mystl::equal_to<int>>;
+    HT ht;
+    for (int i = 0; i < 1000; ++i) ht.insert_unique(i);
+    ht.insert_equal(7);
+    ht.insert_equal(7);
+
+    EXPECT_EQ(ht.erase(7), 3u);
+    EXPECT_EQ(ht.erase(7), 0u);
+    EXPECT_EQ(ht.size(), 999u);
+    EXPECT_EQ(ht.find(7), ht.end());
+
+    // 遍历时删除所有偶数
+    for (auto it = ht.begin(); it != ht.end();)
+    {
+        if (*it % 2 == 0) it = ht.erase(it);
+        else ++it;
+    }
+    EXPECT_EQ(ht.size(), 499u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(ht.count(i), (i % 2 == 1 && i != 7) ? 1u : 0u);
+
+    // 删除区间
+    auto first = ht.begin();
+    auto last = first;
+    for (int i = 0; i < 10; ++i) ++last;
+    const int after = *last;
+    auto next = ht.erase(first, last);
+    EXPECT_EQ(*next, after);
+    EXPECT_EQ(ht.size(), 489u);
+    ht.erase(ht.begin(), ht.end());
+    EXPECT_TRUE(ht.empty());
+    EXPECT_EQ(ht.begin(), ht.end());
+}
+
+// 键引用被删除的元素
+TEST(HashtableTest, EraseKeyAliasesElement)
+{
+    mystl::unordered_map<int, int> m;
+    for (int i = 0; i < 100; ++i) m[i] = i * 10;
+    auto it = m.find(42);
+    EXPECT_EQ(m.erase(it->first), 1u);
+    EXPECT_EQ(m.count(42), 0u);
+    EXPECT_EQ(m.size(), 99u);
+}
+
+// reserve / rehash / 最大负载因子
+TEST(HashtableTest, ReserveAndRehash)
+{
+    using HT = mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>, mystl::equal_to<int>>;
+    HT ht;
+    EXPECT_FLOAT_EQ(ht.max_load_factor(), 1.0f);
+    ht.reserve(10000);
+    const size_t buckets = ht.bucket_count();
+    EXPECT_GE(buckets, 10000u);
+    for (int i = 0; i < 10000; ++i) ht.insert_unique(i);
+    EXPECT_EQ(ht.bucket_count(), buckets);
+    EXPECT_LE(ht.load_factor(), ht.max_load_factor());
+
+    // 降低最大负载因子立即扩容
+    ht.max_load_factor(0.25f);
+    EXPECT_GE(ht.bucket_count(), 40000u);
+    EXPECT_LE(ht.load_factor(), 0.25f);
+    EXPECT_THROW(ht.max_load_factor(0.0f), std::invalid_argument);
+
+    // 删除大部分元素后 rehash 可以缩小桶数，元素不变
+    for (int i = 100; i < 10000; ++i) ht.erase(i);
+    ht.max_load_factor(1.0f);
+    ht.rehash(0);
+    EXPECT_LT(ht.bucket_count(), buckets);
+    EXPECT_EQ(ht.size(), 100u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(ht.count(i), 1u);
+
+    // 负载因子大于 1 时每个桶平均多于一个元素
+    HT dense;
+    dense.max_load_factor(4.0f);
+    for (int i = 0; i < 1000; ++i) dense.insert_unique(i);
+    EXPECT_LE(dense.load_factor(), 4.0f);
+    EXPECT_LT(dense.bucket_count(), 1000u);
+}
+
+// unordered_map / unordered_set 的删除与预留接口
+TEST(HashtableTest, UnorderedContainers)
+{
+    // 两个整数参数不会匹配到迭代器范围构造函数
+    static_assert(!std::is_constructible<mystl::unordered_map<int, int>, int, int>::value, "");
+    static_assert(!std::is_constructible<mystl::unordered_set<int>, int, int>::value, "");
+    static_assert(std::is_constructible<mystl::unordered_set<int>, int*, int*>::value, "");
+
+    mystl::unordered_map<int, int> m;
+    m.reserve(500);
+    const size_t buckets = m.bucket_count();
+    for (int i = 0; i < 500; ++i) m[i] = i;
+    EXPECT_EQ(m.bucket_count(), buckets);
+    EXPECT_EQ(m.erase(3), 1u);
+    auto next = m.erase(m.find(4));
+    EXPECT_TRUE(next == m.end() || next->first != 4);
+    EXPECT_EQ(m.size(), 498u);
+    m.erase(m.begin(), m.end());
+    EXPECT_TRUE(m.empty());
+
+    mystl::unordered_set<int> s;
+    for (int i = 0; i < 50; ++i) s.insert(i);
+    s.max_load_factor(0.5f);
+    EXPECT_LE(s.load_factor(), 0.5f);
+    EXPECT_EQ(s.erase(10), 1u);
+    s.erase(s.find(11));
+    s.rehash(1000);
+    EXPECT_GE(s.bucket_count(), 1000u);
+    EXPECT_EQ(s.size(), 48u);
+    EXPECT_EQ(s.count(10) + s.count(11), 0u);
+}
+
+// 三种桶策略的插入、查找、删除与重哈希结果一致
+template <class Policy>
+void check_bucket_policy(bool power2)
+{
+    using HT = mystl::hashtable<size_t, size_t, mystl::hash<size_t>,
+                                mystl::identity<size_t>, mystl::equal_to<size_t>,
+                                mystl::allocator<size_t>, Policy>;
+    HT ht;
+    // 步长为 2 的幂的键：不混合哈希值时 2 的幂桶数会全部冲突
+    for (size_t i = 0; i < 5000; ++i) ht.insert_unique(i << 12);
+    for (size_t i = 0; i < 5000; i += 3) ht.erase(i << 12);
+    EXPECT_EQ(ht.size(), 5000u - 1667u);
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        EXPECT_EQ(ht.count(i << 12), i % 3 == 0 ? 0u : 1u);
+    }
+    EXPECT_EQ(ht.count(1), 0u);
+
+    const size_t n = ht.bucket_count();
+    if (power2) EXPECT_EQ(n & (n - 1), 0u);
+    else EXPECT_EQ(n, mystl::bucket_detail::next_prime(n));
+
+    // 迭代器能遍历到所有元素，缩小桶数后依然可以查到
+    size_t visited = 0;
+    for (auto it = ht.begin(); it != ht.end(); ++it) ++visited;
+    EXPECT_EQ(visited, ht.size());
+    ht.rehash(0);
+    HT copy(ht);
+    for (size_t i = 1; i < 5000; i += 3) EXPECT_EQ(copy.count(i << 12), 1u);
+
+    // 步长为 2 的幂的键也应分散到各个桶中，最长的桶链不应远超平均值
+    Policy policy;
+    const size_t buckets = Policy::next_size(5000);
+    policy.reset(buckets);
+    std::vector<size_t> lengths(buckets, 0);
+    mystl::hash<size_t> hf;
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        const size_t b = policy.index(hf(i << 12));
+        ASSERT_LT(b, buckets);
+        ++lengths[b];
+    }
+    size_t longest = 0;
+    for (size_t len : lengths) longest = mystl::max(longest, len);
+    EXPECT_LT(longest, 16u);
+}
+
+// 移动不分配内存也不抛出异常，mystl::vector 扩容时移动而不是复制其中的哈希表；移动后的表仍可使用
+TEST(HashtableTest, MoveLeavesEmptyTable)
+{
+    static_assert(std::is_nothrow_move_constructible<mystl::unordered_map<int, int>>::value, "");
+    static_assert(std::is_nothrow_move_constructible<mystl::unordered_set<mystl::string>>::value, "");
+
+    mystl::unordered_map<int, int> a;
+    for (int i = 0; i < 100; ++i) a[i] = i;
+    mystl::unordered_map<int, int> b(mystl::move(a));
+    EXPECT_EQ(b.size(), 100u);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.bucket_count(), 0u);
+    EXPECT_EQ(a.find(1), a.end());
+    EXPECT_EQ(a.count(1), 0u);
+    EXPECT_EQ(a.erase(1), 0u);
+    EXPECT_EQ(a.equal_range(1).first, a.end());
+    EXPECT_EQ(a.begin(), a.end());
+    a[7] = 70;
+    EXPECT_GT(a.bucket_count(), 0u);
+    EXPECT_EQ(a.size(), 1u);
+    EXPECT_EQ(a[7], 70);
+
+    mystl::vector<mystl::unordered_map<int, int>> maps(1);
+    maps[0][1] = 10;
+    const int* value = &maps[0].find(1)->second;
+    for (size_t i = maps.capacity(); i > 0; --i) maps.emplace_back();
+    EXPECT_EQ(&maps[0].find(1)->second, value);
+}
+
+TEST(HashtableTest, BucketPolicies)
+{
+    check_bucket_policy<mystl::prime_bucket_policy>(false);
+    check_bucket_policy<mystl::power2_bucket_policy>(true);
+    check_bucket_policy<mystl::fast_prime_bucket_policy>(false);
+
+    mystl::unordered_map<int, int, mystl::hash<int>, mystl::equal_to<int>,
+                         mystl::allocator<mystl::pair<const int, int>>,
+                         mystl::power2_bucket_policy> m;
+    for (int i = 0; i < 1000; ++i) m[i] = -i;
+    EXPECT_EQ(m.bucket_count() & (m.bucket_count() - 1), 0u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(m[i], -i);
+
+    // 2 的幂桶策略直接取低位；只有未混合的哈希函数由 hashtable 先混合一次
+    static_assert(mystl::bucket_policy_needs_mixed_hash<mystl::power2_bucket_policy>::value, "");
+    static_assert(!mystl::bucket_policy_needs_mixed_hash<mystl::prime_bucket_policy>::value, "");
+    static_assert(!mystl::bucket_policy_needs_mixed_hash<mystl::fast_prime_bucket_policy>::value, "");
+    mystl::power2_bucket_policy policy;
+    policy.reset(64);
+    EXPECT_EQ(policy.index(0x12345), 0x12345u & 63);
+
+    struct identity_hash
+    {
+        size_t operator()(size_t x) const { return x; }
+    };
+    using Identity = mystl::hashtable<size_t, size_t, identity_hash, mystl::identity<size_t>,
+                                      mystl::equal_to<size_t>, mystl::allocator<size_t>,
+                                      mystl::power2_bucket_policy>;
+    Identity ht;
+    for (size_t i = 0; i < 5000; ++i) ht.insert_unique(i << 12);
+    for (size_t i = 0; i < 5000; ++i) EXPECT_EQ(ht.count(i << 12), 1u);
+    EXPECT_EQ(ht.count(1), 0u);
+}
+
+// 预计算倒数的取模对 32 位哈希值与质数桶数和 % 完全一致
+TEST(HashtableTest, FastModuloMatchesModulo)
+{
+    std::mt19937_64 rng(42);
+    for (size_t prime : mystl::bucket_detail::PRIMES)
+    {
+        mystl::fast_prime_bucket_policy policy;
+        policy.reset(prime);
+        const size_t edges[] = { 0, 1, prime - 1, prime, prime + 1, 0xffffffffu };
+        for (size_t h : edges) EXPECT_EQ(policy.index(h), h % prime);
+        for (int i = 0; i < 10000; ++i)
+        {
+            const size_t h = static_cast<uint32_t>(rng());
+            ASSERT_EQ(policy.index(h), h % prime);
+        }
+    }
+}
+
+namespace
+{
+    // 统计调用次数的哈希函数与比较函数；不是 mystl::hash，默认会在节点中保存哈希值
+    struct counting_hash
+    {
+        static size_t calls;
+        size_t operator()(int x) const { ++calls; return mystl::hash<int>()(x); }
+    };
+    size_t counting_hash::calls = 0;
+
+    struct counting_equal
+    {
+        static size_t calls;
+        bool operator()(int a, int b) const { ++calls; return a == b; }
+    };
+    size_t counting_equal::calls = 0;
+
+    // 调用 calls_left 次之后抛出异常，为负时不抛出
+    struct countdown_hash
+    {
+        static inline int calls_left = -1;
+
+        size_t operator()(int x) const
+        {
+            if (calls_left == 0) throw std::runtime_error("Hash error");
+            if (calls_left > 0) --calls_left;
+            return mystl::hash<int>()(x);
+        }
+    };
+}
+
+// 节点保存哈希值后，重哈希、迭代、复制和删除都不再调用哈希函数，查找未命中时不调用 equals_
+TEST(HashtableTest, CachedHashCodes)
+{
+    static_assert(mystl::is_fast_hash<mystl::hash<int>>::value, "");
+    static_assert(mystl::is_fast_hash<mystl::hash<double*>>::value, "");
+    static_assert(!mystl::is_fast_hash<mystl::hash<mystl::string>>::value, "");
+    static_assert(!mystl::is_fast_hash<counting_hash>::value, "");
+
+    using HT = mystl::hashtable<int, int, counting_hash, mystl::identity<int>, counting_equal>;
+    static_assert(sizeof(HT::node_type) > sizeof(mystl::hashtable_node<int>), "");
+
+    counting_hash::calls = 0;
+    HT ht;
+    for (int i = 0; i < 1000; ++i) ht.insert_unique(i);
+    EXPECT_EQ(counting_hash::calls, 1000u);
+
+    ht.rehash(5000);
+    size_t visited = 0;
+    for (auto it = ht.begin(); it != ht.end(); ++it) ++visited;
+    EXPECT_EQ(visited, 1000u);
+    HT copy(ht);
+    copy.erase(copy.find(7));
+    EXPECT_EQ(counting_hash::calls, 1001u);   // 只有 find 计算了一次
+
+    counting_equal::calls = 0;
+    for (int i = 1000; i < 2000; ++i) EXPECT_EQ(ht.find(i), ht.end());
+    EXPECT_EQ(counting_equal::calls, 0u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(ht.count(i), 1u);
+    EXPECT_EQ(counting_equal::calls, 1000u);
+
+    // 复制和重哈希后保存的哈希值仍然正确
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(copy.count(i), i == 7 ? 0u : 1u);
+    int keys[] = { 1, 2, 2, 3 };
+    copy.insert_equal(keys, keys + 4);
+    EXPECT_EQ(copy.count(2), 3u);
+    EXPECT_EQ(copy.erase(2), 3u);
+
+    // 不保存哈希值时结果相同，迭代与重哈希需要重新计算
+    using Plain = mystl::hashtable<int, int, counting_hash, mystl::identity<int>, counting_equal,
+                                   mystl::allocator<int>, mystl::default_bucket_policy, false>;
+    counting_hash::calls = 0;
+    Plain plain;
+    for (int i = 0; i < 1000; ++i) plain.insert_unique(i);
+    const size_t after_insert = counting_hash::calls;
+    plain.rehash(5000);
+    EXPECT_GT(counting_hash::calls, after_insert);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(plain.count(i), 1u);
+
+    // 字符串键的容器默认保存哈希值
+    mystl::unordered_map<mystl::string, int> words;
+    words[mystl::string("alpha")] = 1;
+    words[mystl::string("beta")] = 2;
+    words.rehash(1000);
+    EXPECT_EQ(words[mystl::string("alpha")], 1);
+    EXPECT_EQ(words.count(mystl::string("gamma")), 0u);
+}
+
+// 不保存哈希值时重哈希途中哈希函数抛出异常：所有元素都留在原表中
+TEST(HashtableTest, RehashHashThrows)
+{
+    using HT = mystl::hashtable<int, int, countdown_hash, mystl::identity<int>, mystl::equal_to<int>,
+                                mystl::allocator<int>, mystl::default_bucket_policy, false>;
+    HT ht;
+    for (int i = 0; i < 50; ++i) ht.insert_unique(i);
+    const size_t buckets = ht.bucket_count();
+
+    countdown_hash::calls_left = 20;
+    EXPECT_THROW(ht.rehash(5000), std::runtime_error);
+    countdown_hash::calls_left = -1;
+    EXPECT_EQ(ht.size(), 50u);
+    EXPECT_EQ(ht.bucket_count(), buckets);
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(ht.count(i), 1u);
+
+    ht.rehash(5000);
+    EXPECT_GT(ht.bucket_count(), buckets);
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(ht.count(i), 1u);
+}
@@ -501,3 +501,32 @@ TEST(ListTest, EdgeCases)
     EXPECT_EQ(lst.front(), 1);
 }
 
+
+// 批量构建：超过一批节点的区间构造与插入
+TEST(ListTest, BulkConstruction)
+{
+    int values[300];
+    for (int i = 0; i < 300; ++i) values[i] = i;
+
+    mystl::list<int> lst(values, values + 300);
+    EXPECT_EQ(lst.size(), 300);
+    int expected = 0;
+    for (int x : lst) EXPECT_EQ(x, expected++);
+
+    auto pos = lst.begin();
+    ++pos;
+    lst.insert(pos, 150, -1);
+    lst.insert(lst.end(), values, values + 100);
+    EXPECT_EQ(lst.size(), 550);
+    EXPECT_EQ(lst.front(), 0);
+    EXPECT_EQ(*(++lst.begin()), -1);
+    EXPECT_EQ(lst.back(), 99);
+
+    mystl::list<int> copy(lst);
+    EXPECT_EQ(copy.size(), 550);
+    EXPECT_TRUE(copy == lst);
+
+    mystl::list<int> filled(130, 7);
+    EXPECT_EQ(filled.size(), 130);
+    EXPECT_EQ(filled.back(), 7);
+}
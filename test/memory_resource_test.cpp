@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "mystl/memory_resource.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/list.hpp"
+#include "mystl/deque.hpp"
+#include "mystl/rb_tree.hpp"
+#include "mystl/hashtable.hpp"
+#include "mystl/functional.hpp"
+
+namespace
+{
+    // 记录分配次数并转发给 upstream 的资源
+    class counting_resource : public mystl::memory_resource
+    {
+    private:
+        mystl::memory_resource* upstream_;
+
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            ++allocations;
+            bytes_live += bytes;
+            return upstream_->allocate(bytes, align);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t align) override
+        {
+            ++deallocations;
+            bytes_live -= bytes;
+            upstream_->deallocate(p, bytes, align);
+        }
+
+        bool do_is_equal(const mystl::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        size_t bytes_live = 0;
+
+        explicit counting_resource(mystl::memory_resource* upstream = mystl::new_delete_resource())
+            : upstream_(upstream) {}
+    };
+
+    using pmr_vector = mystl::vector<int, mystl::polymorphic_allocator<int>>;
+
+    // 不关心具体资源的业务代码
+    long fill_and_sum(pmr_vector& v, int n)
+    {
+        long sum = 0;
+        for (int i = 0; i < n; ++i)
+            v.push_back(i);
+        for (int x : v)
+            sum += x;
+        return sum;
+    }
+}
+
+// 各种资源的基本分配与对齐
+TEST(MemoryResourceTest, Resources)
+{
+    mystl::pool_resource pool;
+    mystl::monotonic_buffer_resource mono;
+    mystl::memory_resource* resources[] = {
+        mystl::new_delete_resource(), mystl::size_class_pool_resource(), &pool, &mono
+    };
+
+    for (auto r : resources)
+    {
+        void* small = r->allocate(24, 8);
+        void* big = r->allocate(5000, 16);
+        void* aligned = r->allocate(100, 128);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small) % 8, 0u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 16, 0u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 128, 0u);
+        r->deallocate(aligned, 100, 128);
+        r->deallocate(big, 5000, 16);
+        r->deallocate(small, 24, 8);
+        EXPECT_TRUE(*r == *r);
+    }
+
+    EXPECT_TRUE(*mystl::new_delete_resource() != pool);
+    EXPECT_TRUE(pool != mono);
+}
+
+// 默认资源可以替换和恢复
+TEST(MemoryResourceTest, DefaultResource)
+{
+    EXPECT_EQ(mystl::get_default_resource(), mystl::size_class_pool_resource());
+
+    counting_resource counter;
+    mystl::memory_resource* old = mystl::set_default_resource(&counter);
+    {
+        pmr_vector v;
+        v.push_back(1);
+        EXPECT_EQ(v.get_allocator().resource(), &counter);
+    }
+    EXPECT_GT(counter.allocations, 0u);
+    EXPECT_EQ(counter.bytes_live, 0u);
+
+    mystl::set_default_resource(nullptr);
+    EXPECT_EQ(mystl::get_default_resource(), old);
+}
+
+// 同一个容器类型在运行时使用不同的资源
+TEST(MemoryResourceTest, RuntimeSelection)
+{
+    counting_resource counter;
+    mystl::pool_resource pool;
+    mystl::monotonic_buffer_resource mono;
+
+    mystl::memory_resource* resources[] = { &counter, &pool, &mono };
+    for (auto r : resources)
+    {
+        pmr_vector v{mystl::polymorphic_allocator<int>(r)};
+        EXPECT_EQ(fill_and_sum(v, 1000), 999L * 1000 / 2);
+        EXPECT_EQ(v.get_allocator().resource(), r);
+    }
+    EXPECT_GT(counter.allocations, 0u);
+    EXPECT_EQ(counter.allocations, counter.deallocations);
+}
+
+// 所有节点容器都可以使用 polymorphic_allocator，节点分配经过同一个资源
+TEST(MemoryResourceTest, Containers)
+{
+    counting_resource counter;
+    mystl::polymorphic_allocator<int> alloc(&counter);
+
+    {
+        mystl::list<int, mystl::polymorphic_allocator<int>> l(alloc);
+        for (int i = 0; i < 100; ++i)
+            l.push_back(i);
+        EXPECT_EQ(l.size(), 100u);
+    }
+    {
+        mystl::deque<int, mystl::polymorphic_allocator<int>> d(alloc);
+        for (int i = 0; i < 1000; ++i)
+            d.push_front(i);
+        EXPECT_EQ(d.front(), 999);
+    }
+    {
+        mystl::rb_tree<int, mystl::less<int>, mystl::polymorphic_allocator<int>> tree(alloc);
+        for (int i = 0; i < 100; ++i)
+            tree.insert_unique(i);
+        auto copy = tree;
+        EXPECT_EQ(copy.size(), 100u);
+        EXPECT_EQ(copy.get_allocator().resource(), &counter);
+    }
+    {
+        mystl::hashtable<int, int, mystl::hash<int>, mystl::identity<int>,
+                         mystl::equal_to<int>, mystl::polymorphic_allocator<int>>
+            ht(10, mystl::hash<int>(), mystl::equal_to<int>(), alloc);
+        for (int i = 0; i < 100; ++i)
+            ht.insert_unique(i);
+        EXPECT_EQ(ht.size(), 100u);
+    }
+
+    EXPECT_GT(counter.allocations, 0u);
+    EXPECT_EQ(counter.allocations, counter.deallocations);
+    EXPECT_EQ(counter.bytes_live, 0u);
+}
+
+// 缓存行对齐的类型由内存池处理，超过页大小的对齐要求转交给 upstream
+TEST(MemoryResourceTest, OverAlignedGoesUpstream)
+{
+    struct alignas(64) line { char data[64]; };
+    struct alignas(8192) huge_page { char data[16]; };
+
+    counting_resource upstream;
+    mystl::pool_resource pool(&upstream);
+
+    mystl::polymorphic_allocator<line> lines(&pool);
+    line* p = lines.allocate(3);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+    EXPECT_EQ(upstream.allocations, 0u);
+    lines.deallocate(p, 3);
+
+    mystl::polymorphic_allocator<huge_page> pages(&pool);
+    huge_page* q = pages.allocate(1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(q) % 8192, 0u);
+    EXPECT_EQ(upstream.allocations, 1u);
+    pages.deallocate(q, 1);
+    EXPECT_EQ(upstream.deallocations, 1u);
+}
@@ -180,4 +180,46 @@ TEST(RBTreeTest, RBProperties)
     
     // 验证红节点的子节点为黑色
     // 注意：这需要访问内部节点，可能需要添加辅助函数
-} 
\ No newline at end of file
+} 
+// 区间插入：节点按批分配，重复元素不插入
+TEST(RBTreeTest, RangeInsert) 
+{
+    int values[200];
+    for (int i = 0; i < 200; ++i) values[i] = (i * 37) % 100;  // 0..99 各出现两次
+
+    mystl::rb_tree<int, mystl::less<int>> unique_tree;
+    unique_tree.insert_unique(values, values + 200);
+    EXPECT_EQ(unique_tree.size(), 100u);
+    int expected = 0;
+    for (int x : unique_tree) EXPECT_EQ(x, expected++);
+
+    mystl::rb_tree<int, mystl::less<int>> equal_tree;
+    equal_tree.insert_equal(values, values + 200);
+    equal_tree.insert_equal(values, values + 10);
+    EXPECT_EQ(equal_tree.size(), 210u);
+    EXPECT_EQ(equal_tree.count(values[0]), 3u);
+    int prev = -1;
+    for (int x : equal_tree) 
+    {
+        EXPECT_LE(prev, x);
+        prev = x;
+    }
+}
+
+// 区间插入中途抛出异常：已插入的元素保留，未使用的节点全部归还
+TEST(RBTreeTest, RangeInsertExceptionSafety) 
+{
+    ThrowOnCopy values[100];
+    for (int i = 0; i < 100; ++i) values[i].value = i;
+
+    mystl::rb_tree<ThrowOnCopy, mystl::less<ThrowOnCopy>> tree;
+    ThrowOnCopy::reset();
+    tree.insert_unique(values, values + 50);
+    EXPECT_EQ(tree.size(), 50u);
+
+    ThrowOnCopy::should_throw = true;
+    EXPECT_THROW(tree.insert_unique(values + 50, values + 100), std::runtime_error);
+    ThrowOnCopy::reset();
+    EXPECT_EQ(tree.size(), 50u);
+    EXPECT_EQ(tree.begin()->value, 0);
+}
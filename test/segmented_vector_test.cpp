@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+#include "mystl/segmented_vector.hpp"
+#include "mystl/algorithm.hpp"
+#include "mystl/string.hpp"
+#include "test_types.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// 构造与基本访问
+TEST(SegmentedVectorTest, Constructor)
+{
+    mystl::segmented_vector<int> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.capacity(), 0u);
+    EXPECT_EQ(empty.block_count(), 0u);
+    EXPECT_EQ(empty.begin(), empty.end());
+
+    mystl::segmented_vector<int> zeros(1000);
+    EXPECT_EQ(zeros.size(), 1000u);
+    EXPECT_EQ(mystl::count(zeros.begin(), zeros.end(), 0), 1000);
+
+    mystl::segmented_vector<mystl::string> filled(300, "x");
+    EXPECT_EQ(filled.front(), "x");
+    EXPECT_EQ(filled.back(), "x");
+
+    mystl::segmented_vector<int> list{1, 2, 3};
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(list[2], 3);
+
+    std::vector<int> src(5000);
+    for (int i = 0; i < 5000; ++i) src[i] = i;
+    mystl::segmented_vector<int> from_range(src.data(), src.data() + src.size());
+    EXPECT_TRUE(mystl::equal(from_range.begin(), from_range.end(), src.data()));
+
+    mystl::segmented_vector<int> copy(from_range);
+    EXPECT_EQ(copy, from_range);
+
+    // 移动构造接管块表，元素地址不变
+    const int* addr = &from_range[4000];
+    mystl::segmented_vector<int> moved(mystl::move(from_range));
+    EXPECT_EQ(&moved[4000], addr);
+    EXPECT_TRUE(from_range.empty());
+    EXPECT_EQ(moved, copy);
+
+    EXPECT_EQ(list.at(1), 2);
+    EXPECT_THROW(list.at(3), std::out_of_range);
+}
+
+// push_back 扩容只分配新块，已有元素的地址保持不变
+TEST(SegmentedVectorTest, StableAddresses)
+{
+    mystl::segmented_vector<int> v;
+    std::vector<const int*> addrs;
+    for (int i = 0; i < 100000; ++i)
+    {
+        v.push_back(i);
+        addrs.push_back(&v.back());
+    }
+    for (int i = 0; i < 100000; ++i)
+    {
+        ASSERT_EQ(&v[i], addrs[i]);
+        ASSERT_EQ(v[i], i);
+    }
+
+    // 块大小几何增长，块数是对数级的
+    EXPECT_LT(v.block_count(), 20u);
+    EXPECT_GE(v.capacity(), v.size());
+    EXPECT_LT(v.capacity(), 2 * v.size() + v.first_block_size);
+
+    // pop_back 与 clear 不释放块，重新追加时复用原来的地址
+    const int* first = &v[0];
+    size_t cap = v.capacity();
+    v.clear();
+    EXPECT_EQ(v.capacity(), cap);
+    v.push_back(7);
+    EXPECT_EQ(&v[0], first);
+}
+
+// 下标换算在块边界两侧都正确
+TEST(SegmentedVectorTest, BlockBoundaries)
+{
+    mystl::segmented_vector<int> v;
+    const size_t n = 20 * v.first_block_size + 3;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+
+    size_t start = 0;
+    for (size_t k = 0; start < n; ++k)
+    {
+        size_t len = v.first_block_size << k;
+        // 每块的首尾元素在同一块内连续
+        EXPECT_EQ(v[start], static_cast<int>(start));
+        if (start + len <= n)
+        {
+            EXPECT_EQ(&v[start + len - 1] - &v[start], static_cast<ptrdiff_t>(len - 1));
+        }
+        start += len;
+    }
+
+    // 迭代器跨块的前进、后退与跳转
+    auto it = v.begin();
+    for (size_t i = 0; i < n; ++i, ++it) ASSERT_EQ(*it, static_cast<int>(i));
+    EXPECT_EQ(it, v.end());
+    for (size_t i = n; i > 0; --i) ASSERT_EQ(*--it, static_cast<int>(i - 1));
+    EXPECT_EQ(it, v.begin());
+
+    for (size_t i : {size_t(0), v.first_block_size - 1, v.first_block_size, 3 * v.first_block_size, n - 1})
+    {
+        EXPECT_EQ(*(v.begin() + i), static_cast<int>(i));
+        EXPECT_EQ(v.begin()[i], static_cast<int>(i));
+        EXPECT_EQ(*(v.end() - static_cast<ptrdiff_t>(n - i)), static_cast<int>(i));
+        EXPECT_EQ((v.begin() + i) - v.begin(), static_cast<ptrdiff_t>(i));
+    }
+    EXPECT_EQ(v.end() - v.begin(), static_cast<ptrdiff_t>(n));
+
+    // 从 end() 后退一步得到最后一个元素
+    auto last = v.end();
+    --last;
+    EXPECT_EQ(*last, static_cast<int>(n - 1));
+
+    mystl::segmented_vector<int>::const_iterator cit = v.begin();
+    EXPECT_TRUE(cit == v.begin());
+    EXPECT_TRUE(v.begin() == cit);
+    EXPECT_TRUE(cit < v.end());
+
+    long long sum = 0;
+    for (auto r = v.rbegin(); r != v.rend(); ++r) sum += *r;
+    EXPECT_EQ(sum, static_cast<long long>(n) * (n - 1) / 2);
+}
+
+// 容量操作
+TEST(SegmentedVectorTest, Capacity)
+{
+    mystl::segmented_vector<int> v;
+    v.reserve(1000);
+    EXPECT_GE(v.capacity(), 1000u);
+    EXPECT_TRUE(v.empty());
+    size_t blocks = v.block_count();
+
+    v.resize(1000, 5);
+    EXPECT_EQ(v.block_count(), blocks);
+    EXPECT_EQ(mystl::count(v.begin(), v.end(), 5), 1000);
+    v.resize(10);
+    EXPECT_EQ(v.size(), 10u);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.block_count(), 1u);
+    EXPECT_EQ(v[9], 5);
+
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.block_count(), 0u);
+    EXPECT_EQ(v.capacity(), 0u);
+
+    v.assign(3, 4);
+    EXPECT_EQ(v, (mystl::segmented_vector<int>{4, 4, 4}));
+    v = {1, 2};
+    EXPECT_EQ(v.size(), 2u);
+
+    mystl::segmented_vector<int> w{9};
+    swap(v, w);
+    EXPECT_EQ(v[0], 9);
+    EXPECT_EQ(w[1], 2);
+    EXPECT_TRUE(v > w);
+    EXPECT_TRUE(w < v);
+    EXPECT_NE(v, w);
+
+    EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+}
+
+// 通过随机访问迭代器使用 mystl 算法
+TEST(SegmentedVectorTest, Algorithms)
+{
+    mystl::segmented_vector<int> v;
+    unsigned x = 1;
+    for (int i = 0; i < 10000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        v.push_back(static_cast<int>((x >> 16) % 1000));
+    }
+    std::vector<int> expected;
+    for (int value : v) expected.push_back(value);
+    std::sort(expected.begin(), expected.end());
+
+    mystl::sort(v.begin(), v.end());
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+    EXPECT_TRUE(mystl::equal(v.begin(), v.end(), expected.data()));
+
+    auto it = mystl::lower_bound(v.begin(), v.end(), 500);
+    EXPECT_EQ(*it, *std::lower_bound(expected.begin(), expected.end(), 500));
+    EXPECT_EQ(it - v.begin(), std::lower_bound(expected.begin(), expected.end(), 500) - expected.begin());
+
+    // 块之间不连续，copy / fill 不能整体 memmove / memset
+    mystl::segmented_vector<int> dst(v.size());
+    mystl::copy(v.begin(), v.end(), dst.begin());
+    EXPECT_EQ(dst, v);
+    mystl::reverse(dst.begin(), dst.end());
+    EXPECT_EQ(dst.front(), expected.back());
+
+    mystl::segmented_vector<char> chars(3000, 'a');
+    mystl::fill(chars.begin() + 100, chars.begin() + 2900, 'b');
+    EXPECT_EQ(mystl::count(chars.begin(), chars.end(), 'b'), 2800);
+    EXPECT_EQ(chars[99], 'a');
+    EXPECT_EQ(chars[2900], 'a');
+    EXPECT_EQ(mystl::find(chars.begin(), chars.end(), 'b') - chars.begin(), 100);
+}
+
+// 元素的生命周期与异常安全
+TEST(SegmentedVectorTest, ExceptionSafety)
+{
+    ThrowOnNthConstruction::reset();
+    {
+        mystl::segmented_vector<ThrowOnNthConstruction> v;
+        for (int i = 0; i < 1000; ++i) v.emplace_back(i);
+        EXPECT_EQ(LiveCounter::live, 1000);
+        v.pop_back();
+        EXPECT_EQ(LiveCounter::live, 999);
+        v.resize(100);
+        EXPECT_EQ(LiveCounter::live, 100);
+
+        // resize 中途失败时销毁已构造的新元素，原有元素不变
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 50;
+        EXPECT_THROW(v.resize(500), std::runtime_error);
+        EXPECT_EQ(v.size(), 100u);
+        EXPECT_EQ(LiveCounter::live, 100);
+
+        // emplace_back 失败时容器不变
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 1;
+        EXPECT_THROW(v.emplace_back(1), std::runtime_error);
+        EXPECT_EQ(v.size(), 100u);
+        EXPECT_EQ(v.back().value, 99);
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+
+    // 拷贝构造中途失败时不泄漏
+    ThrowOnNthConstruction::reset();
+    {
+        mystl::segmented_vector<ThrowOnNthConstruction> v(300);
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 200;
+        EXPECT_THROW(mystl::segmented_vector<ThrowOnNthConstruction> copy(v), std::runtime_error);
+        EXPECT_EQ(LiveCounter::live, 300);
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "mystl/small_vector.hpp"
+#include "mystl/string.hpp"
+#include "test_types.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    template<class SV>
+    void expect_elements(const SV& v, std::vector<int> expected)
+    {
+        ASSERT_EQ(v.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(v[i], expected[i]);
+        }
+    }
+} // namespace
+
+// 构造函数测试
+TEST(SmallVectorTest, Constructor)
+{
+    mystl::small_vector<int, 4> v1;
+    EXPECT_TRUE(v1.empty());
+    EXPECT_EQ(v1.capacity(), 4);
+    EXPECT_TRUE(v1.is_inline());
+
+    mystl::small_vector<int, 4> v2(3, 7);
+    expect_elements(v2, {7, 7, 7});
+    EXPECT_TRUE(v2.is_inline());
+
+    mystl::small_vector<int, 4> v3(6, 1);
+    EXPECT_EQ(v3.size(), 6);
+    EXPECT_FALSE(v3.is_inline());
+
+    mystl::small_vector<int, 4> v4{1, 2, 3, 4, 5};
+    expect_elements(v4, {1, 2, 3, 4, 5});
+
+    int arr[] = {9, 8};
+    mystl::small_vector<int, 4> v5(arr, arr + 2);
+    expect_elements(v5, {9, 8});
+
+    mystl::small_vector<int, 4> v6(5);
+    expect_elements(v6, {0, 0, 0, 0, 0});
+
+    mystl::small_vector<int, 4> v7(v4);
+    EXPECT_EQ(v7, v4);
+    mystl::small_vector<int, 4> v8(v5);
+    EXPECT_EQ(v8, v5);
+    EXPECT_TRUE(v8.is_inline());
+}
+
+// 不超过 N 个元素时不访问分配器，超过时整体搬到堆上
+TEST(SmallVectorTest, InlineThenSpill)
+{
+    mystl::small_vector<int, 8> v;
+    const int* inline_ptr = v.data();
+    for (int i = 0; i < 8; ++i) v.push_back(i);
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.data(), inline_ptr);
+    EXPECT_EQ(v.capacity(), 8);
+
+    v.push_back(8);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 16);
+    for (int i = 0; i < 9; ++i) EXPECT_EQ(v[i], i);
+
+    // 元素减少到 N 以内后 shrink_to_fit 搬回内部缓冲区
+    v.pop_back();
+    v.pop_back();
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 8);
+    expect_elements(v, {0, 1, 2, 3, 4, 5, 6});
+
+    v.reserve(4);
+    EXPECT_TRUE(v.is_inline());
+    v.reserve(100);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 100);
+    v.resize(50, 3);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 50);
+}
+
+// 插入与删除
+TEST(SmallVectorTest, InsertErase)
+{
+    mystl::small_vector<int, 8> v{1, 2, 3};
+    v.insert(v.begin() + 1, 10);
+    expect_elements(v, {1, 10, 2, 3});
+    v.insert(v.end() - 1, 3, 7);
+    expect_elements(v, {1, 10, 2, 7, 7, 7, 3});
+    v.emplace(v.begin(), 0);
+    expect_elements(v, {0, 1, 10, 2, 7, 7, 7, 3});
+    EXPECT_TRUE(v.is_inline());
+
+    // 容量不足时插入
+    int arr[] = {4, 5};
+    v.insert(v.begin() + 2, arr, arr + 2);
+    expect_elements(v, {0, 1, 4, 5, 10, 2, 7, 7, 7, 3});
+    EXPECT_FALSE(v.is_inline());
+
+    v.erase(v.begin() + 2, v.begin() + 4);
+    expect_elements(v, {0, 1, 10, 2, 7, 7, 7, 3});
+    v.erase(v.begin());
+    expect_elements(v, {1, 10, 2, 7, 7, 7, 3});
+
+    // 插入点之后的元素少于插入个数
+    mystl::small_vector<int, 8> w{1, 2, 3};
+    w.insert(w.end() - 1, {4, 5, 6});
+    expect_elements(w, {1, 2, 4, 5, 6, 3});
+    w.insert(w.end() - 1, 2, 9);
+    expect_elements(w, {1, 2, 4, 5, 6, 9, 9, 3});
+
+    // 插入本容器中的元素
+    mystl::small_vector<int, 8> s{1, 2, 3};
+    s.insert(s.begin(), s.begin() + 1, s.end());
+    expect_elements(s, {2, 3, 1, 2, 3});
+    s.insert(s.begin(), s.begin(), s.end());
+    expect_elements(s, {2, 3, 1, 2, 3, 2, 3, 1, 2, 3});
+    s.push_back(s[0]);
+    EXPECT_EQ(s.back(), 2);
+}
+
+// 复制、移动与交换，覆盖内部缓冲区与堆内存的各种组合
+TEST(SmallVectorTest, CopyMoveSwap)
+{
+    using sv = mystl::small_vector<mystl::string, 2>;
+    sv small{"a"};
+    sv big{"x", "y", "z"};
+
+    sv moved_small(mystl::move(small));
+    EXPECT_TRUE(small.empty());
+    ASSERT_EQ(moved_small.size(), 1);
+    EXPECT_EQ(moved_small[0], "a");
+
+    const mystl::string* big_data = big.data();
+    sv moved_big(mystl::move(big));
+    EXPECT_EQ(moved_big.data(), big_data);
+    EXPECT_TRUE(big.empty());
+    EXPECT_TRUE(big.is_inline());
+
+    sv a{"1", "2", "3", "4"};
+    sv b{"5"};
+    a.swap(b);
+    ASSERT_EQ(a.size(), 1);
+    ASSERT_EQ(b.size(), 4);
+    EXPECT_EQ(a[0], "5");
+    EXPECT_EQ(b[3], "4");
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_FALSE(b.is_inline());
+
+    a = b;
+    EXPECT_EQ(a, b);
+    a = sv{"q"};
+    ASSERT_EQ(a.size(), 1);
+    EXPECT_EQ(a[0], "q");
+    b = mystl::move(a);
+    ASSERT_EQ(b.size(), 1);
+    EXPECT_EQ(b[0], "q");
+    EXPECT_TRUE(b.is_inline());
+
+    a.assign({"m", "n", "o"});
+    EXPECT_EQ(a.size(), 3);
+    a.assign(1, "p");
+    ASSERT_EQ(a.size(), 1);
+    EXPECT_EQ(a[0], "p");
+    EXPECT_TRUE(a < sv{"q"});
+}
+
+// 所有元素都被正确析构
+TEST(SmallVectorTest, Lifetime)
+{
+    LiveCounter::live = 0;
+    {
+        mystl::small_vector<LiveCounter, 4> v;
+        for (int i = 0; i < 3; ++i) v.emplace_back(i);
+        mystl::small_vector<LiveCounter, 4> w(v);
+        for (int i = 0; i < 10; ++i) v.emplace_back(i);
+        v.insert(v.begin() + 2, 3, LiveCounter(5));
+        v.erase(v.begin(), v.begin() + 5);
+        v.resize(2);
+        v.shrink_to_fit();
+        w = mystl::move(v);
+        v.swap(w);
+        v.resize(20);
+        w.clear();
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+}
+
+// 扩容失败时保持原数据不变
+TEST(SmallVectorTest, ExceptionSafety)
+{
+    mystl::small_vector<ThrowOnCopyMayThrowMove, 2> v;
+    v.emplace_back(1);
+    v.emplace_back(2);
+    EXPECT_TRUE(v.is_inline());
+
+    ThrowOnCopyMayThrowMove::should_throw = true;
+    EXPECT_THROW(v.emplace_back(3), std::runtime_error);
+    EXPECT_THROW(v.insert(v.begin(), 2, ThrowOnCopyMayThrowMove(4)), std::runtime_error);
+    EXPECT_THROW(v.reserve(10), std::runtime_error);
+    ThrowOnCopyMayThrowMove::should_throw = false;
+
+    EXPECT_TRUE(v.is_inline());
+    ASSERT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0].value, 1);
+    EXPECT_EQ(v[1].value, 2);
+
+    // 堆上需要更大的空间时 assign 同样不改变原数据
+    v.reserve(4);
+    ThrowOnCopyMayThrowMove src[8];
+    ThrowOnCopyMayThrowMove::should_throw = true;
+    EXPECT_THROW(v.assign(src, src + 8), std::runtime_error);
+    ThrowOnCopyMayThrowMove::should_throw = false;
+    ASSERT_EQ(v.size(), 2);
+    EXPECT_EQ(v[1].value, 2);
+}
+
+// 超对齐元素的内部缓冲区同样满足对齐要求
+TEST(SmallVectorTest, Alignment)
+{
+    struct alignas(32) Wide
+    {
+        double d[4];
+    };
+    mystl::small_vector<Wide, 3> v(2);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 32, 0);
+    static_assert(!mystl::is_trivially_relocatable_v<mystl::small_vector<int, 4>>);
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "mystl/soa_vector.hpp"
+#include "mystl/vector.hpp"
+#include "mystl/string.hpp"
+#include "mystl/algorithm.hpp"
+#include "test_types.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+
+namespace
+{
+    bool aligned(const void* p)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) % mystl::soa_vector<int>::column_alignment == 0;
+    }
+} // namespace
+
+// 整行追加与按行访问
+TEST(SoaVectorTest, PushBackAndAccess)
+{
+    mystl::soa_vector<int, double, char> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.begin(), v.end());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i % 2 == 0)
+            v.emplace_back(i, i * 0.5, static_cast<char>('a' + i % 26));
+        else
+            v.push_back(std::make_tuple(i, i * 0.5, static_cast<char>('a' + i % 26)));
+    }
+    ASSERT_EQ(v.size(), 1000u);
+    EXPECT_GE(v.capacity(), 1000u);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto row = v[i];
+        ASSERT_EQ(row.get<0>(), i);
+        ASSERT_EQ(mystl::get<1>(row), i * 0.5);
+        ASSERT_EQ(row.get<2>(), static_cast<char>('a' + i % 26));
+    }
+    EXPECT_EQ(v.front(), std::make_tuple(0, 0.0, 'a'));
+    EXPECT_EQ(v.back().get<0>(), 999);
+    EXPECT_THROW(v.at(1000), std::out_of_range);
+
+    // 通过代理引用写回
+    v[3].get<0>() = 42;
+    v[4] = std::make_tuple(7, 7.5, 'z');
+    v[5] = v[4];
+    EXPECT_EQ(v.data<0>()[3], 42);
+    EXPECT_EQ(v[5], std::make_tuple(7, 7.5, 'z'));
+    std::tuple<int, double, char> copy = v[5];
+    EXPECT_EQ(std::get<1>(copy), 7.5);
+
+    auto r = v.emplace_back(1, 2.0, 'c');
+    EXPECT_EQ(r.get<2>(), 'c');
+
+    v.pop_back();
+    EXPECT_EQ(v.size(), 1000u);
+    const auto& cv = v;
+    mystl::soa_vector<int, double, char>::const_reference cr = cv[5];
+    EXPECT_EQ(cr.get<0>(), 7);
+}
+
+// 每一列是连续、按缓存行对齐的数组
+TEST(SoaVectorTest, Columns)
+{
+    mystl::soa_vector<char, double, int16_t> v;
+    for (int i = 0; i < 300; ++i) v.emplace_back(static_cast<char>(i), i * 2.0, static_cast<int16_t>(-i));
+
+    auto chars = v.column<0>();
+    auto doubles = v.column<1>();
+    auto shorts = v.column<2>();
+    EXPECT_EQ(chars.size(), 300u);
+    EXPECT_TRUE(aligned(chars.data()));
+    EXPECT_TRUE(aligned(doubles.data()));
+    EXPECT_TRUE(aligned(shorts.data()));
+
+    double sum = 0;
+    for (double d : doubles) sum += d;
+    EXPECT_EQ(sum, 299.0 * 300.0);
+    EXPECT_EQ(shorts[299], -299);
+    EXPECT_EQ(&doubles.back() - &doubles.front(), 299);
+
+    // 列迭代器是原生指针，修改直接作用于容器
+    mystl::fill(chars.begin(), chars.end(), 'x');
+    EXPECT_EQ(v[123].get<0>(), 'x');
+    const auto& cv = v;
+    EXPECT_EQ(mystl::count(cv.column<0>().begin(), cv.column<0>().end(), 'x'), 300);
+    EXPECT_TRUE((mystl::is_same_v<decltype(cv.column<1>().data()), const double*>));
+}
+
+// 行迭代器可用于 mystl 的排序与查找算法
+TEST(SoaVectorTest, Algorithms)
+{
+    mystl::soa_vector<int, mystl::string> v;
+    unsigned x = 7;
+    for (int i = 0; i < 2000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        int key = static_cast<int>((x >> 16) % 500);
+        v.emplace_back(key, mystl::string(1, static_cast<char>('a' + key % 26)));
+    }
+
+    // 默认按整行字典序
+    mystl::sort(v.begin(), v.end());
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        // 排序时整行一起移动，各列保持对应关系
+        ASSERT_EQ(v[i].get<1>()[0], static_cast<char>('a' + v[i].get<0>() % 26));
+    }
+
+    // 自定义比较函数同时接受代理引用和 tuple
+    auto by_key_desc = [](const auto& a, const auto& b) { return mystl::get<0>(a) > mystl::get<0>(b); };
+    mystl::sort(v.begin(), v.end(), by_key_desc);
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end(), by_key_desc));
+    for (int key : v.column<0>()) EXPECT_LE(key, v.front().get<0>());
+
+    mystl::reverse(v.begin(), v.end());
+    auto it = mystl::lower_bound(v.begin(), v.end(), std::make_tuple(250, mystl::string()));
+    EXPECT_GE((*it).get<0>(), 250);
+    EXPECT_LT((*(it - 1)).get<0>(), 250);
+
+    mystl::iter_swap(v.begin(), v.end() - 1);
+    EXPECT_GT(v[0].get<0>(), v[1].get<0>());
+    swap(v[0], v[v.size() - 1]);
+    EXPECT_TRUE(mystl::is_sorted(v.begin(), v.end()));
+
+    auto found = mystl::find_if(v.cbegin(), v.cend(), [](const auto& row) { return row.template get<0>() >= 400; });
+    EXPECT_NE(found, v.cend());
+    EXPECT_EQ(found - v.cbegin(), mystl::lower_bound(v.column<0>().begin(), v.column<0>().end(), 400) - v.data<0>());
+
+    size_t rows = 0;
+    for (auto r = v.rbegin(); r != v.rend(); ++r) ++rows;
+    EXPECT_EQ(rows, v.size());
+}
+
+// 容量操作与拷贝、移动
+TEST(SoaVectorTest, CapacityAndCopy)
+{
+    mystl::soa_vector<int, mystl::string> v{{1, "one"}, {2, "two"}, {3, "three"}};
+    EXPECT_EQ(v.size(), 3u);
+
+    v.reserve(100);
+    EXPECT_EQ(v.capacity(), 100u);
+    EXPECT_EQ(v[2].get<1>(), "three");
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 3u);
+
+    v.resize(5);
+    EXPECT_EQ(v[4], std::make_tuple(0, mystl::string()));
+    v.resize(2);
+    EXPECT_EQ(v.size(), 2u);
+
+    mystl::soa_vector<int, mystl::string> copy(v);
+    EXPECT_EQ(copy, v);
+    copy[0].get<1>() = "uno";
+    EXPECT_NE(copy, v);
+
+    const int* column = v.data<0>();
+    mystl::soa_vector<int, mystl::string> moved(mystl::move(v));
+    EXPECT_EQ(moved.data<0>(), column);
+    EXPECT_TRUE(v.empty());
+
+    v = copy;
+    EXPECT_EQ(v, copy);
+    swap(v, moved);
+    EXPECT_EQ(moved, copy);
+
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 0u);
+    EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+}
+
+// 任一列构造或搬迁失败时容器不变，不泄漏
+TEST(SoaVectorTest, ExceptionSafety)
+{
+    ThrowOnNthConstruction::reset();
+    {
+        mystl::soa_vector<int, ThrowOnNthConstruction> v;
+        ThrowOnNthConstruction item(1);
+        for (int i = 0; i < 10; ++i) v.emplace_back(i, item);
+        EXPECT_EQ(LiveCounter::live, 11);
+
+        // 第二列复制失败：第一列已构造的元素被销毁
+        v.shrink_to_fit();
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 1;
+        EXPECT_THROW(v.emplace_back(10, item), std::runtime_error);
+        EXPECT_EQ(v.size(), 10u);
+        EXPECT_EQ(LiveCounter::live, 11);
+
+        // 扩容时搬迁失败（复制构造可能抛出，只能复制）：原数据不变
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 5;
+        EXPECT_THROW(v.reserve(64), std::runtime_error);
+        EXPECT_EQ(v.capacity(), 10u);
+        EXPECT_EQ(LiveCounter::live, 11);
+
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 3;
+        EXPECT_THROW((mystl::soa_vector<int, ThrowOnNthConstruction>(v)), std::runtime_error);
+        EXPECT_EQ(LiveCounter::live, 11);
+
+        ThrowOnNthConstruction::throw_at = -1;
+        v.emplace_back(10, item);
+        EXPECT_EQ(v.size(), 11u);
+        EXPECT_EQ(v[10].get<1>().value, 1);
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+
+    // 列之间异常规格不同：只要有一列可能抛出，所有列都复制，先处理的列不会被移走
+    {
+        mystl::soa_vector<CountingMove, ThrowOnNthConstruction> v;
+        ThrowOnNthConstruction item(1);
+        for (int i = 0; i < 4; ++i) v.emplace_back(i, item);
+        v.shrink_to_fit();
+
+        // 新行的复制成功，搬迁第二列时失败
+        ThrowOnNthConstruction::throw_at = ThrowOnNthConstruction::constructed + 3;
+        EXPECT_THROW(v.emplace_back(4, item), std::runtime_error);
+        ThrowOnNthConstruction::throw_at = -1;
+        ASSERT_EQ(v.size(), 4u);
+        EXPECT_EQ(v.capacity(), 4u);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(v[i].get<0>().value, i);
+            EXPECT_EQ(v[i].get<1>().value, 1);
+        }
+        EXPECT_EQ(LiveCounter::live, 5);
+    }
+    EXPECT_EQ(LiveCounter::live, 0);
+}
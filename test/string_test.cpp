@@ -382,4 +382,39 @@ TEST(StringTest, EdgeCases)
     EXPECT_NO_THROW(s.insert(0, ""));
     EXPECT_NO_THROW(s.append(""));
     EXPECT_NO_THROW(s.replace(0, 0, ""));
-} 
\ No newline at end of file
+} 
+// 增长策略
+TEST(StringTest, GrowthPolicy)
+{
+    mystl::string s;
+    for (int i = 0; i < 100; ++i) s.push_back('a');
+    EXPECT_EQ(s.size(), 100);
+
+    // 1.5 倍增长
+    mystl::basic_string<mystl::growth_x1_5> t;
+    size_t reallocations = 0;
+    size_t last_capacity = t.capacity();
+    for (int i = 0; i < 10000; ++i)
+    {
+        t.push_back(static_cast<char>('a' + i % 26));
+        if (t.capacity() != last_capacity)
+        {
+            ++reallocations;
+            EXPECT_LE(t.capacity() + 1, (last_capacity + 1) * 3 / 2 + 2);
+            last_capacity = t.capacity();
+        }
+    }
+    EXPECT_GT(reallocations, 10u);
+    EXPECT_EQ(t.size(), 10000);
+    EXPECT_EQ(t[26], 'a');
+
+    // 取整到尺寸等级：append、insert、replace 之后容量（含 '\0'）是 ALIGN 的倍数
+    mystl::basic_string<mystl::growth_size_class> u("x");
+    u.append("hello");
+    EXPECT_EQ((u.capacity() + 1) % mystl::MemoryPool<char>::ALIGN, 0u);
+    u.insert(0, "0123456789abcdef");
+    u.replace(0, 1, "ZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZ");
+    EXPECT_EQ((u.capacity() + 1) % mystl::MemoryPool<char>::ALIGN, 0u);
+    EXPECT_EQ(u.substr(u.size() - 6), "xhello");
+    EXPECT_EQ(u + "!", u + mystl::basic_string<mystl::growth_size_class>("!"));
+}
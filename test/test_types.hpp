@@ -0,0 +1,122 @@
+#pragma once
+#include <stdexcept>
+#include "mystl/type_traits.hpp"
+#include "mystl/util.hpp"
+
+// 统计存活对象个数，检查容器析构了所有元素
+struct LiveCounter
+{
+    static inline int live = 0;
+    int value;
+
+    LiveCounter(int v = 0) : value(v) { ++live; }
+    LiveCounter(const LiveCounter& other) : value(other.value) { ++live; }
+    LiveCounter(LiveCounter&& other) noexcept : value(other.value) { ++live; }
+    LiveCounter& operator=(const LiveCounter& other) { value = other.value; return *this; }
+    LiveCounter& operator=(LiveCounter&& other) noexcept { value = other.value; return *this; }
+    ~LiveCounter() { --live; }
+};
+
+// 复制可以按需抛出异常；移动构造未声明 noexcept，容器扩容或重哈希时只能复制
+struct ThrowOnCopyMayThrowMove
+{
+    static inline bool should_throw = false;
+    int value;
+
+    ThrowOnCopyMayThrowMove(int v = 0) noexcept : value(v) {}
+    ThrowOnCopyMayThrowMove(const ThrowOnCopyMayThrowMove& other) : value(other.value)
+    {
+        if (should_throw) throw std::runtime_error("Copy error");
+    }
+    ThrowOnCopyMayThrowMove(ThrowOnCopyMayThrowMove&& other) : value(other.value) {}
+    ThrowOnCopyMayThrowMove& operator=(const ThrowOnCopyMayThrowMove& other)
+    {
+        if (should_throw) throw std::runtime_error("Assignment error");
+        value = other.value;
+        return *this;
+    }
+    ThrowOnCopyMayThrowMove& operator=(ThrowOnCopyMayThrowMove&& other) noexcept
+    {
+        value = other.value;
+        return *this;
+    }
+};
+
+// 第 throw_at 次构造（含复制）时抛出异常；未声明移动构造，搬迁只能复制。
+// 异常在基类构造完成后抛出，存活计数由基类析构回退
+struct ThrowOnNthConstruction : LiveCounter
+{
+    static inline int constructed = 0;
+    static inline int throw_at = -1;
+
+    ThrowOnNthConstruction(int v = 0) : LiveCounter(v) { check(); }
+    ThrowOnNthConstruction(const ThrowOnNthConstruction& other) : LiveCounter(other) { check(); }
+    ThrowOnNthConstruction& operator=(const ThrowOnNthConstruction&) = default;
+
+    bool operator==(const ThrowOnNthConstruction& other) const { return value == other.value; }
+
+    static void check()
+    {
+        if (++constructed == throw_at) throw std::runtime_error("ThrowOnNthConstruction");
+    }
+
+    static void reset()
+    {
+        live = 0;
+        constructed = 0;
+        throw_at = -1;
+    }
+};
+
+// 统计复制与移动次数；移动构造 noexcept，扩容时应移动而非复制
+struct CountingMove
+{
+    static inline int copies = 0;
+    static inline int moves = 0;
+    int value;
+
+    CountingMove(int v = 0) noexcept : value(v) {}
+    CountingMove(const CountingMove& other) : value(other.value) { ++copies; }
+    CountingMove(CountingMove&& other) noexcept : value(other.value) { ++moves; other.value = -1; }
+    CountingMove& operator=(const CountingMove& other) { value = other.value; ++copies; return *this; }
+    CountingMove& operator=(CountingMove&& other) noexcept { value = other.value; ++moves; return *this; }
+
+    static void reset() { copies = 0; moves = 0; }
+};
+
+// 可能抛异常的移动构造：扩容时必须复制
+struct CountingThrowingMove
+{
+    static inline int copies = 0;
+    static inline int moves = 0;
+    int value;
+
+    CountingThrowingMove(int v = 0) noexcept : value(v) {}
+    CountingThrowingMove(const CountingThrowingMove& other) : value(other.value) { ++copies; }
+    CountingThrowingMove(CountingThrowingMove&& other) : value(other.value) { ++moves; }
+
+    static void reset() { copies = 0; moves = 0; }
+};
+
+// 选择加入可平凡重定位的类型：扩容时既不复制也不移动
+struct RelocatableCounter
+{
+    static inline int copies = 0;
+    static inline int moves = 0;
+    int* data;
+
+    RelocatableCounter(int v = 0) : data(new int(v)) {}
+    RelocatableCounter(const RelocatableCounter& other) : data(new int(*other.data)) { ++copies; }
+    RelocatableCounter(RelocatableCounter&& other) noexcept : data(other.data) { other.data = nullptr; ++moves; }
+    RelocatableCounter& operator=(const RelocatableCounter& other) { *data = *other.data; ++copies; return *this; }
+    RelocatableCounter& operator=(RelocatableCounter&& other) noexcept { mystl::swap(data, other.data); ++moves; return *this; }
+    ~RelocatableCounter() { delete data; }
+
+    static void reset() { copies = 0; moves = 0; }
+};
+
+namespace mystl
+{
+    template<>
+    struct is_trivially_relocatable<RelocatableCounter> : true_type {};
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "mystl/vector.hpp"
+#include "mystl/string.hpp"
+#include "test_types.hpp"
 #include <memory>
 #include <ostream>
 #include <stdexcept>
@@ -328,8 +330,8 @@ struct VectorThrowOnCopy
         return *this;
     }
     
-    // 移动操作不抛出异常
-    VectorThrowOnCopy (VectorThrowOnCopy && other) noexcept 
+    // 移动构造未声明 noexcept，扩容时 vector 只能拷贝旧元素以保证强异常安全
+    VectorThrowOnCopy (VectorThrowOnCopy && other) 
         : value(other.value) {}
     
     VectorThrowOnCopy & operator=(VectorThrowOnCopy && other) noexcept 
@@ -469,6 +471,35 @@ TEST(VectorTest, InsertSelfReference)
     }
 }
 
+// 容量足够、插入点之后的元素少于插入个数时不能越界
+TEST(VectorTest, InsertNearEndWithinCapacity)
+{
+    mystl::vector<int> vec = {1, 2, 3};
+    vec.reserve(16);
+    vec.insert(vec.end() - 1, 4, 9);
+    std::vector<int> expected = {1, 2, 9, 9, 9, 9, 3};
+    ASSERT_EQ(vec.size(), expected.size());
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        EXPECT_EQ(vec[i], expected[i]);
+    }
+
+    int arr[] = {7, 8, 6};
+    vec.insert(vec.end() - 2, arr, arr + 3);
+    expected = {1, 2, 9, 9, 9, 7, 8, 6, 9, 3};
+    ASSERT_EQ(vec.size(), expected.size());
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        EXPECT_EQ(vec[i], expected[i]);
+    }
+
+    mystl::vector<int> empty;
+    empty.reserve(8);
+    empty.insert(empty.end(), 3, 5);
+    EXPECT_EQ(empty.size(), 3);
+    EXPECT_EQ(empty[2], 5);
+}
+
 // 测试移动语义的异常安全性
 TEST(VectorTest, MoveExceptionSafety) 
 {
@@ -757,3 +788,293 @@ TEST(VectorTest, Alignment)
         EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % alignof(NaturalAligned), 0);
     }
 } 
+
+// 扩容时元素的搬迁方式：移动构造不抛异常时移动，否则复制
+TEST(VectorTest, RelocationTraits)
+{
+    static_assert(mystl::is_trivially_relocatable_v<int>);
+    static_assert(mystl::is_trivially_relocatable_v<mystl::string>);
+    static_assert(mystl::is_trivially_relocatable_v<mystl::vector<int>>);
+    static_assert(mystl::is_trivially_relocatable_v<mystl::vector<mystl::string>>);
+    static_assert(!mystl::is_trivially_relocatable_v<CountingMove>);
+    static_assert(mystl::is_trivially_relocatable_v<RelocatableCounter>);
+}
+
+TEST(VectorTest, GrowthMovesNothrowMovable)
+{
+    mystl::vector<CountingMove> vec;
+    CountingMove::reset();
+    for (int i = 0; i < 100; ++i) vec.emplace_back(i);
+    EXPECT_EQ(CountingMove::copies, 0);
+    EXPECT_GT(CountingMove::moves, 0);
+
+    CountingMove::reset();
+    vec.reserve(1000);
+    EXPECT_EQ(CountingMove::copies, 0);
+    EXPECT_EQ(CountingMove::moves, 100);
+
+    CountingMove::reset();
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 100);
+    EXPECT_EQ(CountingMove::copies, 0);
+
+    // 插入点两侧的元素都被移动到新空间
+    CountingMove::reset();
+    CountingMove extra(-5);
+    vec.insert(vec.begin() + 50, extra);
+    EXPECT_EQ(CountingMove::copies, 1);
+    EXPECT_EQ(CountingMove::moves, 100);
+    ASSERT_EQ(vec.size(), 101);
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(vec[i].value, i);
+    EXPECT_EQ(vec[50].value, -5);
+    for (int i = 50; i < 100; ++i) EXPECT_EQ(vec[i + 1].value, i);
+}
+
+TEST(VectorTest, GrowthCopiesWhenMoveMayThrow)
+{
+    mystl::vector<CountingThrowingMove> vec;
+    for (int i = 0; i < 10; ++i) vec.emplace_back(i);
+
+    CountingThrowingMove::reset();
+    vec.reserve(vec.capacity() + 1);
+    EXPECT_EQ(CountingThrowingMove::copies, 10);
+    EXPECT_EQ(CountingThrowingMove::moves, 0);
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(vec[i].value, i);
+}
+
+TEST(VectorTest, GrowthRelocatesTriviallyRelocatable)
+{
+    {
+        mystl::vector<RelocatableCounter> vec;
+        RelocatableCounter::reset();
+        for (int i = 0; i < 128; ++i) vec.emplace_back(i);
+        ASSERT_EQ(vec.capacity(), 128);
+        vec.insert(vec.begin(), 2, RelocatableCounter(-1));
+        vec.shrink_to_fit();
+        // 只有 insert 填充的两个副本，扩容本身没有复制和移动
+        EXPECT_EQ(RelocatableCounter::copies, 2);
+        EXPECT_EQ(RelocatableCounter::moves, 0);
+        ASSERT_EQ(vec.size(), 130);
+        EXPECT_EQ(*vec[0].data, -1);
+        EXPECT_EQ(*vec[1].data, -1);
+        for (int i = 0; i < 128; ++i) EXPECT_EQ(*vec[i + 2].data, i);
+    }
+
+    // 嵌套容器按字节搬迁后仍然有效
+    mystl::vector<mystl::vector<int>> nested;
+    for (int i = 0; i < 50; ++i) nested.push_back(mystl::vector<int>(i, i));
+    for (int i = 0; i < 50; ++i)
+    {
+        ASSERT_EQ(nested[i].size(), static_cast<size_t>(i));
+        for (int x : nested[i]) EXPECT_EQ(x, i);
+    }
+}
+
+// 可能抛异常的移动构造下，扩容时复制失败需要保持原数据不变
+TEST(VectorTest, GrowthStrongGuarantee)
+{
+    mystl::vector<VectorThrowOnCopy> vec;
+    VectorThrowOnCopy::reset();
+    for (int i = 0; i < 8; ++i) vec.emplace_back(i);
+    size_t old_capacity = vec.capacity();
+    const VectorThrowOnCopy* old_data = vec.data();
+
+    VectorThrowOnCopy::should_throw = true;
+    EXPECT_THROW(vec.reserve(old_capacity * 4), std::runtime_error);
+    EXPECT_THROW(vec.emplace(vec.begin() + 3, 100), std::runtime_error);
+    VectorThrowOnCopy::reset();
+
+    EXPECT_EQ(vec.data(), old_data);
+    EXPECT_EQ(vec.capacity(), old_capacity);
+    ASSERT_EQ(vec.size(), 8);
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(vec[i].value, i);
+}
+
+TEST(VectorTest, UninitializedRelocate)
+{
+    mystl::allocator<CountingMove> alloc;
+    CountingMove* src = alloc.allocate(4);
+    CountingMove* dst = alloc.allocate(4);
+    for (int i = 0; i < 4; ++i) mystl::construct(src + i, i);
+
+    CountingMove::reset();
+    CountingMove* end = mystl::uninitialized_relocate(src, src + 4, dst);
+    EXPECT_EQ(end, dst + 4);
+    EXPECT_EQ(CountingMove::moves, 4);
+    EXPECT_EQ(CountingMove::copies, 0);
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(dst[i].value, i);
+
+    mystl::destroy(dst, dst + 4);
+    alloc.deallocate(src, 4);
+    alloc.deallocate(dst, 4);
+}
+
+// 默认初始化的 resize 与追加
+TEST(VectorTest, DefaultInitResize)
+{
+    mystl::vector<unsigned char> buf;
+    buf.resize_default_init(64);
+    EXPECT_EQ(buf.size(), 64);
+    EXPECT_GE(buf.capacity(), 64);
+    for (size_t i = 0; i < buf.size(); ++i) buf[i] = static_cast<unsigned char>(i);
+    buf.resize_default_init(16);
+    EXPECT_EQ(buf.size(), 16);
+    EXPECT_EQ(buf[15], 15);
+
+    // 非平凡类型仍然调用默认构造函数
+    mystl::vector<mystl::string> strs(3, mystl::default_init);
+    ASSERT_EQ(strs.size(), 3);
+    EXPECT_TRUE(strs[2].empty());
+    strs.resize_default_init(5);
+    EXPECT_TRUE(strs[4].empty());
+
+    mystl::vector<int> ints(4, mystl::default_init);
+    EXPECT_EQ(ints.size(), 4);
+}
+
+TEST(VectorTest, AppendUninitialized)
+{
+    mystl::vector<int> v{1, 2};
+    int* p = v.append_uninitialized(3);
+    EXPECT_EQ(p, v.data() + 2);
+    p[0] = 3;
+    p[1] = 4;
+    p[2] = 5;
+    ASSERT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i + 1);
+
+    // 循环追加时按倍数扩容
+    mystl::vector<int> w;
+    size_t reallocations = 0;
+    const int* last_data = w.data();
+    for (int i = 0; i < 1000; ++i)
+    {
+        *w.append_uninitialized(1) = i;
+        if (w.data() != last_data)
+        {
+            ++reallocations;
+            last_data = w.data();
+        }
+    }
+    EXPECT_LE(reallocations, 11u);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(w[i], i);
+}
+
+TEST(VectorTest, AppendRange)
+{
+    int arr[] = {3, 4, 5};
+    mystl::vector<int> v{1, 2};
+    v.append_range(arr, arr + 3);
+    ASSERT_EQ(v.size(), 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i + 1);
+
+    // 容量足够时的整块复制，包括插入到中间
+    v.reserve(32);
+    v.insert(v.begin() + 1, arr, arr + 3);
+    std::vector<int> expected = {1, 3, 4, 5, 2, 3, 4, 5};
+    ASSERT_EQ(v.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+
+    // 元素类型不同的区间不能按字节复制
+    long longs[] = {7, 8};
+    mystl::vector<int> narrowed;
+    narrowed.append_range(longs, longs + 2);
+    ASSERT_EQ(narrowed.size(), 2);
+    EXPECT_EQ(narrowed[0], 7);
+    EXPECT_EQ(narrowed[1], 8);
+    mystl::vector<long> widened;
+    widened.reserve(8);
+    widened.append_range(arr, arr + 3);
+    ASSERT_EQ(widened.size(), 3);
+    EXPECT_EQ(widened[2], 5);
+
+    // 非平凡类型与空区间
+    mystl::vector<mystl::string> strs;
+    mystl::string words[] = {"a", "b"};
+    strs.append_range(words, words + 2);
+    strs.append_range(words, words);
+    ASSERT_EQ(strs.size(), 2);
+    EXPECT_EQ(strs[1], "b");
+}
+
+// 增长策略
+TEST(VectorTest, GrowthPolicies)
+{
+    EXPECT_EQ(mystl::growth_x2::next_capacity(0, 1, 4), 1u);
+    EXPECT_EQ(mystl::growth_x2::next_capacity(8, 9, 4), 16u);
+    EXPECT_EQ(mystl::growth_x2::next_capacity(8, 40, 4), 40u);
+    EXPECT_EQ(mystl::growth_x1_5::next_capacity(0, 1, 4), 2u);
+    EXPECT_EQ(mystl::growth_x1_5::next_capacity(100, 101, 4), 150u);
+    // 溢出时退化为所需容量
+    const size_t huge = static_cast<size_t>(-1) / 2;
+    EXPECT_EQ(mystl::growth_x2::next_capacity(huge + 1, huge + 2, 1), huge + 2);
+
+    // 小块取整到内存池的尺寸等级，大块取整到页
+    const size_t align = mystl::MemoryPool<char>::ALIGN;
+    size_t small = mystl::growth_size_class::next_capacity(2, 3, 1);
+    EXPECT_GE(small, 3u);
+    EXPECT_EQ(small % align, 0u);
+    size_t medium = mystl::growth_size_class::next_capacity(600, 601, 1);
+    EXPECT_GE(medium, 900u);
+    EXPECT_LT(medium, 900u + align);
+    size_t large = mystl::growth_size_class::next_capacity(100000, 100001, 8);
+    EXPECT_GE(large, 150000u);
+    EXPECT_EQ(large * 8 % mystl::GROWTH_PAGE_SIZE, 0u);
+
+    mystl::vector<int, mystl::allocator<int>, mystl::growth_x1_5> v;
+    size_t last_capacity = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+        if (v.capacity() != last_capacity)
+        {
+            if (last_capacity >= 2)
+            {
+                EXPECT_EQ(v.capacity(), last_capacity * 3 / 2);
+            }
+            last_capacity = v.capacity();
+        }
+    }
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], i);
+
+    mystl::vector<double, mystl::allocator<double>, mystl::growth_size_class> w;
+    for (int i = 0; i < 50000; ++i)
+    {
+        w.emplace_back(i);
+        const size_t bytes = w.capacity() * sizeof(double);
+        EXPECT_EQ(bytes % (bytes >= mystl::GROWTH_MMAP_THRESHOLD ? mystl::GROWTH_PAGE_SIZE : align), 0u);
+    }
+    w.insert(w.begin(), 100, 1.0);
+    EXPECT_EQ(w.size(), 50100u);
+}
+
+// 可平凡重定位的元素在尾部扩容时由分配器原地调整大小
+TEST(VectorTest, ReallocateInPlace)
+{
+    mystl::vector<int> v;
+    for (int i = 0; i < 200000; ++i) v.push_back(i);
+    v.reserve(1000000);
+    EXPECT_EQ(v.capacity(), 1000000u);
+    for (int i = 0; i < 200000; ++i) ASSERT_EQ(v[i], i);
+
+    // 参数引用本容器中的元素时先在新空间构造
+    v.resize(v.capacity(), 7);
+    v.push_back(v[0]);
+    v.push_back(mystl::move(v[1]));
+    EXPECT_EQ(v[1000000], 0);
+    EXPECT_EQ(v[1000001], 1);
+    EXPECT_EQ(v[999999], 7);
+
+    v.resize(300000);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 300000u);
+    EXPECT_EQ(v[299999], 7);
+    EXPECT_EQ(v[12345], 12345);
+
+    // 可平凡重定位的非平凡类型同样适用
+    mystl::vector<mystl::string> s;
+    for (int i = 0; i < 20000; ++i) s.push_back(mystl::string(40, static_cast<char>('a' + i % 26)));
+    s.push_back(s[5]);
+    EXPECT_EQ(s.back(), mystl::string(40, 'f'));
+    for (int i = 0; i < 20000; i += 101) EXPECT_EQ(s[i][39], static_cast<char>('a' + i % 26));
+}